@@ -4,8 +4,24 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <atomic>
 #include <map>
+#include <unordered_map>
+#include <functional>
 #include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include "gc.h"
+#include "output.h"
+#include "memo.h"
+#include "file.h"
+#include "env.h"
+
+namespace BuiltIn { struct NativeFunction; }
+namespace Numeric { class KernelImpl; }
+namespace Compile { class CodeImpl; }
 
 namespace AST
 {
@@ -22,7 +38,24 @@ namespace AST
         function_expr,
         block_expr,
         /* Control flow */
-        if_else_expr, for_expr, while_expr, do_while_expr, return_expr, break_expr, continue_expr,
+        if_else_expr, for_expr, for_of_expr, while_expr, do_while_expr, return_expr, break_expr, continue_expr,
+        /* Array */
+        array_expr, array_value, index_expr, member_expr, method_call_expr,
+        typed_array_value,
+        /* Closure */
+        closure_value, cell_value, apply_expr,
+        /* Async */
+        promise_value, await_expr,
+        /* File */
+        file_value,
+        /* Object */
+        object_expr, object_value, null_value,
+        /* Regex */
+        regex_expr, regex_value,
+        /* Module */
+        import_expr, export_expr,
+        /* Inline */
+        inline_arg,
     };
 
     static std::map<Type, std::string> ASTName {
@@ -43,6 +76,27 @@ namespace AST
         { Type::break_expr     , "break"          },
         { Type::continue_expr  , "continue"       },
         { Type::block_expr     , "block"          },
+        { Type::for_of_expr    , "for_of"         },
+        { Type::array_expr     , "array"          },
+        { Type::array_value    , "array_value"    },
+        { Type::index_expr     , "index"          },
+        { Type::member_expr    , "member"         },
+        { Type::method_call_expr, "method_call"   },
+        { Type::typed_array_value, "typed_array"  },
+        { Type::closure_value  , "closure"        },
+        { Type::cell_value     , "cell"           },
+        { Type::apply_expr     , "apply"          },
+        { Type::promise_value  , "promise"        },
+        { Type::await_expr     , "await"          },
+        { Type::file_value     , "file"           },
+        { Type::object_expr    , "object"         },
+        { Type::object_value   , "object_value"   },
+        { Type::null_value     , "null"           },
+        { Type::regex_expr     , "regex"          },
+        { Type::regex_value    , "regex_value"    },
+        { Type::import_expr    , "import"         },
+        { Type::export_expr    , "export"         },
+        { Type::inline_arg     , "inline_arg"     },
     };
 
     using IntType = unsigned long long;
@@ -59,9 +113,10 @@ namespace AST
 
             void print_ast() 
             {
-                std::cout << "ASTName {" << std::endl;
-                std::cout << "  " << ASTName[SubType] << std::endl;
-                std::cout << "}" << std::endl;
+                auto& Out = Output::out();
+                Out.write("ASTName {\n  ");
+                Out.write(ASTName[SubType]);
+                Out.write("\n}\n");
             }
 
             std::string get_ast_name() { return ASTName[SubType]; }
@@ -112,8 +167,18 @@ namespace AST
         public:
             std::string Op;
             Expr Expression;
+            // Compiled on its first evaluation (EvalImpl::compile_root)
+            std::shared_ptr<const Compile::CodeImpl> Code;
+            bool CodeTried = false;
             UnaryOpExprAST(const std::string& Op, Expr Expression) : ExprAST(Type::unary_op_expr), Op(Op), Expression(Expression) { }
-        
+            ~UnaryOpExprAST()
+            {
+                while (Expression && Expression->SubType == Type::unary_op_expr && Expression.use_count() == 1)
+                {
+                    auto Next = std::move(static_cast<UnaryOpExprAST*>(Expression.get())->Expression);
+                    Expression = std::move(Next);
+                }
+            }
     };
 
     class BinaryOpExprAST : public ExprAST
@@ -121,8 +186,19 @@ namespace AST
         public:
             std::string Op;
             Expr LHS, RHS;
+            // Compiled on its first evaluation (EvalImpl::compile_root)
+            std::shared_ptr<const Compile::CodeImpl> Code;
+            bool CodeTried = false;
             BinaryOpExprAST(const std::string& Op, Expr LHS, Expr RHS) : ExprAST(Type::binary_op_expr), Op(Op), LHS(LHS), RHS(RHS) { }
-
+            // A long chain is freed one link at a time, not recursively
+            ~BinaryOpExprAST()
+            {
+                while (LHS && LHS->SubType == Type::binary_op_expr && LHS.use_count() == 1)
+                {
+                    auto Next = std::move(static_cast<BinaryOpExprAST*>(LHS.get())->LHS);
+                    LHS = std::move(Next);
+                }
+            }
     };
 
     // {   } => Block 
@@ -149,8 +225,23 @@ namespace AST
         public:
             std::string Callee;
             std::vector<Expr> Args;
+            // Built in callee, set once before evaluation (EvalImpl::resolve_built_in)
+            const BuiltIn::NativeFunction* Native = nullptr;
+            // Index of the call site, evaluators cache the callee slot by it
+            const uint32_t Site = Sites.fetch_add(1, std::memory_order_relaxed);
             CallExprAST(const std::string& Callee, std::vector<Expr> Args) : ExprAST(Type::call_expr), Callee(Callee), Args(Args) { }
 
+        private:
+            inline static std::atomic<uint32_t> Sites{ 0 };
+
+    };
+
+    // A parameter in an inline body, the argument of the call (Inline::inline_body)
+    class InlineArgExprAST : public ExprAST
+    {
+        public:
+            size_t Index;
+            InlineArgExprAST(size_t Index) : ExprAST(Type::inline_arg), Index(Index) { }
     };
 
     class FunctionAST : public ExprAST
@@ -158,6 +249,26 @@ namespace AST
         public:
             std::shared_ptr<PrototypeAST> Proto;
             std::shared_ptr<BlockExprAST> Body;
+            // Free names of the body, filled on first use (EvalImpl::resolve_upvalues)
+            bool UpvaluesResolved = false;
+            std::vector<std::string> Upvalues;
+            // Named functions declared at the top of the body, their names are
+            // bound on entry so they can call each other (EvalImpl::enter_function)
+            std::vector<std::shared_ptr<FunctionAST>> Hoisted;
+            // EvalImpl::is_pure. A pure body keeps the script functions it calls
+            // by name, and theirs; every analysis counts in PurityVersion.
+            enum class PurityState { unknown, checking, pure, impure } Purity = PurityState::unknown;
+            std::vector<std::pair<std::string, std::weak_ptr<FunctionAST>>> Callees;
+            unsigned PurityVersion = 0;
+            // 'async function', a call runs the body on its own fiber and returns a promise
+            bool IsAsync = false;
+            // Where it starts, names its trampoline (Perf::make_entry, made on first call)
+            std::string File;
+            IntType Line = 0;
+            std::atomic<void*> PerfEntry{nullptr};
+            // Numeric kernels by the kinds of the arguments, compiled on first call (Numeric::kernel_for)
+            enum class KernelState { unknown, possible, never } Kernel = KernelState::unknown;
+            std::unordered_map<uint64_t, std::shared_ptr<const Numeric::KernelImpl>> Kernels;
             // declare
             FunctionAST(std::shared_ptr<PrototypeAST> Proto) : ExprAST(Type::function_expr), Proto(Proto) { }
             // define
@@ -208,6 +319,12 @@ namespace AST
         public:
             std::vector<Expr> Cond;
             std::shared_ptr<BlockExprAST> Block;
+            // Counting loop `let i = a; i < b; i = i + c`, filled on first run (EvalImpl::match_counting_for)
+            enum class LoopShape { unknown, generic, counting } Shape = LoopShape::unknown;
+            std::string Counter;
+            std::string CmpOp;
+            Expr Bound;
+            long long Step = 0;
             // for (cond) ;
             ForExprAST(std::vector<Expr> Cond) : ExprAST(Type::for_expr), Cond(Cond) { }
             // for (cond) { statement }
@@ -215,6 +332,17 @@ namespace AST
         
     };
 
+    // for (let x of Iterable) Block
+    class ForOfExprAST : public ExprAST
+    {
+        public:
+            std::shared_ptr<VariableExprAST> Var;
+            Expr Iterable;
+            std::shared_ptr<BlockExprAST> Block;
+            ForOfExprAST(std::shared_ptr<VariableExprAST> Var, Expr Iterable, std::shared_ptr<BlockExprAST> Block) : ExprAST(Type::for_of_expr), Var(Var), Iterable(Iterable), Block(Block) { }
+
+    };
+
     class WhileExprAST : public ExprAST
     {
         public:
@@ -238,6 +366,659 @@ namespace AST
     };
 
 
+    // [ expression, ... ] => ArrayValueExprAST
+    class ArrayExprAST : public ExprAST
+    {
+        public:
+            std::vector<Expr> Elements;
+            ArrayExprAST(std::vector<Expr> Elements) : ExprAST(Type::array_expr), Elements(Elements) { }
+
+    };
+
+    // Runtime array.
+    // Elements are kept in one contiguous vector per kind, the storage only
+    // moves to boxed values when the array stops being homogeneous:
+    //   packed_int    => Ints    (all integer)
+    //   packed_double => Doubles (all float)
+    //   generic       => Values  (anything else)
+    // The transition is one way, an array never goes back to packed.
+    enum class ElementsKind { packed_int, packed_double, generic };
+
+    inline GC::Traceable* as_traceable(const Expr& E);
+
+    class ArrayValueExprAST : public ExprAST, public GC::Traceable
+    {
+        public:
+            ElementsKind Kind;
+            std::vector<IntegerValueExprAST::value_type> Ints;
+            std::vector<FloatValueExprAST::value_type> Doubles;
+            std::vector<Expr> Values;
+
+            ArrayValueExprAST() : ExprAST(Type::array_value), Kind(ElementsKind::packed_int) { }
+
+            size_t size() const
+            {
+                switch (Kind)
+                {
+                    case ElementsKind::packed_int:    return Ints.size();
+                    case ElementsKind::packed_double: return Doubles.size();
+                    default:                          return Values.size();
+                }
+            }
+
+            void reserve(size_t n)
+            {
+                switch (Kind)
+                {
+                    case ElementsKind::packed_int:    Ints.reserve(n);    break;
+                    case ElementsKind::packed_double: Doubles.reserve(n); break;
+                    default:                          Values.reserve(n);  break;
+                }
+            }
+
+            // Box the i-th element, i must be in range.
+            Expr get(size_t i) const
+            {
+                switch (Kind)
+                {
+                    case ElementsKind::packed_int:    return GC::make_value<IntegerValueExprAST>(Ints[i]);
+                    case ElementsKind::packed_double: return GC::make_value<FloatValueExprAST>(Doubles[i]);
+                    default:                          return Values[i];
+                }
+            }
+
+            // V must be a value (not a variable), i <= size().
+            void set(size_t i, Expr V)
+            {
+                transition_for(V);
+                if (i == size()) { push(V); return; }
+                switch (Kind)
+                {
+                    case ElementsKind::packed_int:    Ints[i] = std::static_pointer_cast<IntegerValueExprAST>(V)->Val;  break;
+                    case ElementsKind::packed_double: Doubles[i] = std::static_pointer_cast<FloatValueExprAST>(V)->Val; break;
+                    default:                          Values[i] = V; break;
+                }
+            }
+
+            void push(Expr V)
+            {
+                transition_for(V);
+                switch (Kind)
+                {
+                    case ElementsKind::packed_int:    Ints.push_back(std::static_pointer_cast<IntegerValueExprAST>(V)->Val);  break;
+                    case ElementsKind::packed_double: Doubles.push_back(std::static_pointer_cast<FloatValueExprAST>(V)->Val); break;
+                    default:                          Values.push_back(V); break;
+                }
+            }
+
+            // Remove and box the last element, array must not be empty.
+            Expr pop()
+            {
+                auto V = get(size() - 1);
+                switch (Kind)
+                {
+                    case ElementsKind::packed_int:    Ints.pop_back();    break;
+                    case ElementsKind::packed_double: Doubles.pop_back(); break;
+                    default:                          Values.pop_back();  break;
+                }
+                return V;
+            }
+
+            /* GC */
+            void trace(std::vector<GC::Traceable*>& Out) override
+            {
+                for (auto& V : Values)
+                    if (auto T = as_traceable(V))
+                        Out.push_back(T);
+            }
+            void clear_edges() override { Values.clear(); }
+            size_t heap_size() const override
+            {
+                return sizeof(*this) + Ints.capacity() * sizeof(Ints[0]) + Doubles.capacity() * sizeof(Doubles[0]) + Values.capacity() * sizeof(Expr);
+            }
+
+        private:
+            // Pick the storage able to hold V.
+            void transition_for(Expr V)
+            {
+                switch (Kind)
+                {
+                    case ElementsKind::packed_int:
+                        if (V->SubType == Type::integer_expr)
+                            return;
+                        // An empty array still has no element kind.
+                        if (Ints.empty() && V->SubType == Type::float_expr)
+                        {
+                            Kind = ElementsKind::packed_double;
+                            return;
+                        }
+                        break;
+                    case ElementsKind::packed_double:
+                        if (V->SubType == Type::float_expr)
+                            return;
+                        break;
+                    default:
+                        return;
+                }
+                to_generic();
+            }
+
+            void to_generic()
+            {
+                std::vector<Expr> Boxed;
+                Boxed.reserve(size());
+                for (size_t i = 0; i < size(); i++)
+                    Boxed.push_back(get(i));
+                Ints.clear(); Ints.shrink_to_fit();
+                Doubles.clear(); Doubles.shrink_to_fit();
+                Values = std::move(Boxed);
+                Kind = ElementsKind::generic;
+            }
+    };
+
+    // Fixed length numeric array, Float64Array(n) / Int32Array(n) / Uint8Array(n).
+    // Storage is one zeroed buffer aligned for the SIMD kernels, Buffer owns it.
+    // A view (mapFile) points into memory Buffer keeps alive instead, it may be read only.
+    enum class TypedKind { float64, int32, uint8 };
+
+    class TypedArrayValueExprAST : public ExprAST
+    {
+        public:
+            TypedKind Kind;
+            std::shared_ptr<void> Buffer;
+            void* Data;
+            size_t Length;
+            bool ReadOnly = false;
+
+            TypedArrayValueExprAST(TypedKind Kind, size_t Length) : ExprAST(Type::typed_array_value), Kind(Kind), Length(Length)
+            {
+                size_t Bytes = (Length * element_size() + 31) / 32 * 32;
+                if (!Bytes) Bytes = 32;
+                Data = aligned_alloc(32, Bytes);
+                if (!Data) throw std::bad_alloc();
+                memset(Data, 0, Bytes);
+                Buffer = std::shared_ptr<void>(Data, free);
+            }
+
+            TypedArrayValueExprAST(TypedKind Kind, std::shared_ptr<void> Buffer, void* Data, size_t Length, bool ReadOnly)
+                : ExprAST(Type::typed_array_value), Kind(Kind), Buffer(std::move(Buffer)), Data(Data), Length(Length), ReadOnly(ReadOnly) { }
+
+            static size_t element_size(TypedKind Kind)
+            {
+                switch (Kind)
+                {
+                    case TypedKind::float64: return sizeof(double);
+                    case TypedKind::int32:   return sizeof(int32_t);
+                    default:                 return sizeof(uint8_t);
+                }
+            }
+            size_t element_size() const { return element_size(Kind); }
+            double* f64() const { return static_cast<double*>(Data); }
+            int32_t* i32() const { return static_cast<int32_t*>(Data); }
+            uint8_t* u8() const { return static_cast<uint8_t*>(Data); }
+
+            std::string kind_name() const
+            {
+                switch (Kind)
+                {
+                    case TypedKind::float64: return "Float64Array";
+                    case TypedKind::int32:   return "Int32Array";
+                    default:                 return "Uint8Array";
+                }
+            }
+
+            // Box the i-th element, i must be in range.
+            Expr get(size_t i) const
+            {
+                if (Kind == TypedKind::float64)
+                    return GC::make_value<FloatValueExprAST>(f64()[i]);
+                if (Kind == TypedKind::uint8)
+                    return GC::make_value<IntegerValueExprAST>(u8()[i]);
+                return GC::make_value<IntegerValueExprAST>(i32()[i]);
+            }
+
+            // V is integer or float, converted to the element type.
+            void set(size_t i, Expr V)
+            {
+                double d = V->SubType == Type::integer_expr ? std::static_pointer_cast<IntegerValueExprAST>(V)->Val
+                                                            : std::static_pointer_cast<FloatValueExprAST>(V)->Val;
+                if (Kind == TypedKind::float64)
+                {
+                    f64()[i] = d;
+                    return;
+                }
+                // A Uint8Array store wraps modulo 2^8, the low byte of the int32
+                int32_t n = V->SubType == Type::integer_expr ? to_int32(std::static_pointer_cast<IntegerValueExprAST>(V)->Val)
+                                                             : to_int32(d);
+                if (Kind == TypedKind::uint8)
+                    u8()[i] = (uint8_t)n;
+                else
+                    i32()[i] = n;
+            }
+
+            // Wrap modulo 2^32 like a JS Int32Array store.
+            static int32_t to_int32(long long v) { return (int32_t)(uint32_t)(unsigned long long)v; }
+            static int32_t to_int32(double d)
+            {
+                if (!std::isfinite(d)) return 0;
+                return to_int32((long long)fmod(trunc(d), 4294967296.0));
+            }
+    };
+
+    // Object[Index]
+    class IndexExprAST : public ExprAST
+    {
+        public:
+            Expr Object, Index;
+            IndexExprAST(Expr Object, Expr Index) : ExprAST(Type::index_expr), Object(Object), Index(Index) { }
+
+    };
+
+    // Object.Name
+    class MemberExprAST : public ExprAST
+    {
+        public:
+            Expr Object;
+            std::string Name;
+            MemberExprAST(Expr Object, const std::string& Name) : ExprAST(Type::member_expr), Object(Object), Name(Name) { }
+
+    };
+
+    // Object.Name(Args)
+    class MethodCallExprAST : public ExprAST
+    {
+        public:
+            Expr Object;
+            std::string Name;
+            std::vector<Expr> Args;
+            MethodCallExprAST(Expr Object, const std::string& Name, std::vector<Expr> Args) : ExprAST(Type::method_call_expr), Object(Object), Name(Name), Args(Args) { }
+
+    };
+
+    // Callee(Args), the callee is any expression: f(1)(2), a[0](x), (function (x) {...})(1)
+    class ApplyExprAST : public ExprAST
+    {
+        public:
+            Expr Callee;
+            std::vector<Expr> Args;
+            ApplyExprAST(Expr Callee, std::vector<Expr> Args) : ExprAST(Type::apply_expr), Callee(Callee), Args(Args) { }
+
+    };
+
+    // A variable captured by a closure.
+    // The declaring scope and every closure capturing it share the cell,
+    // the scope slot holds the cell instead of the value.
+    class CellExprAST : public ExprAST, public GC::Traceable
+    {
+        public:
+            Expr Val;
+            CellExprAST(Expr Val) : ExprAST(Type::cell_value), Val(Val) { }
+
+            void trace(std::vector<GC::Traceable*>& Out) override
+            {
+                if (auto T = as_traceable(Val))
+                    Out.push_back(T);
+            }
+            void clear_edges() override { Val.reset(); }
+            size_t heap_size() const override { return sizeof(*this); }
+    };
+
+    // Runtime function value: the function and the cells of its upvalues.
+    // Only the variables the body names are captured, globals are looked up
+    // at call time and are never captured.
+    class ClosureValueExprAST : public ExprAST, public GC::Traceable
+    {
+        public:
+            using Upvalue = std::pair<std::string, std::shared_ptr<CellExprAST>>;
+            std::shared_ptr<FunctionAST> Func;
+            std::vector<Upvalue> Upvalues;
+            std::shared_ptr<Memo::TableImpl> Memo; // memoized pure function
+            // Made from a named function in value position, its name is bound
+            // to it in its own frame (EvalImpl::eval_function_value)
+            bool SelfNamed = false;
+            // Top scope of the module that made it, empty for the script's own
+            std::weak_ptr<Env::EnvImpl<Expr>> Globals;
+            ClosureValueExprAST(std::shared_ptr<FunctionAST> Func) : ExprAST(Type::closure_value), Func(Func) { }
+
+            void trace(std::vector<GC::Traceable*>& Out) override
+            {
+                for (auto& U : Upvalues)
+                    Out.push_back(U.second.get());
+            }
+            void clear_edges() override { Upvalues.clear(); }
+            size_t heap_size() const override { return sizeof(*this) + Upvalues.capacity() * sizeof(Upvalue); }
+    };
+
+    // 'await' Value
+    class AwaitExprAST : public ExprAST
+    {
+        public:
+            Expr Value;
+            AwaitExprAST(Expr Value) : ExprAST(Type::await_expr), Value(Value) { }
+
+    };
+
+    // Result of an async function, sleep(), readFile(), ...
+    // Settled once (EvalImpl::settle_promise), there is no rejection: a
+    // failing operation is an evaluation error.
+    // Reactions are the callbacks of then(), Waiters are native
+    // continuations (a suspended fiber, a promise adopting this one), both
+    // run as microtasks once the promise is settled.
+    class PromiseValueExprAST : public ExprAST, public GC::Traceable
+    {
+        public:
+            enum class StateKind { pending, fulfilled } State = StateKind::pending;
+            Expr Result;
+            struct Reaction
+            {
+                Expr Callback;
+                std::shared_ptr<PromiseValueExprAST> Derived;
+            };
+            std::vector<Reaction> Reactions;
+            std::vector<std::function<void(Expr Result)>> Waiters;
+            PromiseValueExprAST() : ExprAST(Type::promise_value) { }
+
+            bool settled() const { return State != StateKind::pending; }
+
+            void trace(std::vector<GC::Traceable*>& Out) override
+            {
+                if (auto T = as_traceable(Result))
+                    Out.push_back(T);
+                for (auto& R : Reactions)
+                {
+                    if (auto T = as_traceable(R.Callback))
+                        Out.push_back(T);
+                    Out.push_back(R.Derived.get());
+                }
+            }
+            void clear_edges() override { Result.reset(); Reactions.clear(); }
+            size_t heap_size() const override { return sizeof(*this) + Reactions.capacity() * sizeof(Reaction); }
+    };
+
+    // File opened by open(), closed by close() or when the last reference goes
+    class FileValueExprAST : public ExprAST
+    {
+        public:
+            std::shared_ptr<File::HandleImpl> Handle;
+            FileValueExprAST(std::shared_ptr<File::HandleImpl> Handle) : ExprAST(Type::file_value), Handle(Handle) { }
+
+    };
+
+    // { key: expression, ... } => ObjectValueExprAST
+    class ObjectExprAST : public ExprAST
+    {
+        public:
+            std::vector<std::pair<std::string, Expr>> Props;
+            ObjectExprAST(std::vector<std::pair<std::string, Expr>> Props) : ExprAST(Type::object_expr), Props(Props) { }
+
+    };
+
+    // Runtime object: string keys in insertion order.
+    // A lookup scans the keys while they are few, past IndexFrom keys a
+    // hash index is kept beside them.
+    class ObjectValueExprAST : public ExprAST, public GC::Traceable
+    {
+        public:
+            static const size_t IndexFrom = 8;
+            std::vector<std::string> Keys;
+            std::vector<Expr> Values;
+            std::unordered_map<std::string, size_t> Index;
+
+            ObjectValueExprAST() : ExprAST(Type::object_value) { }
+
+            size_t size() const { return Keys.size(); }
+
+            // Position of Key, size() if absent
+            size_t find(const std::string& Key) const
+            {
+                if (Keys.size() < IndexFrom)
+                {
+                    for (size_t i = 0; i < Keys.size(); i++)
+                        if (Keys[i] == Key)
+                            return i;
+                    return Keys.size();
+                }
+                auto It = Index.find(Key);
+                return It != Index.end() ? It->second : Keys.size();
+            }
+
+            // nullptr if Key is absent
+            Expr get(const std::string& Key) const
+            {
+                size_t i = find(Key);
+                return i < Values.size() ? Values[i] : nullptr;
+            }
+
+            // A new key goes last, an existing one keeps its place.
+            void set(std::string Key, Expr V)
+            {
+                size_t i = find(Key);
+                if (i < Values.size())
+                {
+                    Values[i] = std::move(V);
+                    return;
+                }
+                Keys.push_back(std::move(Key));
+                Values.push_back(std::move(V));
+                if (Keys.size() == IndexFrom)
+                    for (size_t k = 0; k < Keys.size(); k++)
+                        Index.emplace(Keys[k], k);
+                else if (Keys.size() > IndexFrom)
+                    Index.emplace(Keys.back(), i);
+            }
+
+            void trace(std::vector<GC::Traceable*>& Out) override
+            {
+                for (auto& V : Values)
+                    if (auto T = as_traceable(V))
+                        Out.push_back(T);
+            }
+            void clear_edges() override { Values.clear(); }
+            size_t heap_size() const override
+            {
+                size_t Bytes = sizeof(*this) + Values.capacity() * sizeof(Expr) + Keys.capacity() * sizeof(std::string);
+                for (auto& K : Keys)
+                    Bytes += K.capacity();
+                return Bytes + Index.size() * (sizeof(std::string) + 2 * sizeof(size_t));
+            }
+    };
+
+    // 'null', also what a missing property reads as
+    class NullValueExprAST : public ExprAST
+    {
+        public:
+            NullValueExprAST() : ExprAST(Type::null_value) { }
+
+    };
+
+    // null carries nothing, one node serves every use
+    inline Expr null_value()
+    {
+        static const Expr Null = std::make_shared<NullValueExprAST>();
+        return Null;
+    }
+
+    // /source/flags, evaluates to a RegexValueExprAST
+    class RegexExprAST : public ExprAST
+    {
+        public:
+            std::string Source, Flags;
+            RegexExprAST(const std::string& Source, const std::string& Flags) : ExprAST(Type::regex_expr), Source(Source), Flags(Flags) { }
+
+    };
+
+    // A pattern names its compiled matcher, which each evaluator keeps in
+    // its own cache (the lazy DFA grows while it matches)
+    class RegexValueExprAST : public ExprAST
+    {
+        public:
+            std::string Source, Flags;
+            RegexValueExprAST(const std::string& Source, const std::string& Flags) : ExprAST(Type::regex_value), Source(Source), Flags(Flags) { }
+
+    };
+
+    // import { a, b as c } from "path" / import * as M from "path" / import "path"
+    class ImportExprAST : public ExprAST
+    {
+        public:
+            std::string Path;
+            std::vector<std::pair<std::string, std::string>> Names; // exported name, local name
+            std::string Namespace; // import * as Namespace
+            ImportExprAST(const std::string& Path) : ExprAST(Type::import_expr), Path(Path) { }
+
+    };
+
+    // export function f() {...} / export let x = ... / export { a, b as c }
+    class ExportExprAST : public ExprAST
+    {
+        public:
+            Expr Declaration; // nullptr for a list
+            std::vector<std::pair<std::string, std::string>> Names; // local name, exported name
+            ExportExprAST(Expr Declaration) : ExprAST(Type::export_expr), Declaration(Declaration) { }
+
+    };
+
+    // Containers the collector follows
+    inline GC::Traceable* as_traceable(const Expr& E)
+    {
+        if (!E) return nullptr;
+        switch (E->SubType)
+        {
+            case Type::array_value:   return static_cast<ArrayValueExprAST*>(E.get());
+            case Type::cell_value:    return static_cast<CellExprAST*>(E.get());
+            case Type::closure_value: return static_cast<ClosureValueExprAST*>(E.get());
+            case Type::promise_value: return static_cast<PromiseValueExprAST*>(E.get());
+            case Type::object_value:  return static_cast<ObjectValueExprAST*>(E.get());
+            default:                  return nullptr;
+        }
+    }
+
+    // Call F on every direct child of E
+    template <typename Fn>
+    void for_each_child(const Expr& E, Fn&& F)
+    {
+        auto visit = [&](const Expr& C) { if (C) F(C); };
+        switch (E->SubType)
+        {
+            case Type::unary_op_expr:
+                visit(std::static_pointer_cast<UnaryOpExprAST>(E)->Expression);
+                break;
+            case Type::binary_op_expr:
+            {
+                auto B = std::static_pointer_cast<BinaryOpExprAST>(E);
+                visit(B->LHS); visit(B->RHS);
+                break;
+            }
+            case Type::call_expr:
+                for (auto& A : std::static_pointer_cast<CallExprAST>(E)->Args) visit(A);
+                break;
+            case Type::prototype_expr:
+                for (auto& A : std::static_pointer_cast<PrototypeAST>(E)->Args) visit(A);
+                break;
+            case Type::function_expr:
+            {
+                auto Func = std::static_pointer_cast<FunctionAST>(E);
+                visit(Func->Proto); visit(Func->Body);
+                break;
+            }
+            case Type::block_expr:
+                for (auto& S : std::static_pointer_cast<BlockExprAST>(E)->Statement) visit(S);
+                break;
+            case Type::return_expr:
+                visit(std::static_pointer_cast<ReturnExprAST>(E)->RetValue);
+                break;
+            case Type::if_else_expr:
+            {
+                auto If = std::static_pointer_cast<IfExprAST>(E);
+                visit(If->Cond); visit(If->IfBlock); visit(If->ElseBlock); visit(If->ElseIf);
+                break;
+            }
+            case Type::for_expr:
+            {
+                auto For = std::static_pointer_cast<ForExprAST>(E);
+                for (auto& C : For->Cond) visit(C);
+                visit(For->Block);
+                break;
+            }
+            case Type::for_of_expr:
+            {
+                auto ForOf = std::static_pointer_cast<ForOfExprAST>(E);
+                visit(ForOf->Var); visit(ForOf->Iterable); visit(ForOf->Block);
+                break;
+            }
+            case Type::while_expr:
+            {
+                auto While = std::static_pointer_cast<WhileExprAST>(E);
+                visit(While->Cond); visit(While->Block);
+                break;
+            }
+            case Type::do_while_expr:
+            {
+                auto DoWhile = std::static_pointer_cast<DoWhileExprAST>(E);
+                visit(DoWhile->Block); visit(DoWhile->Cond);
+                break;
+            }
+            case Type::array_expr:
+                for (auto& C : std::static_pointer_cast<ArrayExprAST>(E)->Elements) visit(C);
+                break;
+            case Type::object_expr:
+                for (auto& P : std::static_pointer_cast<ObjectExprAST>(E)->Props) visit(P.second);
+                break;
+            case Type::index_expr:
+            {
+                auto Index = std::static_pointer_cast<IndexExprAST>(E);
+                visit(Index->Object); visit(Index->Index);
+                break;
+            }
+            case Type::member_expr:
+                visit(std::static_pointer_cast<MemberExprAST>(E)->Object);
+                break;
+            case Type::method_call_expr:
+            {
+                auto Method = std::static_pointer_cast<MethodCallExprAST>(E);
+                visit(Method->Object);
+                for (auto& A : Method->Args) visit(A);
+                break;
+            }
+            case Type::apply_expr:
+            {
+                auto Apply = std::static_pointer_cast<ApplyExprAST>(E);
+                visit(Apply->Callee);
+                for (auto& A : Apply->Args) visit(A);
+                break;
+            }
+            case Type::await_expr:
+                visit(std::static_pointer_cast<AwaitExprAST>(E)->Value);
+                break;
+            case Type::export_expr:
+                visit(std::static_pointer_cast<ExportExprAST>(E)->Declaration);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Call F on E and everything below it, parents first and children in
+    // for_each_child order. F returns whether to go below the node. The
+    // pending nodes are kept on a heap stack, an operator chain as long as
+    // the parser takes does not grow the call stack.
+    template <typename Fn>
+    void for_each_node(const Expr& E, Fn&& F)
+    {
+        std::vector<Expr> Stack{E}, Children;
+        while (!Stack.empty())
+        {
+            auto N = std::move(Stack.back());
+            Stack.pop_back();
+            if (!N || !F(N))
+                continue;
+            Children.clear();
+            for_each_child(N, [&](const Expr& C) { Children.push_back(C); });
+            Stack.insert(Stack.end(), Children.rbegin(), Children.rend());
+        }
+    }
+
+
     inline bool isInt      (Expr e) { return e->SubType == Type::integer_expr;   }
     inline bool isFloat    (Expr e) { return e->SubType == Type::float_expr;     }
     inline bool isString   (Expr e) { return e->SubType == Type::string_expr;    }
@@ -255,6 +1036,19 @@ namespace AST
     inline bool isBreak    (Expr e) { return e->SubType == Type::break_expr;     }
     inline bool isContinue (Expr e) { return e->SubType == Type::continue_expr;  }
     inline bool isBlock    (Expr e) { return e->SubType == Type::block_expr;     }
+    inline bool isForOf    (Expr e) { return e->SubType == Type::for_of_expr;    }
+    inline bool isArray    (Expr e) { return e->SubType == Type::array_value;    }
+    inline bool isIndex    (Expr e) { return e->SubType == Type::index_expr;     }
+    inline bool isMember   (Expr e) { return e->SubType == Type::member_expr;    }
+    inline bool isTypedArray(Expr e) { return e->SubType == Type::typed_array_value; }
+    inline bool isClosure  (Expr e) { return e->SubType == Type::closure_value;  }
+    inline bool isCell     (Expr e) { return e->SubType == Type::cell_value;     }
+    inline bool isPromise  (Expr e) { return e->SubType == Type::promise_value;  }
+    inline bool isFile     (Expr e) { return e->SubType == Type::file_value;     }
+    inline bool isObject   (Expr e) { return e->SubType == Type::object_value;   }
+    inline bool isNull     (Expr e) { return e->SubType == Type::null_value;     }
+    inline bool isRegex    (Expr e) { return e->SubType == Type::regex_value;    }
+    inline bool isImport   (Expr e) { return e->SubType == Type::import_expr;    }
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include "eval.h"
+#include <cstring>
+#include <new>
+using namespace Eval;
+
+/* -- Async function -- */
+// The body runs on a fiber of its own until its first pending 'await',
+// the promise is settled with what the body returns.
+std::shared_ptr<ExprAST> EvalImpl::call_async_function(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+#ifdef elog
+    log("in call_async_function");
+#endif
+    auto P = GC::make_traced<PromiseValueExprAST>();
+    Loop::FiberImpl* F = nullptr;
+    try
+    {
+        F = new Loop::FiberImpl([this, Closure, Args, P] {
+            settle_promise(P, eval_function_body(Closure, Args));
+        });
+    }
+    catch (const std::bad_alloc&)
+    {
+        eval_err("[call_async_function] RangeError: no memory for the stack of an async call.");
+    }
+    resume_fiber(F);
+    return P;
+}
+
+// The fiber brings its own scope (and inline arguments) back, the resumer's are restored after it
+void EvalImpl::resume_fiber(Loop::FiberImpl* F)
+{
+    auto SavedScope = CurScope;
+    auto SavedArgs = InlineArgs;
+    auto SavedLine = EvalLineNumber;
+    bool Done = F->resume();
+    CurScope = SavedScope;
+    InlineArgs = SavedArgs;
+    EvalLineNumber = SavedLine;
+    if (Done)
+        delete F;
+}
+
+// await expression
+//   in an async function: suspend its fiber until the promise is settled
+//   elsewhere: run the event loop until the promise is settled
+// A value that is not a promise is the result as is.
+std::shared_ptr<ExprAST> EvalImpl::eval_await_expr(std::shared_ptr<AwaitExprAST> Await)
+{
+#ifdef elog
+    log("in eval_await_expr");
+#endif
+    auto V = eval_rvalue(Await->Value);
+    if (!isPromise(V))
+        return V;
+    auto P = ptr_to<PromiseValueExprAST>(V);
+    if (P->settled())
+        return P->Result;
+
+    if (auto F = Loop::FiberImpl::current())
+    {
+        auto SavedScope = CurScope;
+        auto SavedArgs = InlineArgs;
+        auto SavedLine = EvalLineNumber;
+        P->Waiters.push_back([this, F](std::shared_ptr<ExprAST>) { resume_fiber(F); });
+        F->suspend();
+        CurScope = SavedScope;
+        InlineArgs = SavedArgs;
+        EvalLineNumber = SavedLine;
+        return P->Result;
+    }
+
+    Loop::loop().run([&P] { return P->settled(); });
+    if (!P->settled())
+        eval_err("[await] Error: the promise can never settle, nothing is left to wait for.");
+    return P->Result;
+}
+/* ++ Async function ++ */
+
+/* -- Promise -- */
+// Fulfill P with V, a promise V is adopted: P settles when V does.
+// Waiters and reactions run as microtasks.
+void EvalImpl::settle_promise(std::shared_ptr<PromiseValueExprAST> P, std::shared_ptr<ExprAST> V)
+{
+    if (P->settled())
+        return;
+    if (V && isPromise(V))
+    {
+        auto Q = ptr_to<PromiseValueExprAST>(V);
+        if (Q == P)
+            eval_err("[settle_promise] TypeError: a promise can not resolve to itself.");
+        if (!Q->settled())
+        {
+            Q->Waiters.push_back([this, P](std::shared_ptr<ExprAST> R) { settle_promise(P, R); });
+            return;
+        }
+        V = Q->Result;
+    }
+
+    P->State = PromiseValueExprAST::StateKind::fulfilled;
+    P->Result = V;
+    auto& L = Loop::loop();
+    for (auto& W : P->Waiters)
+        L.queue_microtask([W, V] { W(V); });
+    for (auto& R : P->Reactions)
+        L.queue_microtask([this, R, V] { settle_promise(R.Derived, call_function(ptr_to<ClosureValueExprAST>(R.Callback), { V })); });
+    P->Waiters.clear();
+    P->Reactions.clear();
+}
+
+// p.then(f) => promise of f(result)
+std::shared_ptr<ExprAST> EvalImpl::promise_then(std::shared_ptr<PromiseValueExprAST> P, std::shared_ptr<ExprAST> Callback)
+{
+    if (!Callback || !isClosure(Callback))
+        eval_err("[then] TypeError: argument is not a function.");
+    auto Derived = GC::make_traced<PromiseValueExprAST>();
+    PromiseValueExprAST::Reaction R{ Callback, Derived };
+    if (!P->settled())
+        P->Reactions.push_back(R);
+    else
+    {
+        auto V = P->Result;
+        Loop::loop().queue_microtask([this, R, V] { settle_promise(R.Derived, call_function(ptr_to<ClosureValueExprAST>(R.Callback), { V })); });
+    }
+    return Derived;
+}
+/* ++ Promise ++ */
+
+/* -- Event loop built in -- */
+double EvalImpl::to_milliseconds(std::shared_ptr<ExprAST> V, const std::string& Where)
+{
+    if (isInt(V))
+        return get_value<IntegerValueExprAST>(V);
+    if (isFloat(V))
+        return get_value<FloatValueExprAST>(V);
+    eval_err("[" + Where + "] TypeError: delay must be a number.");
+    return 0;
+}
+
+// setTimeout(fn, ms, args...) / setInterval(fn, ms, args...) => timer id
+std::shared_ptr<ExprAST> EvalImpl::builtin_set_timer(std::vector<std::shared_ptr<ExprAST>>& Args, bool Repeat)
+{
+    std::string Where = Repeat ? "setInterval" : "setTimeout";
+    if (!Args[0] || !isClosure(Args[0]))
+        eval_err("[" + Where + "] TypeError: first argument is not a function.");
+    auto F = ptr_to<ClosureValueExprAST>(Args[0]);
+    double Ms = to_milliseconds(Args[1], Where);
+    std::vector<std::shared_ptr<ExprAST>> Params(Args.begin() + 2, Args.end());
+
+    // A zero interval would never let the loop wait
+    auto Id = Loop::loop().add_timer(Ms, Repeat ? std::max(Ms, 1.0) : 0, [this, F, Params] { call_function(F, Params); });
+    return GC::make_value<IntegerValueExprAST>(Id);
+}
+
+// clearTimeout(id) / clearInterval(id)
+std::shared_ptr<ExprAST> EvalImpl::builtin_clear_timer(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isInt(Args[0]))
+        eval_err("[clearTimeout] TypeError: timer id must be an integer.");
+    Loop::loop().cancel_timer(get_value<IntegerValueExprAST>(Args[0]));
+    return nullptr;
+}
+
+// sleep(ms) => promise fulfilled with ms after ms milliseconds
+std::shared_ptr<ExprAST> EvalImpl::builtin_sleep(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    double Ms = to_milliseconds(Args[0], "sleep");
+    auto P = GC::make_traced<PromiseValueExprAST>();
+    auto V = Args[0];
+    Loop::loop().add_timer(Ms, 0, [this, P, V] { settle_promise(P, V); });
+    return P;
+}
+
+// readFile(path) => promise fulfilled with the content of path.
+// Pipes and FIFOs are read as data arrives, the loop keeps running meanwhile.
+std::shared_ptr<ExprAST> EvalImpl::builtin_read_file(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isString(Args[0]))
+        eval_err("[readFile] TypeError: path must be a string.");
+    auto Path = get_value<StringValueExprAST>(Args[0]);
+    auto P = GC::make_traced<PromiseValueExprAST>();
+    int Err = Loop::loop().read_file(Path, [this, P, Path](std::string Data, int ReadErr) {
+        if (ReadErr)
+            eval_err("[readFile] Error: reading '" + Path + "': " + strerror(ReadErr) + ".");
+        settle_promise(P, GC::make_value<StringValueExprAST>(Data));
+    });
+    if (Err)
+        eval_err("[readFile] Error: can not open '" + Path + "': " + strerror(Err) + ".");
+    return P;
+}
+/* ++ Event loop built in ++ */
@@ -0,0 +1,855 @@
+#include "eval.h"
+#include "kernel.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+using namespace Eval;
+
+/* -- Typed array -- */
+std::shared_ptr<TypedArrayValueExprAST> EvalImpl::to_typed_array(std::shared_ptr<ExprAST> V, const std::string& Where)
+{
+    if (!isTypedArray(V))
+        eval_err("[" + Where + "] TypeError: expected Float64Array, Int32Array or Uint8Array, got " + V->get_ast_name() + ".");
+    return ptr_to<TypedArrayValueExprAST>(V);
+}
+
+// The arithmetic kernels cover Float64Array and Int32Array
+std::shared_ptr<TypedArrayValueExprAST> EvalImpl::to_numeric_array(std::shared_ptr<ExprAST> V, const std::string& Where)
+{
+    auto A = to_typed_array(V, Where);
+    if (A->Kind == TypedKind::uint8)
+        eval_err("[" + Where + "] TypeError: Uint8Array is not supported, convert it with Int32Array(a).");
+    return A;
+}
+
+// Float64Array(length) / Float64Array(array)
+std::shared_ptr<ExprAST> EvalImpl::builtin_typed_array(TypedKind Kind, std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto Src = Args[0];
+    if (isInt(Src))
+    {
+        if (get_value<IntegerValueExprAST>(Src) < 0)
+            eval_err("[builtin_typed_array] RangeError: invalid typed array length.");
+        return std::make_shared<TypedArrayValueExprAST>(Kind, get_value<IntegerValueExprAST>(Src));
+    }
+
+    if (!isArray(Src) && !isTypedArray(Src))
+        eval_err("[builtin_typed_array] TypeError: expected a length or an array, got " + Src->get_ast_name() + ".");
+
+    auto Len = get_length(Src);
+    auto Arr = std::make_shared<TypedArrayValueExprAST>(Kind, Len);
+    for (size_t i = 0; i < Len; i++)
+    {
+        auto V = isArray(Src) ? ptr_to<ArrayValueExprAST>(Src)->get(i) : ptr_to<TypedArrayValueExprAST>(Src)->get(i);
+        if (!isInt(V) && !isFloat(V))
+            eval_err("[builtin_typed_array] TypeError: element " + std::to_string(i) + " is not a number.");
+        Arr->set(i, V);
+    }
+    return Arr;
+}
+
+// sum(a) / min(a) / max(a)
+std::shared_ptr<ExprAST> EvalImpl::builtin_reduce(const std::string& Name, std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto& K = Kernel::kernels();
+    auto A = to_typed_array(Args[0], Name);
+    if (Name != "sum" && !A->Length)
+        eval_err("[" + Name + "] RangeError: empty typed array.");
+
+    if (A->Kind == TypedKind::float64)
+    {
+        if (Name == "sum") return GC::make_value<FloatValueExprAST>(K.sum_f64(A->f64(), A->Length));
+        if (Name == "min") return GC::make_value<FloatValueExprAST>(K.min_f64(A->f64(), A->Length));
+        return GC::make_value<FloatValueExprAST>(K.max_f64(A->f64(), A->Length));
+    }
+    if (A->Kind == TypedKind::uint8)
+    {
+        if (Name == "sum") return GC::make_value<IntegerValueExprAST>(K.sum_u8(A->u8(), A->Length));
+        if (Name == "min") return GC::make_value<IntegerValueExprAST>(K.min_u8(A->u8(), A->Length));
+        return GC::make_value<IntegerValueExprAST>(K.max_u8(A->u8(), A->Length));
+    }
+    if (Name == "sum") return GC::make_value<IntegerValueExprAST>(K.sum_i32(A->i32(), A->Length));
+    if (Name == "min") return GC::make_value<IntegerValueExprAST>(K.min_i32(A->i32(), A->Length));
+    return GC::make_value<IntegerValueExprAST>(K.max_i32(A->i32(), A->Length));
+}
+
+// dot(a, b), a and b have the same kind and length
+std::shared_ptr<ExprAST> EvalImpl::builtin_dot(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto& K = Kernel::kernels();
+    auto A = to_numeric_array(Args[0], "dot");
+    auto B = to_numeric_array(Args[1], "dot");
+    if (A->Kind != B->Kind || A->Length != B->Length)
+        eval_err("[dot] TypeError: arrays differ in kind or length.");
+
+    if (A->Kind == TypedKind::float64)
+        return GC::make_value<FloatValueExprAST>(K.dot_f64(A->f64(), B->f64(), A->Length));
+    return GC::make_value<IntegerValueExprAST>(K.dot_i32(A->i32(), B->i32(), A->Length));
+}
+
+// add(a, b) => new array a[i] + b[i]
+std::shared_ptr<ExprAST> EvalImpl::builtin_add(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto& K = Kernel::kernels();
+    auto A = to_numeric_array(Args[0], "add");
+    auto B = to_numeric_array(Args[1], "add");
+    if (A->Kind != B->Kind || A->Length != B->Length)
+        eval_err("[add] TypeError: arrays differ in kind or length.");
+
+    auto R = std::make_shared<TypedArrayValueExprAST>(A->Kind, A->Length);
+    if (A->Kind == TypedKind::float64)
+        K.add_f64(R->f64(), A->f64(), B->f64(), A->Length);
+    else
+        K.add_i32(R->i32(), A->i32(), B->i32(), A->Length);
+    return R;
+}
+
+// scale(a, k) => new array a[i] * k, an Int32Array scaled by a float gives a Float64Array
+std::shared_ptr<ExprAST> EvalImpl::builtin_scale(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto& K = Kernel::kernels();
+    auto A = to_numeric_array(Args[0], "scale");
+    auto Factor = Args[1];
+    if (!isInt(Factor) && !isFloat(Factor))
+        eval_err("[scale] TypeError: factor must be a number.");
+
+    if (A->Kind == TypedKind::int32 && isInt(Factor))
+    {
+        auto R = std::make_shared<TypedArrayValueExprAST>(TypedKind::int32, A->Length);
+        K.scale_i32(R->i32(), A->i32(), TypedArrayValueExprAST::to_int32(get_value<IntegerValueExprAST>(Factor)), A->Length);
+        return R;
+    }
+
+    double k = isInt(Factor) ? get_value<IntegerValueExprAST>(Factor) : get_value<FloatValueExprAST>(Factor);
+    auto R = std::make_shared<TypedArrayValueExprAST>(TypedKind::float64, A->Length);
+    if (A->Kind == TypedKind::float64)
+        K.scale_f64(R->f64(), A->f64(), k, A->Length);
+    else
+    {
+        for (size_t i = 0; i < A->Length; i++)
+            R->f64()[i] = A->i32()[i];
+        K.scale_f64(R->f64(), R->f64(), k, A->Length);
+    }
+    return R;
+}
+
+/* map(a, f)
+ * A function `function (x) { return expression; }` where expression only
+ * uses x, numbers, parens and + - * / is compiled to a postfix program.
+ * The program runs over blocks of elements, every operator is one kernel
+ * call on a whole block. Any other function is called once per element.
+ */
+namespace
+{
+    struct MapOp
+    {
+        enum Code { x, constant, add, sub, mul, div, neg } Op;
+        std::shared_ptr<ExprAST> Const;
+    };
+
+    bool uses_name(std::shared_ptr<ExprAST> E, const std::string& Name)
+    {
+        switch (E->SubType)
+        {
+            case Type::variable_expr:
+                return std::static_pointer_cast<VariableExprAST>(E)->Name == Name;
+            case Type::unary_op_expr:
+                return uses_name(std::static_pointer_cast<UnaryOpExprAST>(E)->Expression, Name);
+            case Type::binary_op_expr:
+            {
+                auto B = std::static_pointer_cast<BinaryOpExprAST>(E);
+                return uses_name(B->LHS, Name) || uses_name(B->RHS, Name);
+            }
+            default:
+                return false;
+        }
+    }
+
+    // Only literals and the four operators, safe to fold at compile time
+    bool is_constant_expr(std::shared_ptr<ExprAST> E)
+    {
+        switch (E->SubType)
+        {
+            case Type::integer_expr: case Type::float_expr:
+                return true;
+            case Type::unary_op_expr:
+            {
+                auto U = std::static_pointer_cast<UnaryOpExprAST>(E);
+                return (U->Op == "-" || U->Op == "+") && is_constant_expr(U->Expression);
+            }
+            case Type::binary_op_expr:
+            {
+                auto B = std::static_pointer_cast<BinaryOpExprAST>(E);
+                return (B->Op == "+" || B->Op == "-" || B->Op == "*" || B->Op == "/") && is_constant_expr(B->LHS) && is_constant_expr(B->RHS);
+            }
+            default:
+                return false;
+        }
+    }
+}
+
+static bool compile_map(EvalImpl& Eval, std::shared_ptr<ExprAST> E, const std::string& Param, std::vector<MapOp>& Code)
+{
+    // Fold with the interpreter, `1/2` keeps its integer meaning
+    if (is_constant_expr(E))
+    {
+        auto C = Eval.eval_rvalue(E);
+        if (!isInt(C) && !isFloat(C))
+            return false;
+        Code.push_back({ MapOp::constant, C });
+        return true;
+    }
+
+    switch (E->SubType)
+    {
+        case Type::variable_expr:
+            if (!uses_name(E, Param))
+                return false;
+            Code.push_back({ MapOp::x, nullptr });
+            return true;
+        case Type::unary_op_expr:
+        {
+            auto U = std::static_pointer_cast<UnaryOpExprAST>(E);
+            if (U->Op != "-" && U->Op != "+")
+                return false;
+            if (!compile_map(Eval, U->Expression, Param, Code))
+                return false;
+            if (U->Op == "-")
+                Code.push_back({ MapOp::neg, nullptr });
+            return true;
+        }
+        case Type::binary_op_expr:
+        {
+            auto B = std::static_pointer_cast<BinaryOpExprAST>(E);
+            MapOp::Code Op;
+            if (B->Op == "+") Op = MapOp::add;
+            else if (B->Op == "-") Op = MapOp::sub;
+            else if (B->Op == "*") Op = MapOp::mul;
+            else if (B->Op == "/") Op = MapOp::div;
+            else return false;
+            if (!compile_map(Eval, B->LHS, Param, Code) || !compile_map(Eval, B->RHS, Param, Code))
+                return false;
+            Code.push_back({ Op, nullptr });
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+static size_t map_stack_depth(const std::vector<MapOp>& Code)
+{
+    size_t Depth = 0, Max = 0;
+    for (auto& Op : Code)
+    {
+        if (Op.Op == MapOp::x || Op.Op == MapOp::constant) Max = std::max(Max, ++Depth);
+        else if (Op.Op != MapOp::neg) Depth--;
+    }
+    return Max;
+}
+
+static const size_t MapBlock = 256;
+
+static void run_map_f64(const std::vector<MapOp>& Code, const double* Src, double* Dst, size_t n)
+{
+    auto& K = Kernel::kernels();
+    size_t Depth = map_stack_depth(Code);
+    std::vector<std::vector<double>> Scratch(Depth, std::vector<double>(MapBlock));
+    std::vector<std::vector<double>> Consts;
+    for (auto& Op : Code)
+        if (Op.Op == MapOp::constant)
+            Consts.emplace_back(MapBlock, isInt(Op.Const) ? (double)std::static_pointer_cast<IntegerValueExprAST>(Op.Const)->Val
+                                                          : std::static_pointer_cast<FloatValueExprAST>(Op.Const)->Val);
+
+    std::vector<const double*> Stack(Depth);
+    for (size_t Base = 0; Base < n; Base += MapBlock)
+    {
+        size_t m = std::min(MapBlock, n - Base);
+        size_t sp = 0, c = 0;
+        for (auto& Op : Code)
+        {
+            switch (Op.Op)
+            {
+                case MapOp::x:        Stack[sp++] = Src + Base; break;
+                case MapOp::constant: Stack[sp++] = Consts[c++].data(); break;
+                case MapOp::neg: // a sign flip, as x * -1 in the interpreter
+                    K.neg_f64(Scratch[sp - 1].data(), Stack[sp - 1], m);
+                    Stack[sp - 1] = Scratch[sp - 1].data();
+                    break;
+                default:
+                {
+                    double* Out = Scratch[sp - 2].data();
+                    if (Op.Op == MapOp::add)      K.add_f64(Out, Stack[sp - 2], Stack[sp - 1], m);
+                    else if (Op.Op == MapOp::sub) K.sub_f64(Out, Stack[sp - 2], Stack[sp - 1], m);
+                    else if (Op.Op == MapOp::mul) K.mul_f64(Out, Stack[sp - 2], Stack[sp - 1], m);
+                    else                          K.div_f64(Out, Stack[sp - 2], Stack[sp - 1], m);
+                    Stack[--sp - 1] = Out;
+                    break;
+                }
+            }
+        }
+        std::copy(Stack[0], Stack[0] + m, Dst + Base);
+    }
+}
+
+// Integer program, same truncating division as the interpreter
+static bool run_map_i32(const std::vector<MapOp>& Code, const int32_t* Src, int32_t* Dst, size_t n)
+{
+    size_t Depth = map_stack_depth(Code);
+    std::vector<std::vector<long long>> Stack(Depth, std::vector<long long>(MapBlock));
+    for (size_t Base = 0; Base < n; Base += MapBlock)
+    {
+        size_t m = std::min(MapBlock, n - Base);
+        size_t sp = 0;
+        for (auto& Op : Code)
+        {
+            switch (Op.Op)
+            {
+                case MapOp::x:
+                    std::copy(Src + Base, Src + Base + m, Stack[sp++].data());
+                    break;
+                case MapOp::constant:
+                    std::fill(Stack[sp].begin(), Stack[sp].begin() + m, std::static_pointer_cast<IntegerValueExprAST>(Op.Const)->Val);
+                    sp++;
+                    break;
+                case MapOp::neg:
+                    for (size_t i = 0; i < m; i++) Stack[sp - 1][i] = -Stack[sp - 1][i];
+                    break;
+                default:
+                {
+                    long long* L = Stack[sp - 2].data();
+                    const long long* R = Stack[sp - 1].data();
+                    if (Op.Op == MapOp::add)      for (size_t i = 0; i < m; i++) L[i] += R[i];
+                    else if (Op.Op == MapOp::sub) for (size_t i = 0; i < m; i++) L[i] -= R[i];
+                    else if (Op.Op == MapOp::mul) for (size_t i = 0; i < m; i++) L[i] *= R[i];
+                    else
+                    {
+                        for (size_t i = 0; i < m; i++)
+                            if (!R[i]) return false;
+                        for (size_t i = 0; i < m; i++) L[i] /= R[i];
+                    }
+                    sp--;
+                    break;
+                }
+            }
+        }
+        for (size_t i = 0; i < m; i++)
+            Dst[Base + i] = TypedArrayValueExprAST::to_int32(Stack[0][i]);
+    }
+    return true;
+}
+
+std::shared_ptr<ExprAST> EvalImpl::builtin_map(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto A = to_numeric_array(Args[0], "map");
+    if (!Args[1] || !isClosure(Args[1]))
+        eval_err("[map] TypeError: second argument is not a function.");
+    auto Closure = ptr_to<ClosureValueExprAST>(Args[1]);
+    auto F = Closure->Func;
+    auto R = std::make_shared<TypedArrayValueExprAST>(A->Kind, A->Length);
+
+    // function (x) { return expression; }
+    std::vector<MapOp> Code;
+    bool Compiled = F->Proto->Args.size() == 1 && F->Body->Statement.size() == 1 && isReturn(F->Body->Statement[0]);
+    if (Compiled)
+    {
+        auto Ret = ptr_to<ReturnExprAST>(F->Body->Statement[0]);
+        Compiled = Ret->RetValue && compile_map(*this, Ret->RetValue, get_name(F->Proto->Args[0]), Code);
+    }
+    if (Compiled && A->Kind == TypedKind::int32)
+        for (auto& Op : Code)
+            if (Op.Op == MapOp::constant && !isInt(Op.Const))
+                Compiled = false;
+
+    if (Compiled)
+    {
+        if (A->Kind == TypedKind::float64)
+            run_map_f64(Code, A->f64(), R->f64(), A->Length);
+        else if (!run_map_i32(Code, A->i32(), R->i32(), A->Length))
+            eval_err("[map] RangeError: integer division by zero.");
+        return R;
+    }
+
+    // Not a simple arithmetic function, call it for every element
+    for (size_t i = 0; i < A->Length; i++)
+    {
+        auto V = call_function(Closure, { A->get(i) });
+        if (!V || (!isInt(V) && !isFloat(V)))
+            eval_err("[map] TypeError: function must return a number.");
+        R->set(i, V);
+    }
+    return R;
+}
+
+// Byte to look for in a Uint8Array: an integer or a one character string,
+// -1 if V can never be an element
+static int to_byte(EvalImpl& Eval, std::shared_ptr<ExprAST> V)
+{
+    if (isString(V))
+    {
+        auto Str = Eval.get_value<StringValueExprAST>(V);
+        return Str.size() == 1 ? (uint8_t)Str[0] : -1;
+    }
+    if (isInt(V))
+    {
+        auto N = Eval.get_value<IntegerValueExprAST>(V);
+        return N >= 0 && N <= 255 ? (int)N : -1;
+    }
+    return -1;
+}
+
+static bool element_equals(const TypedArrayValueExprAST& A, size_t i, double D)
+{
+    if (A.Kind == TypedKind::float64) return A.f64()[i] == D;
+    if (A.Kind == TypedKind::int32)   return A.i32()[i] == D;
+    return A.u8()[i] == D;
+}
+
+// indexOf(a, v) / indexOf(a, v, from) => first index >= from holding v, -1 if none.
+// A Uint8Array is searched with memchr.
+std::shared_ptr<ExprAST> EvalImpl::builtin_index_of(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto A = to_typed_array(Args[0], "indexOf");
+    size_t From = 0;
+    if (Args.size() > 2)
+    {
+        if (!isInt(Args[2]) || get_value<IntegerValueExprAST>(Args[2]) < 0)
+            eval_err("[indexOf] TypeError: start index must be a non-negative integer.");
+        From = get_value<IntegerValueExprAST>(Args[2]);
+    }
+    if (From >= A->Length)
+        return GC::make_value<IntegerValueExprAST>(-1);
+
+    if (A->Kind == TypedKind::uint8)
+    {
+        int B = to_byte(*this, Args[1]);
+        auto Hit = B < 0 ? nullptr : static_cast<const uint8_t*>(memchr(A->u8() + From, B, A->Length - From));
+        return GC::make_value<IntegerValueExprAST>(Hit ? Hit - A->u8() : -1);
+    }
+
+    if (!isInt(Args[1]) && !isFloat(Args[1]))
+        return GC::make_value<IntegerValueExprAST>(-1);
+    double D = isInt(Args[1]) ? get_value<IntegerValueExprAST>(Args[1]) : get_value<FloatValueExprAST>(Args[1]);
+    for (size_t i = From; i < A->Length; i++)
+        if (element_equals(*A, i, D))
+            return GC::make_value<IntegerValueExprAST>(i);
+    return GC::make_value<IntegerValueExprAST>(-1);
+}
+
+// count(a, v) => number of elements equal to v, count(bytes, "\n") counts lines
+std::shared_ptr<ExprAST> EvalImpl::builtin_count(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto A = to_typed_array(Args[0], "count");
+    if (A->Kind == TypedKind::uint8)
+    {
+        int B = to_byte(*this, Args[1]);
+        return GC::make_value<IntegerValueExprAST>(B < 0 ? 0 : Kernel::kernels().count_u8(A->u8(), B, A->Length));
+    }
+
+    if (!isInt(Args[1]) && !isFloat(Args[1]))
+        return GC::make_value<IntegerValueExprAST>(0);
+    double D = isInt(Args[1]) ? get_value<IntegerValueExprAST>(Args[1]) : get_value<FloatValueExprAST>(Args[1]);
+    long long N = 0;
+    for (size_t i = 0; i < A->Length; i++)
+        N += element_equals(*A, i, D);
+    return GC::make_value<IntegerValueExprAST>(N);
+}
+
+// Bytes [start, end) of a Uint8Array as Args[First], Args[First + 1], Args[First + 2],
+// start and end are optional
+std::string_view EvalImpl::to_byte_view(std::vector<std::shared_ptr<ExprAST>>& Args, size_t First, const std::string& Where)
+{
+    auto A = to_typed_array(Args[First], Where);
+    if (A->Kind != TypedKind::uint8)
+        eval_err("[" + Where + "] TypeError: expected Uint8Array, got " + A->kind_name() + ".");
+    long long Start = 0, End = A->Length;
+    if (Args.size() > First + 1)
+    {
+        if (!isInt(Args[First + 1]))
+            eval_err("[" + Where + "] TypeError: start must be an integer.");
+        Start = get_value<IntegerValueExprAST>(Args[First + 1]);
+    }
+    if (Args.size() > First + 2)
+    {
+        if (!isInt(Args[First + 2]))
+            eval_err("[" + Where + "] TypeError: end must be an integer.");
+        End = get_value<IntegerValueExprAST>(Args[First + 2]);
+    }
+    if (Start < 0 || End < Start || (size_t)End > A->Length)
+        eval_err("[" + Where + "] RangeError: range [" + std::to_string(Start) + ", " + std::to_string(End) + ") is out of bounds.");
+    return std::string_view(reinterpret_cast<const char*>(A->u8()) + Start, End - Start);
+}
+
+// text(bytes) / text(bytes, start) / text(bytes, start, end) => string of bytes [start, end)
+std::shared_ptr<ExprAST> EvalImpl::builtin_text(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    return GC::make_value<StringValueExprAST>(std::string(to_byte_view(Args, 0, "text")));
+}
+/* ++ Typed array ++ */
+
+/* -- Object -- */
+// keys(o) => array of the keys of o in insertion order
+std::shared_ptr<ExprAST> EvalImpl::builtin_keys(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isObject(Args[0]))
+        eval_err("[keys] TypeError: expected an object, got " + Args[0]->get_ast_name() + ".");
+    auto Obj = ptr_to<ObjectValueExprAST>(Args[0]);
+    auto Arr = GC::make_traced<ArrayValueExprAST>();
+    Arr->reserve(Obj->size());
+    for (auto& K : Obj->Keys)
+        Arr->push(GC::make_value<StringValueExprAST>(K));
+    return Arr;
+}
+/* ++ Object ++ */
+
+/* -- Regex -- */
+// The compiled pattern of this evaluator, compiled on first use.
+// A script building patterns from data could fill the cache without
+// end, past MaxRegexes it starts over.
+std::shared_ptr<Regex::MatcherImpl> EvalImpl::get_regex(const std::string& Source, const std::string& Flags, const std::string& Where)
+{
+    static const size_t MaxRegexes = 1024;
+    auto Key = Flags + "/" + Source;
+    auto It = Regexes.find(Key);
+    if (It != Regexes.end())
+        return It->second;
+
+    std::string Err;
+    std::shared_ptr<Regex::MatcherImpl> M = Regex::MatcherImpl::compile(Source, Flags, Err);
+    if (!M)
+        eval_err("[" + Where + "] SyntaxError: " + Err + ".");
+    if (Regexes.size() >= MaxRegexes)
+        Regexes.clear();
+    Regexes.emplace(Key, M);
+    return M;
+}
+
+std::shared_ptr<Regex::MatcherImpl> EvalImpl::to_regex(std::shared_ptr<ExprAST> V, const std::string& Where)
+{
+    if (!isRegex(V))
+        eval_err("[" + Where + "] TypeError: expected a regex, got " + V->get_ast_name() + ".");
+    auto Re = ptr_to<RegexValueExprAST>(V);
+    return get_regex(Re->Source, Re->Flags, Where);
+}
+
+// A bad pattern is reported where the literal is first evaluated
+std::shared_ptr<ExprAST> EvalImpl::eval_regex_expr(std::shared_ptr<RegexExprAST> Regex)
+{
+#ifdef elog
+    log("in eval_regex_expr");
+#endif
+    get_regex(Regex->Source, Regex->Flags, "eval_regex_expr");
+    return std::make_shared<RegexValueExprAST>(Regex->Source, Regex->Flags);
+}
+
+// RegExp(source) / RegExp(source, flags), a pattern built at run time
+std::shared_ptr<ExprAST> EvalImpl::builtin_regexp(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    std::string Source, Flags;
+    if (isRegex(Args[0]))
+        Source = ptr_to<RegexValueExprAST>(Args[0])->Source;
+    else if (isString(Args[0]))
+        Source = get_value<StringValueExprAST>(Args[0]);
+    else
+        eval_err("[RegExp] TypeError: source must be a string.");
+    if (Args.size() > 1)
+    {
+        if (!isString(Args[1]))
+            eval_err("[RegExp] TypeError: flags must be a string.");
+        Flags = get_value<StringValueExprAST>(Args[1]);
+    }
+    get_regex(Source, Flags, "RegExp");
+    return std::make_shared<RegexValueExprAST>(Source, Flags);
+}
+
+// test(re, s) / test(re, bytes, start, end) => 1 if re matches somewhere in s.
+// A Uint8Array (mapFile) is matched in place.
+std::shared_ptr<ExprAST> EvalImpl::builtin_test(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto M = to_regex(Args[0], "test");
+    std::string_view Text;
+    if (isString(Args[1]))
+        Text = ptr_to<StringValueExprAST>(Args[1])->Val;
+    else if (isTypedArray(Args[1]))
+        Text = to_byte_view(Args, 1, "test");
+    else
+        eval_err("[test] TypeError: expected a string or a Uint8Array, got " + Args[1]->get_ast_name() + ".");
+    return GC::make_value<IntegerValueExprAST>(M->test(Text) ? 1 : 0);
+}
+
+// match(s, re) => the leftmost longest match, null if none.
+// With the g flag an array of every match instead.
+std::shared_ptr<ExprAST> EvalImpl::builtin_match(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isString(Args[0]))
+        eval_err("[match] TypeError: expected a string, got " + Args[0]->get_ast_name() + ".");
+    auto M = to_regex(Args[1], "match");
+    std::string_view Text = ptr_to<StringValueExprAST>(Args[0])->Val;
+    std::vector<std::pair<size_t, size_t>> Found;
+    M->find(Text, M->Global ? SIZE_MAX : 1, Found);
+    if (Found.empty())
+        return null_value();
+    if (!M->Global)
+        return GC::make_value<StringValueExprAST>(std::string(Text.substr(Found[0].first, Found[0].second - Found[0].first)));
+
+    auto Arr = GC::make_traced<ArrayValueExprAST>();
+    Arr->reserve(Found.size());
+    for (auto& F : Found)
+        Arr->push(GC::make_value<StringValueExprAST>(std::string(Text.substr(F.first, F.second - F.first))));
+    return Arr;
+}
+
+// replace(s, re, r) => s with the first match (every match with g) replaced.
+// r is a string, where $& stands for the match and $$ for '$', or a
+// function called with the match that returns the replacement.
+std::shared_ptr<ExprAST> EvalImpl::builtin_replace(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isString(Args[0]))
+        eval_err("[replace] TypeError: expected a string, got " + Args[0]->get_ast_name() + ".");
+    auto M = to_regex(Args[1], "replace");
+    auto& Repl = Args[2];
+    if (!isString(Repl) && !isClosure(Repl))
+        eval_err("[replace] TypeError: replacement must be a string or a function.");
+
+    auto Text = get_value<StringValueExprAST>(Args[0]);
+    std::vector<std::pair<size_t, size_t>> Found;
+    M->find(Text, M->Global ? SIZE_MAX : 1, Found);
+    if (Found.empty())
+        return Args[0];
+
+    std::string Out;
+    Out.reserve(Text.size());
+    size_t Pos = 0;
+    for (auto& F : Found)
+    {
+        Out.append(Text, Pos, F.first - Pos);
+        auto Match = Text.substr(F.first, F.second - F.first);
+        if (isClosure(Repl))
+        {
+            auto R = call_function(ptr_to<ClosureValueExprAST>(Repl), { GC::make_value<StringValueExprAST>(Match) });
+            if (!R || !isString(R))
+                eval_err("[replace] TypeError: replacement function must return a string.");
+            Out += get_value<StringValueExprAST>(R);
+        }
+        else
+        {
+            auto& R = ptr_to<StringValueExprAST>(Repl)->Val;
+            for (size_t i = 0; i < R.size(); i++)
+            {
+                if (R[i] == '$' && i + 1 < R.size() && (R[i + 1] == '&' || R[i + 1] == '$'))
+                {
+                    if (R[++i] == '&')
+                        Out += Match;
+                    else
+                        Out += '$';
+                }
+                else
+                    Out += R[i];
+            }
+        }
+        Pos = F.second;
+    }
+    Out.append(Text, Pos, std::string::npos);
+    return GC::make_value<StringValueExprAST>(std::move(Out));
+}
+/* ++ Regex ++ */
+
+/* -- Registry -- */
+namespace
+{
+    Value native_print(EvalImpl& Eval, std::vector<Value>& Args)
+    {
+        for (auto& A : Args)
+            Eval.print_value(A);
+        return nullptr;
+    }
+
+    Value native_float64_array(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_typed_array(TypedKind::float64, Args); }
+    Value native_int32_array(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_typed_array(TypedKind::int32, Args); }
+    Value native_uint8_array(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_typed_array(TypedKind::uint8, Args); }
+    Value native_sum(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_reduce("sum", Args); }
+    Value native_min(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_reduce("min", Args); }
+    Value native_max(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_reduce("max", Args); }
+    Value native_dot(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_dot(Args); }
+    Value native_add(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_add(Args); }
+    Value native_scale(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_scale(Args); }
+    Value native_map(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_map(Args); }
+    Value native_index_of(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_index_of(Args); }
+    Value native_count(EvalImpl& Eval, std::vector<Value>& Args)    { return Eval.builtin_count(Args); }
+    Value native_text(EvalImpl& Eval, std::vector<Value>& Args)     { return Eval.builtin_text(Args); }
+
+    // flush() writes out what print has buffered
+    Value native_flush(EvalImpl& Eval, std::vector<Value>& Args)
+    {
+        Output::out().flush();
+        return nullptr;
+    }
+
+    // gc() collects now and returns the number of objects freed
+    Value native_gc(EvalImpl& Eval, std::vector<Value>& Args)
+    { return GC::make_value<IntegerValueExprAST>(GC::heap().collect()); }
+    Value native_gc_stats(EvalImpl& Eval, std::vector<Value>& Args)
+    { return GC::make_value<StringValueExprAST>(GC::heap().stats_string()); }
+
+    Value native_parallel_for(EvalImpl& Eval, std::vector<Value>& Args)    { return Eval.builtin_parallel_for(Args); }
+    Value native_parallel_reduce(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_parallel_reduce(Args); }
+
+    Value native_set_timeout(EvalImpl& Eval, std::vector<Value>& Args)  { return Eval.builtin_set_timer(Args, false); }
+    Value native_set_interval(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_set_timer(Args, true); }
+    Value native_clear_timer(EvalImpl& Eval, std::vector<Value>& Args)  { return Eval.builtin_clear_timer(Args); }
+    Value native_sleep(EvalImpl& Eval, std::vector<Value>& Args)        { return Eval.builtin_sleep(Args); }
+    Value native_read_file(EvalImpl& Eval, std::vector<Value>& Args)    { return Eval.builtin_read_file(Args); }
+
+    Value native_open(EvalImpl& Eval, std::vector<Value>& Args)      { return Eval.builtin_open(Args); }
+    Value native_read_line(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_read_line(Args); }
+    Value native_eof(EvalImpl& Eval, std::vector<Value>& Args)       { return Eval.builtin_eof(Args); }
+    Value native_write(EvalImpl& Eval, std::vector<Value>& Args)     { return Eval.builtin_write(Args); }
+    Value native_close(EvalImpl& Eval, std::vector<Value>& Args)     { return Eval.builtin_close(Args); }
+    Value native_map_file(EvalImpl& Eval, std::vector<Value>& Args)  { return Eval.builtin_map_file(Args); }
+
+    Value native_keys(EvalImpl& Eval, std::vector<Value>& Args)           { return Eval.builtin_keys(Args); }
+    Value native_json_parse(EvalImpl& Eval, std::vector<Value>& Args)     { return Eval.builtin_json_parse(Args); }
+    Value native_json_stringify(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_json_stringify(Args); }
+    Value native_json_read(EvalImpl& Eval, std::vector<Value>& Args)      { return Eval.builtin_json_read(Args); }
+
+    Value native_regexp(EvalImpl& Eval, std::vector<Value>& Args)  { return Eval.builtin_regexp(Args); }
+    Value native_test(EvalImpl& Eval, std::vector<Value>& Args)    { return Eval.builtin_test(Args); }
+    Value native_match(EvalImpl& Eval, std::vector<Value>& Args)   { return Eval.builtin_match(Args); }
+    Value native_replace(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_replace(Args); }
+
+    Value native_memoize(EvalImpl& Eval, std::vector<Value>& Args) { return Eval.builtin_memoize(Args); }
+    Value native_memo_stats(EvalImpl& Eval, std::vector<Value>& Args)
+    { return GC::make_value<StringValueExprAST>(Memo::stats_string()); }
+
+    const NativeFunction Natives[] = {
+        { "print",        0, native_print, true,  false },
+        { "flush",        0, native_flush, false, false },
+        /* Typed array */
+        { "Float64Array", 1, native_float64_array, false, false },
+        { "Int32Array",   1, native_int32_array,   false, false },
+        { "Uint8Array",   1, native_uint8_array,   false, false },
+        { "sum",          1, native_sum,   false, true },
+        { "min",          1, native_min,   false, true },
+        { "max",          1, native_max,   false, true },
+        { "dot",          2, native_dot,   false, true },
+        { "add",          2, native_add,   false, false },
+        { "scale",        2, native_scale, false, false },
+        { "map",          2, native_map,   false, false },
+        { "indexOf",      2, native_index_of, false, true },
+        { "count",        2, native_count,    false, true },
+        { "text",         1, native_text,     false, true },
+        /* Collector */
+        { "gc",           0, native_gc,       false, false },
+        { "gcStats",      0, native_gc_stats, false, false },
+        /* Memoization */
+        { "memoize",      1, native_memoize,    false, false },
+        { "memoStats",    0, native_memo_stats, false, false },
+        /* Parallel */
+        { "parallel_for",    3, native_parallel_for,    false, false },
+        { "parallel_reduce", 5, native_parallel_reduce, false, false },
+        /* Event loop */
+        { "setTimeout",    2, native_set_timeout,  false, false },
+        { "setInterval",   2, native_set_interval, false, false },
+        { "clearTimeout",  1, native_clear_timer,  false, false },
+        { "clearInterval", 1, native_clear_timer,  false, false },
+        { "sleep",         1, native_sleep,        false, false },
+        { "readFile",      1, native_read_file,    false, false },
+        /* File */
+        { "open",     1, native_open,      false, false },
+        { "readLine", 1, native_read_line, false, false },
+        { "eof",      1, native_eof,       false, false },
+        { "write",    2, native_write,     false, false },
+        { "close",    1, native_close,     false, false },
+        { "mapFile",  1, native_map_file,  false, false },
+        /* Object, JSON.x is called as a method of the JSON namespace */
+        { "keys",           1, native_keys,           false, false },
+        { "JSON.parse",     1, native_json_parse,     false, false },
+        { "JSON.stringify", 1, native_json_stringify, false, true },
+        { "JSON.read",      1, native_json_read,      false, false },
+        /* Regex, re.test(s), s.match(re) and s.replace(re, r) call these */
+        { "RegExp",  1, native_regexp,  false, true },
+        { "test",    2, native_test,    false, true },
+        { "match",   2, native_match,   false, true },
+        { "replace", 3, native_replace, false, false },
+    };
+}
+
+const NativeFunction* BuiltIn::find_native(const std::string& Name)
+{
+    static const std::unordered_map<std::string, const NativeFunction*> Registry = [] {
+        std::unordered_map<std::string, const NativeFunction*> R;
+        for (auto& N : Natives)
+            R[N.Name] = &N;
+        return R;
+    }();
+    auto It = Registry.find(Name);
+    return It != Registry.end() ? It->second : nullptr;
+}
+
+// Names the script binds: functions, parameters, declared, assigned or imported variables
+static void collect_bound_names(const std::shared_ptr<ExprAST>& E, std::unordered_set<std::string>& Bound, std::vector<std::shared_ptr<CallExprAST>>& Calls)
+{
+    for_each_node(E, [&](const std::shared_ptr<ExprAST>& N) {
+        switch (N->SubType)
+        {
+            case Type::call_expr:
+                Calls.push_back(std::static_pointer_cast<CallExprAST>(N));
+                break;
+            case Type::function_expr:
+                Bound.insert(std::static_pointer_cast<FunctionAST>(N)->Proto->Name);
+                break;
+            case Type::prototype_expr:
+                for (auto& P : std::static_pointer_cast<PrototypeAST>(N)->Args)
+                {
+                    auto V = isBinaryOp(P) ? std::static_pointer_cast<BinaryOpExprAST>(P)->LHS : P;
+                    if (isVariable(V))
+                        Bound.insert(std::static_pointer_cast<VariableExprAST>(V)->Name);
+                }
+                break;
+            case Type::variable_expr:
+            {
+                auto V = std::static_pointer_cast<VariableExprAST>(N);
+                if (!V->DefineType.empty())
+                    Bound.insert(V->Name);
+                break;
+            }
+            case Type::binary_op_expr:
+            {
+                auto B = std::static_pointer_cast<BinaryOpExprAST>(N);
+                if (B->Op == "=" && isVariable(B->LHS))
+                    Bound.insert(std::static_pointer_cast<VariableExprAST>(B->LHS)->Name);
+                break;
+            }
+            case Type::for_of_expr:
+                Bound.insert(std::static_pointer_cast<ForOfExprAST>(N)->Var->Name);
+                break;
+            case Type::import_expr:
+            {
+                auto Import = std::static_pointer_cast<ImportExprAST>(N);
+                for (auto& Name : Import->Names)
+                    Bound.insert(Name.second);
+                if (!Import->Namespace.empty())
+                    Bound.insert(Import->Namespace);
+                break;
+            }
+            default:
+                break;
+        }
+        return true;
+    });
+}
+
+// Bind every call of a built in function to its native entry, again after a reload.
+// A built in name the script binds somewhere may be shadowed at run time,
+// those calls keep the lookup by name.
+void EvalImpl::resolve_built_in(const std::vector<std::shared_ptr<ExprAST>>& Statements)
+{
+    std::unordered_set<std::string> Bound;
+    std::vector<std::shared_ptr<CallExprAST>> Calls;
+    for (auto& E : Statements)
+        collect_bound_names(E, Bound, Calls);
+
+    for (auto& C : Calls)
+        C->Native = Bound.count(C->Callee) ? nullptr : get_native(C->Callee);
+}
+/* ++ Registry ++ */
@@ -1,27 +1,45 @@
 #ifndef TINYJS_BUILTIN
 #define TINYJS_BUILTIN
 
+#include <memory>
+#include <string>
+#include <vector>
 #include <unordered_map>
 
+namespace AST  { class ExprAST; }
+namespace Eval { class EvalImpl; }
+
 namespace BuiltIn
 {
+    using Value = std::shared_ptr<AST::ExprAST>;
+
+    // Native function, Args are the evaluated arguments.
+    // Returning nullptr makes the call evaluate to the call node itself.
+    using NativeFn = Value (*)(Eval::EvalImpl& Eval, std::vector<Value>& Args);
+
+    struct NativeFunction
+    {
+        const char* Name;
+        int Arity;     // minimum number of arguments
+        NativeFn Fn;
+        bool Raw;      // arguments are not resolved, a variable stays a variable (print)
+        bool Pure;     // no side effect, the result only depends on the arguments
+    };
+
+    // Registry of every native function (built_in.cpp), nullptr if Name is not one.
+    const NativeFunction* find_native(const std::string& Name);
+
     class BuiltInImpl
     {
     public:
-        std::unordered_map<std::string, int> BuiltIn;
-        BuiltInImpl()
-        {
-            BuiltIn["print"] = 1;
-        }
-
-
-        bool is_built_in(const std::string& Name)
-        {
-            return BuiltIn.find(Name) != BuiltIn.end() ? true : false;
-        }
-        
+        const NativeFunction* get_native(const std::string& Name) const
+        { return find_native(Name); }
+
+        bool is_built_in(const std::string& Name) const
+        { return find_native(Name) != nullptr; }
+
     };
-    
+
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,221 @@
+#include "eval.h"
+#include <algorithm>
+using namespace Eval;
+
+/* -- Compiled expressions -- */
+namespace
+{
+    using BinaryFn = std::shared_ptr<ExprAST> (EvalImpl::*)(const std::shared_ptr<ExprAST>, const std::shared_ptr<ExprAST>);
+
+    // The operation of a binary operator, as eval_bin_op_expr_helper picks it
+    BinaryFn binary_fn(const std::string& Op)
+    {
+        if (Op.length() == 1)
+        {
+            switch (Op[0])
+            {
+                case '+': return &EvalImpl::_add;
+                case '-': return &EvalImpl::_sub;
+                case '*': return &EvalImpl::_mul;
+                case '/': return &EvalImpl::_div;
+                case '>': return &EvalImpl::_greater;
+                case '<': return &EvalImpl::_less;
+                case '%': return &EvalImpl::_mod;
+                case '&': return &EvalImpl::_bit_and;
+                case '|': return &EvalImpl::_bit_or;
+                case '^': return &EvalImpl::_bit_xor;
+                default: return nullptr;
+            }
+        }
+        if (Op == ">=") return &EvalImpl::_not_less;
+        if (Op == "<=") return &EvalImpl::_not_more;
+        if (Op == "==") return &EvalImpl::_equal;
+        if (Op == "!=") return &EvalImpl::_not_equal;
+        if (Op == "&&") return &EvalImpl::_and;
+        if (Op == "||") return &EvalImpl::_or;
+        if (Op == ">>") return &EvalImpl::_bit_rshift;
+        if (Op == "<<") return &EvalImpl::_bit_lshift;
+        return nullptr;
+    }
+}
+
+// Code of E, empty if it is not compiled (the walker runs it). ByEvalOne:
+// the walker would evaluate E with eval_one, as the operand of a unary operator.
+Compile::Code EvalImpl::compile_code(const std::shared_ptr<ExprAST>& E, bool ByEvalOne, int Depth)
+{
+    if (Depth > Compile::MaxDepth)
+        return nullptr;
+    switch (E->SubType)
+    {
+        case Type::binary_op_expr:
+            return compile_binary(ptr_to<BinaryOpExprAST>(E), Depth);
+        case Type::unary_op_expr:
+            return compile_unary(ptr_to<UnaryOpExprAST>(E), Depth);
+        case Type::integer_expr: case Type::float_expr: case Type::string_expr:
+        case Type::variable_expr:
+            return [E](EvalImpl&) { return E; };
+        case Type::inline_arg:
+        {
+            auto Index = static_cast<InlineArgExprAST*>(E.get())->Index;
+            return [Index](EvalImpl& Ev) { return (*Ev.InlineArgs)[Index]; };
+        }
+        case Type::call_expr:
+        {
+            auto Call = ptr_to<CallExprAST>(E);
+            return [Call](EvalImpl& Ev) { return Ev.eval_call_expr(Call); };
+        }
+        case Type::index_expr:
+        {
+            auto Index = ptr_to<IndexExprAST>(E);
+            return [Index](EvalImpl& Ev) { return Ev.eval_index_expr(Index); };
+        }
+        default:
+            if (ByEvalOne)
+                return [E](EvalImpl& Ev) { return Ev.eval_one(E); };
+            return [E](EvalImpl& Ev) { return Ev.eval_expression(E); };
+    }
+}
+
+bool EvalImpl::compile_operand(const std::shared_ptr<ExprAST>& E, bool ByEvalOne, int Depth, Compile::Operand& O)
+{
+    switch (E->SubType)
+    {
+        case Type::integer_expr: case Type::float_expr: case Type::string_expr:
+            O.Const = E;
+            return true;
+        case Type::variable_expr:
+            O.Var = ptr_to<VariableExprAST>(E);
+            O.Bit = EnvImpl::name_bit(O.Var->Name);
+            return true;
+        default:
+            O.Run = compile_code(E, ByEvalOne, Depth);
+            return O.Run != nullptr;
+    }
+}
+
+// The value of an operand, V is what running it gave. A name is read here,
+// after the other operand ran, with the error of the walker.
+std::shared_ptr<ExprAST> EvalImpl::resolve_operand(const Compile::Operand& O, std::shared_ptr<ExprAST> V, bool Unary)
+{
+    if (O.Const)
+        return O.Const;
+    if (!V && !O.Var)
+        return Unary ? V : GC::make_value<IntegerValueExprAST>(0); // null => 0
+    auto Var = O.Var ? O.Var.get() : isVariable(V) ? static_cast<VariableExprAST*>(V.get()) : nullptr;
+    if (!Var)
+        return V;
+    auto Val = find_name(Var->Name, O.Var ? O.Bit : EnvImpl::name_bit(Var->Name));
+    if (!Val)
+    {
+        if (Unary)
+            ERR_INFO = "[eval_unary_op_expr] ReferenceError '" + Var->Name + "' is not defined.";
+        else
+            ERR_INFO = "[eval_bin_op_expr_helper] ReferenceError: '" + Var->Name + "' is not defined. ";
+        eval_err(ERR_INFO);
+    }
+    return Val;
+}
+
+// As eval_binary_op_expr: the left operand runs, then the right one, the
+// right one is resolved, then the left one.
+Compile::Code EvalImpl::compile_binary(const std::shared_ptr<BinaryOpExprAST>& B, int Depth)
+{
+    if (B->Op == "=")
+    {
+        if (isIndex(B->LHS))
+        {
+            auto Index = ptr_to<IndexExprAST>(B->LHS);
+            auto RHS = B->RHS;
+            return [Index, RHS](EvalImpl& Ev) { return Ev.eval_index_assign(Index, RHS); };
+        }
+        if (isMember(B->LHS))
+        {
+            auto Member = ptr_to<MemberExprAST>(B->LHS);
+            auto RHS = B->RHS;
+            return [Member, RHS](EvalImpl& Ev) { return Ev.eval_member_assign(Member, RHS); };
+        }
+        if (!isVariable(B->LHS))
+            return nullptr;
+        auto Var = ptr_to<VariableExprAST>(B->LHS);
+        Compile::Operand R;
+        if (!compile_operand(B->RHS, false, Depth + 1, R))
+            return nullptr;
+        if (Var->DefineType == "var")
+            return [Var, R](EvalImpl& Ev) {
+                auto V = Ev.resolve_operand(R, Ev.run_operand(R), false);
+                Ev.get_top_scope()->set(Var->Name, V);
+                return V;
+            };
+        if (Var->DefineType == "let")
+            return [Var, R](EvalImpl& Ev) {
+                auto V = Ev.resolve_operand(R, Ev.run_operand(R), false);
+                Ev.CurScope->set(Var->Name, V);
+                return V;
+            };
+        return [Var, R](EvalImpl& Ev) {
+            auto V = Ev.resolve_operand(R, Ev.run_operand(R), false);
+            Ev.set_name(Var->Name, V);
+            return V;
+        };
+    }
+
+    auto Fn = binary_fn(B->Op);
+    if (!Fn && B->Op != ",")
+        return nullptr;
+    Compile::Operand L, R;
+    if (!compile_operand(B->LHS, false, Depth + 1, L) || !compile_operand(B->RHS, false, Depth + 1, R))
+        return nullptr;
+    if (!Fn) // a, b gives b
+        return [L, R](EvalImpl& Ev) {
+            auto LV = Ev.run_operand(L);
+            auto RV = Ev.resolve_operand(R, Ev.run_operand(R), false);
+            Ev.resolve_operand(L, std::move(LV), false);
+            return RV;
+        };
+    return [L, R, Fn](EvalImpl& Ev) {
+        auto LV = Ev.run_operand(L);
+        auto RV = Ev.resolve_operand(R, Ev.run_operand(R), false);
+        return (Ev.*Fn)(Ev.resolve_operand(L, std::move(LV), false), RV);
+    };
+}
+
+// As eval_unary_op_expr: - - !x applies from the innermost operator out
+Compile::Code EvalImpl::compile_unary(const std::shared_ptr<UnaryOpExprAST>& U, int Depth)
+{
+    enum class UnaryOp : uint8_t { neg, pos, bit_not, log_not };
+    std::vector<UnaryOp> Ops; // innermost first
+    auto E = std::static_pointer_cast<ExprAST>(U);
+    for (; isUnaryOp(E); E = ptr_to<UnaryOpExprAST>(E)->Expression, Depth++)
+    {
+        auto& Op = ptr_to<UnaryOpExprAST>(E)->Op;
+        if (Depth > Compile::MaxDepth)
+            return nullptr;
+        if (Op == "-")      Ops.push_back(UnaryOp::neg);
+        else if (Op == "+") Ops.push_back(UnaryOp::pos);
+        else if (Op == "~") Ops.push_back(UnaryOp::bit_not);
+        else if (Op == "!") Ops.push_back(UnaryOp::log_not);
+        else return nullptr;
+    }
+    std::reverse(Ops.begin(), Ops.end());
+    Compile::Operand X;
+    if (!compile_operand(E, true, Depth, X))
+        return nullptr;
+
+    std::shared_ptr<ExprAST> MinusOne = std::make_shared<IntegerValueExprAST>(-1);
+    std::shared_ptr<ExprAST> One = std::make_shared<IntegerValueExprAST>(1);
+    return [Ops, X, MinusOne, One](EvalImpl& Ev) {
+        auto V = Ev.resolve_operand(X, Ev.run_operand(X), true);
+        for (auto Op : Ops)
+        {
+            switch (Op)
+            {
+                case UnaryOp::neg:     V = Ev._mul(V, MinusOne); break;
+                case UnaryOp::pos:     V = Ev._mul(V, One); break;
+                case UnaryOp::bit_not: V = Ev._bit_not(V); break;
+                case UnaryOp::log_not: V = Ev._not(V); break;
+            }
+        }
+        return V;
+    };
+}
+/* ++ Compiled expressions ++ */
@@ -0,0 +1,51 @@
+#ifndef TINYJS_COMPILE
+#define TINYJS_COMPILE
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include "ast.h"
+
+// Compiled expressions: operator trees turned into trees of C++ closures.
+//
+// The first time an operator expression is evaluated as a whole (a
+// statement, a condition, an argument) it is compiled once: every operator
+// becomes a closure bound to its operation and to the closures of its
+// operands, constants are bound as values, names with their scope bit
+// (Env::EnvImpl::name_bit). Running it never looks at SubType, operator
+// strings or the shape of the tree again. Calls, indexing and anything
+// else that is not an operator are leaves that run the tree walker.
+//
+// The result, the order operands are evaluated and names are resolved in
+// and the errors are those of the tree walker. Names are still looked up
+// when they are read, scopes are made at run time. Expressions deeper than
+// MaxDepth are left to the walker, which needs no stack for them.
+// TINYJS_NO_COMPILE turns it off.
+
+namespace Eval { class EvalImpl; }
+
+namespace Compile
+{
+    constexpr int MaxDepth = 200;
+
+    // Gives what EvalImpl::eval_expression gives for the expression
+    using Code = std::function<AST::Expr(Eval::EvalImpl&)>;
+
+    // An operand: a constant, a name, or code to run
+    struct Operand
+    {
+        AST::Expr Const;
+        std::shared_ptr<AST::VariableExprAST> Var;
+        uint64_t Bit = 0;
+        Code Run;
+    };
+
+    class CodeImpl
+    {
+    public:
+        Code Run;
+    };
+}
+
+#endif
@@ -1,8 +1,10 @@
 #ifndef TINYJS_ENV
 #define TINYJS_ENV
 
+#include <cstdint>
 #include <string>
 #include <vector>
+#include <memory>
 #include <unordered_map>
 
 namespace Env
@@ -12,6 +14,12 @@ namespace Env
     {
     private:
         std::unordered_map<std::string, T> Symbol;
+        // Bound by position ahead of the table (bind): parameters and upvalues
+        // of a call. The names belong to the function and the closure, which
+        // outlive the call.
+        std::vector<const std::string*> SlotNames;
+        std::vector<T> Slots;
+        uint64_t Bits = 0; // name_bit of every name bound here
 
     public:
         std::string Name;
@@ -23,12 +31,72 @@ namespace Env
         EnvImpl(const std::string& Name, std::shared_ptr<EnvImpl<T>> Parent) : Name(Name), Parent(Parent) { }
         virtual ~EnvImpl() = default;
 
-        T get(const std::string& key) { return Symbol.find(key) != Symbol.end() ? Symbol[key] : nullptr; }
+        // One of 64 bits from the length and the ends of a name, no hashing.
+        // A scope without the bit of a name does not bind it.
+        static uint64_t name_bit(const std::string& key)
+        {
+            size_t h = key.size() * 31;
+            if (!key.empty())
+                h += (unsigned char)key[0] + (unsigned char)key.back() * 7;
+            return 1ull << (h & 63);
+        }
+        bool may_have(uint64_t Bit) const { return Bits & Bit; }
 
-        void set(const std::string& key, T value) { Symbol[key] = value; }
-        void set(const std::string& key) { Symbol[key] = 0; }
-        void reset() { Symbol.clear(); }
+        // Only reads the table, workers of a parallel builtin share the globals
+        T get(const std::string& key)
+        {
+            for (size_t i = 0; i < SlotNames.size(); i++)
+                if (*SlotNames[i] == key)
+                    return Slots[i];
+            auto it = Symbol.find(key);
+            return it != Symbol.end() ? it->second : nullptr;
+        }
+        // The slot of key in this scope, stays valid while the scope lives (nullptr if absent)
+        T* get_slot(const std::string& key)
+        {
+            for (size_t i = 0; i < SlotNames.size(); i++)
+                if (*SlotNames[i] == key)
+                    return &Slots[i];
+            auto it = Symbol.find(key);
+            return it != Symbol.end() ? &it->second : nullptr;
+        }
+
+        void set(const std::string& key, T value)
+        {
+            for (size_t i = 0; i < SlotNames.size(); i++)
+                if (*SlotNames[i] == key)
+                {
+                    Slots[i] = value;
+                    return;
+                }
+            Bits |= name_bit(key);
+            Symbol[key] = value;
+        }
+        void set(const std::string& key) { set(key, 0); }
+
+        // Bind key by position, key must outlive the binding (until reset)
+        void bind(const std::string& key, T value)
+        {
+            for (size_t i = 0; i < SlotNames.size(); i++)
+                if (*SlotNames[i] == key)
+                {
+                    Slots[i] = value;
+                    return;
+                }
+            Bits |= name_bit(key);
+            SlotNames.push_back(&key);
+            Slots.push_back(value);
+        }
+
+        // Forget every name, the storage is kept for the next use
+        void reset()
+        {
+            Symbol.clear();
+            SlotNames.clear();
+            Slots.clear();
+            Bits = 0;
+        }
     };
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,17 +1,20 @@
 #include "eval.h"
+#include <algorithm>
+#include <unordered_set>
 using namespace Eval;
 
-inline std::shared_ptr<ExprAST> EvalImpl::eval_block(std::vector<std::shared_ptr<ExprAST>>& Statement)
+std::shared_ptr<ExprAST> EvalImpl::eval_block(std::vector<std::shared_ptr<ExprAST>>& Statement)
 {
 #ifdef elog
     log("in eval_block");
 #endif
     if (Statement.empty())
-        return std::make_shared<IntegerValueExprAST>(0);
+        return GC::make_value<IntegerValueExprAST>(0);
 
     std::shared_ptr<ExprAST> ret;
     for (auto i : Statement)
     {
+        GC::heap().maybe_collect(); // safe point
         EvalLineNumber = i->LineNumber;
         ret = eval_one(i);
         if (is_interrupt_control_flow(ret))
@@ -20,6 +23,65 @@ inline std::shared_ptr<ExprAST> EvalImpl::eval_block(std::vector<std::shared_ptr
     return ret;
 }
 
+// The kinds eval_expression leaves out of its own frame
+std::shared_ptr<ExprAST> EvalImpl::eval_compound_expr(const std::shared_ptr<ExprAST>& E)
+{
+    switch (E->SubType)
+    {
+        case Type::await_expr:
+            return eval_await_expr(ptr_to<AwaitExprAST>(E));
+        case Type::apply_expr:
+            return eval_apply_expr(ptr_to<ApplyExprAST>(E));
+        case Type::for_expr:
+            return eval_for(ptr_to<ForExprAST>(E));
+        case Type::for_of_expr:
+            return eval_for_of(ptr_to<ForOfExprAST>(E));
+        case Type::while_expr:
+            return eval_while(ptr_to<WhileExprAST>(E));
+        case Type::do_while_expr:
+            return eval_do_while(ptr_to<DoWhileExprAST>(E));
+        case Type::array_expr:
+            return eval_array_expr(ptr_to<ArrayExprAST>(E));
+        case Type::object_expr:
+            return eval_object_expr(ptr_to<ObjectExprAST>(E));
+        case Type::regex_expr:
+            return eval_regex_expr(ptr_to<RegexExprAST>(E));
+        case Type::import_expr:
+            return eval_import_expr(ptr_to<ImportExprAST>(E));
+        case Type::export_expr:
+            return eval_export_expr(ptr_to<ExportExprAST>(E));
+        case Type::method_call_expr:
+            return eval_method_call_expr(ptr_to<MethodCallExprAST>(E));
+        default:
+            E->print_ast();
+            eval_err("Illegal statement");
+    }
+    return nullptr;
+}
+
+// The value is taken here, the scope of a nested block is gone by the
+// time the caller unwraps the return
+std::shared_ptr<ExprAST> EvalImpl::eval_return_expr(const std::shared_ptr<ExprAST>& E)
+{
+    auto& R = static_cast<ReturnExprAST&>(*E);
+    if (!R.RetValue)
+        return E;
+    auto V = eval_expression(R.RetValue);
+    return std::make_shared<ReturnExprAST>(V && isVariable(V) ? variable_rvalue(V) : V);
+}
+
+// Value of the variable V evaluated to
+std::shared_ptr<ExprAST> EvalImpl::variable_rvalue(const std::shared_ptr<ExprAST>& V)
+{
+    auto _v = get_variable_value(V);
+    if (!_v)
+    {
+        ERR_INFO = "ReferenceError: '" + get_name(V) + "' is not defined.";
+        eval_err(ERR_INFO);
+    }
+    return _v;
+}
+
 std::shared_ptr<ExprAST> EvalImpl::eval_return(std::shared_ptr<ReturnExprAST> R)
 {
 #ifdef elog
@@ -33,11 +95,68 @@ std::shared_ptr<ExprAST> EvalImpl::eval_return(std::shared_ptr<ReturnExprAST> R)
     return R;
 }
 
-inline std::shared_ptr<ExprAST> EvalImpl::eval_function_expr(std::shared_ptr<FunctionAST> F)
+std::shared_ptr<ExprAST> EvalImpl::eval_function_expr(std::shared_ptr<FunctionAST> F)
 {
+#ifdef elog
+    log("in eval_function_expr");
+#endif
+    auto& Name = F->Proto->Name;
+    if (Name.empty())
+        return make_closure(F);
+
     // Register function in current scope
-    CurScope->set(F->Proto->Name, F);
-    return F;
+    if (is_top_scope())
+    {
+        auto C = make_closure(F);
+        CurScope->set(Name, C);
+        return C;
+    }
+
+    // A local function may call itself, its name is bound to a cell
+    // before the closure is made so the body captures it. A function
+    // declared at the top of a body fills the cell bound on entry.
+    auto V = CurScope->get(Name);
+    auto Cell = V && isCell(V) && !ptr_to<CellExprAST>(V)->Val ? ptr_to<CellExprAST>(V) : GC::make_traced<CellExprAST>(nullptr);
+    CurScope->set(Name, Cell);
+    auto C = make_closure(F);
+    Cell->Val = C;
+    return C;
+}
+
+// A function as a value: `let fact = function f(n) { ... f(n - 1) ... }`.
+// Its name is seen by its own body only, enter_function binds it.
+std::shared_ptr<ClosureValueExprAST> EvalImpl::eval_function_value(std::shared_ptr<FunctionAST> F)
+{
+    auto C = make_closure(F);
+    C->SelfNamed = !F->Proto->Name.empty();
+    return C;
+}
+
+// Truth of the condition of an if, out of the frame its blocks run in
+bool EvalImpl::eval_condition(const std::shared_ptr<ExprAST>& CondExpr)
+{
+    auto Cond = eval_one(CondExpr);
+    if (!Cond)
+        return false;
+    switch (Cond->SubType)
+    {
+        case Type::integer_expr:
+        case Type::float_expr:
+        case Type::string_expr:
+        case Type::variable_expr:
+        case Type::array_value:
+        case Type::closure_value:
+        case Type::promise_value:
+        case Type::file_value:
+        case Type::object_value:
+        case Type::null_value:
+        case Type::regex_value:
+            return value_to_bool(Cond);
+        default:
+            Cond->print_ast();
+            eval_err("[eval_if_else] Uncaught SyntaxError: Unexpected name " + Cond->get_ast_name() + ".");
+    }
+    return true;
 }
 
 std::shared_ptr<ExprAST> EvalImpl::eval_if_else(std::shared_ptr<IfExprAST> If)
@@ -47,25 +166,7 @@ std::shared_ptr<ExprAST> EvalImpl::eval_if_else(std::shared_ptr<IfExprAST> If)
 #endif
     enter_new_env();
 
-    auto Cond = eval_one(If->Cond);
-    bool cond_bool = true;
-    if (!Cond) 
-        cond_bool = false;
-    else
-    {
-        switch (Cond->SubType)
-        {
-            case Type::integer_expr:
-            case Type::float_expr:
-            case Type::string_expr:
-            case Type::variable_expr:
-                cond_bool = value_to_bool(Cond);
-                break;
-            default:
-                Cond->print_ast();
-                eval_err("[eval_if_else] Uncaught SyntaxError: Unexpected name " + Cond->get_ast_name() + ".");
-        }
-    }
+    bool cond_bool = eval_condition(If->Cond);
 
     // Execute if-statement
     if (cond_bool)
@@ -103,25 +204,28 @@ std::shared_ptr<ExprAST> EvalImpl::eval_for(std::shared_ptr<ForExprAST> For)
     enter_new_env();
 
     auto InitCond = eval_expression(For->Cond[0]);
-    if (!For->Block->Statement.empty())
+    if (For->Block && !For->Block->Statement.empty())
     {
+        std::shared_ptr<ExprAST> R;
+        if (match_counting_for(For) && eval_counting_for(For, R))
+        {
+            recover_prev_env();
+            return R ? R : For;
+        }
+
         while (value_to_bool(eval_expression(For->Cond[1])))
         {
-            if (For->Block)
+            auto R = eval_block(For->Block->Statement);
+            if (is_interrupt_control_flow(R))
             {
-                auto R = eval_block(For->Block->Statement);
-                if (is_interrupt_control_flow(R))
+                if (isBreak(R))
+                    break;
+                else if (isReturn(R))
                 {
-                    if (isBreak(R))
-                        break;
-                    else if (isContinue(R))
-                        continue;
-                    else if (isReturn(R))
-                    {
-                        recover_prev_env();
-                        return R;
-                    }
+                    recover_prev_env();
+                    return R;
                 }
+                // continue still runs the step
             }
             eval_expression(For->Cond[2]);
         }
@@ -131,6 +235,226 @@ std::shared_ptr<ExprAST> EvalImpl::eval_for(std::shared_ptr<ForExprAST> For)
     return For;
 }
 
+/* -- Counting loop -- */
+// Does E assign or redeclare Name, or capture it in a closure?
+static bool writes_name(EvalImpl& Eval, const std::shared_ptr<ExprAST>& E, const std::string& Name)
+{
+    bool Writes = false;
+    for_each_node(E, [&](const std::shared_ptr<ExprAST>& N) {
+        if (Writes)
+            return false;
+        switch (N->SubType)
+        {
+            case Type::variable_expr:
+            {
+                auto V = std::static_pointer_cast<VariableExprAST>(N);
+                Writes = !V->DefineType.empty() && V->Name == Name;
+                return false;
+            }
+            case Type::binary_op_expr:
+            {
+                auto B = std::static_pointer_cast<BinaryOpExprAST>(N);
+                if (B->Op == "=" && isVariable(B->LHS) && std::static_pointer_cast<VariableExprAST>(B->LHS)->Name == Name)
+                    Writes = true;
+                break;
+            }
+            case Type::for_of_expr:
+                if (std::static_pointer_cast<ForOfExprAST>(N)->Var->Name == Name)
+                    Writes = true;
+                break;
+            case Type::function_expr:
+            {
+                auto& Upvalues = Eval.resolve_upvalues(std::static_pointer_cast<FunctionAST>(N));
+                Writes = std::find(Upvalues.begin(), Upvalues.end(), Name) != Upvalues.end();
+                return false;
+            }
+            default:
+                break;
+        }
+        return !Writes;
+    });
+    return Writes;
+}
+
+// for (let i = a; i < b; i = i + c) where c is an integer literal, the
+// comparison is one of < <= > >= != and only the step changes i.
+// The counter is a `let` of the loop scope, a called function can not see it.
+bool EvalImpl::match_counting_for(std::shared_ptr<ForExprAST> For)
+{
+    using Shape = ForExprAST::LoopShape;
+    if (For->Shape != Shape::unknown)
+        return For->Shape == Shape::counting;
+    For->Shape = Shape::generic;
+
+    auto is_counter = [](const std::shared_ptr<ExprAST>& E, const std::string& Name) {
+        return isVariable(E) && std::static_pointer_cast<VariableExprAST>(E)->DefineType.empty()
+                             && std::static_pointer_cast<VariableExprAST>(E)->Name == Name;
+    };
+
+    // let i = a
+    auto& Init = For->Cond[0];
+    if (!isBinaryOp(Init) || ptr_to<BinaryOpExprAST>(Init)->Op != "=" || !isVariable(ptr_to<BinaryOpExprAST>(Init)->LHS))
+        return false;
+    auto Var = ptr_to<VariableExprAST>(ptr_to<BinaryOpExprAST>(Init)->LHS);
+    if (Var->DefineType != "let")
+        return false;
+    auto& Name = Var->Name;
+
+    // i < b
+    auto& Test = For->Cond[1];
+    if (!Test || !isBinaryOp(Test))
+        return false;
+    auto Cmp = ptr_to<BinaryOpExprAST>(Test);
+    if ((Cmp->Op != "<" && Cmp->Op != "<=" && Cmp->Op != ">" && Cmp->Op != ">=" && Cmp->Op != "!=") || !is_counter(Cmp->LHS, Name))
+        return false;
+
+    // i = i + c, i = c + i, i = i - c
+    auto& Update = For->Cond[2];
+    if (!Update || !isBinaryOp(Update) || ptr_to<BinaryOpExprAST>(Update)->Op != "=" || !is_counter(ptr_to<BinaryOpExprAST>(Update)->LHS, Name))
+        return false;
+    auto Next = ptr_to<BinaryOpExprAST>(Update)->RHS;
+    if (!isBinaryOp(Next))
+        return false;
+    auto Add = ptr_to<BinaryOpExprAST>(Next);
+    long long Step;
+    if (Add->Op == "+" && is_counter(Add->LHS, Name) && isInt(Add->RHS))
+        Step = get_value<IntegerValueExprAST>(Add->RHS);
+    else if (Add->Op == "+" && isInt(Add->LHS) && is_counter(Add->RHS, Name))
+        Step = get_value<IntegerValueExprAST>(Add->LHS);
+    else if (Add->Op == "-" && is_counter(Add->LHS, Name) && isInt(Add->RHS))
+        Step = -get_value<IntegerValueExprAST>(Add->RHS);
+    else
+        return false;
+
+    if (writes_name(*this, For->Block, Name) || writes_name(*this, Cmp->RHS, Name))
+        return false;
+
+    For->Counter = Name;
+    For->CmpOp = Cmp->Op;
+    For->Bound = Cmp->RHS;
+    For->Step = Step;
+    For->Shape = Shape::counting;
+    return true;
+}
+
+// Run a counting loop with the counter in a native integer. The scope slot
+// is updated every round for the body to read, in place while nothing else
+// holds the node. A bound that is not an integer is compared the generic way.
+// Returns false when the counter does not start as an integer, nothing ran.
+bool EvalImpl::eval_counting_for(std::shared_ptr<ForExprAST> For, std::shared_ptr<ExprAST>& Ret)
+{
+#ifdef elog
+    log("in eval_counting_for");
+#endif
+    auto Slot = CurScope->get_slot(For->Counter);
+    if (!Slot || !*Slot || !isInt(*Slot))
+        return false;
+
+    enum { lt, le, gt, ge, ne } Op;
+    if (For->CmpOp == "<")       Op = lt;
+    else if (For->CmpOp == "<=") Op = le;
+    else if (For->CmpOp == ">")  Op = gt;
+    else if (For->CmpOp == ">=") Op = ge;
+    else                         Op = ne;
+
+    long long i = get_value<IntegerValueExprAST>(*Slot);
+    long long Step = For->Step;
+    bool ConstBound = isInt(For->Bound);
+    long long Bound = ConstBound ? get_value<IntegerValueExprAST>(For->Bound) : 0;
+    auto& Statement = For->Block->Statement;
+    while (true)
+    {
+        bool Cond;
+        auto B = ConstBound ? nullptr : eval_rvalue(For->Bound);
+        if (!ConstBound && !isInt(B))
+            Cond = value_to_bool(eval_expression(For->Cond[1]));
+        else
+        {
+            if (!ConstBound)
+                Bound = get_value<IntegerValueExprAST>(B);
+            switch (Op)
+            {
+                case lt: Cond = i <  Bound; break;
+                case le: Cond = i <= Bound; break;
+                case gt: Cond = i >  Bound; break;
+                case ge: Cond = i >= Bound; break;
+                default: Cond = i != Bound; break;
+            }
+        }
+        if (!Cond)
+            break;
+
+        auto R = eval_block(Statement);
+        if (is_interrupt_control_flow(R))
+        {
+            if (isBreak(R))
+                break;
+            if (isReturn(R))
+            {
+                Ret = R;
+                return true;
+            }
+        }
+
+        i += Step;
+        if (Slot->use_count() == 1)
+            ptr_to<IntegerValueExprAST>(*Slot)->Val = i;
+        else
+            *Slot = GC::make_value<IntegerValueExprAST>(i);
+    }
+    return true;
+}
+/* ++ Counting loop ++ */
+
+std::shared_ptr<ExprAST> EvalImpl::eval_for_of(std::shared_ptr<ForOfExprAST> ForOf)
+{
+#ifdef elog
+    log("in eval_for_of");
+#endif
+    enter_new_env();
+
+    auto Iterable = eval_rvalue(ForOf->Iterable);
+    if (isFile(Iterable))
+    {
+        auto R = eval_for_of_lines(ForOf, ptr_to<FileValueExprAST>(Iterable));
+        recover_prev_env();
+        return R;
+    }
+    if (!isArray(Iterable) && !isTypedArray(Iterable))
+        eval_err("[eval_for_of] TypeError: " + Iterable->get_ast_name() + " is not iterable.");
+    auto Var = ForOf->Var;
+
+    // The length is read every round, the body may push or pop
+    for (size_t i = 0; i < get_length(Iterable); i++)
+    {
+        auto Element = isArray(Iterable) ? ptr_to<ArrayValueExprAST>(Iterable)->get(i)
+                                         : ptr_to<TypedArrayValueExprAST>(Iterable)->get(i);
+        if (Var->DefineType == "var")
+            get_top_scope()->set(Var->Name, Element);
+        else if (Var->DefineType == "let")
+            CurScope->set(Var->Name, Element);
+        else
+            set_name(Var->Name, Element);
+
+        auto R = eval_block(ForOf->Block->Statement);
+        if (is_interrupt_control_flow(R))
+        {
+            if (isBreak(R))
+                break;
+            else if (isContinue(R))
+                continue;
+            else if (isReturn(R))
+            {
+                recover_prev_env();
+                return R;
+            }
+        }
+    }
+
+    recover_prev_env();
+    return ForOf;
+}
+
 std::shared_ptr<ExprAST> EvalImpl::eval_while(std::shared_ptr<WhileExprAST> While)
 {
 #ifdef elog
@@ -194,59 +518,422 @@ std::shared_ptr<ExprAST> EvalImpl::eval_call_expr(std::shared_ptr<CallExprAST> C
 #ifdef elog
     log("in eval_call_expr");
 #endif
-    // If built in function
-    if (is_built_in(Caller->Callee))
-        return exec_built_in(Caller);
+    // Built in, resolved before evaluation
+    if (Caller->Native)
+        return exec_built_in(Caller->Native, Caller);
 
-    // Find function prototype
-    auto F = find_name(Caller->Callee);
+    // Find function prototype, a script function shadows a built in one
+    auto F = find_callee(*Caller);
+
+    // If built in function
     if (!F)
+        if (auto Native = get_native(Caller->Callee))
+            return exec_built_in(Native, Caller);
+
+    if (!F || !isClosure(F))
+        callee_err(*Caller, F != nullptr);
+    auto Closure = ptr_to<ClosureValueExprAST>(F);
+    auto Args = eval_arguments(Caller->Args);
+    if (auto Body = inline_at(*Caller, *Closure, Args))
+        return eval_inline(*Body, Closure, Args);
+    return call_function(Closure, Args);
+}
+
+void EvalImpl::callee_err(const CallExprAST& Caller, bool Defined)
+{
+    if (!Defined)
+        ERR_INFO = "[eval_call_expr] ReferenceError: '" + Caller.Callee + "' is not defined. ";
+    else
+        ERR_INFO = "[eval_call_expr] TypeError: '" + Caller.Callee + "' is not a function. ";
+    eval_err(ERR_INFO);
+}
+
+// find_name of the callee. The slot of a global callee is kept per call
+// site, valid while the lookup still ends in the same top scope.
+std::shared_ptr<ExprAST> EvalImpl::find_callee(const CallExprAST& Caller)
+{
+    auto& Name = Caller.Callee;
+    auto Bit = EnvImpl::name_bit(Name);
+    auto S = &CurScope;
+    for (; (*S)->Parent; S = &(*S)->Parent)
+        if ((*S)->may_have(Bit))
+            if (auto V = (*S)->get_slot(Name); V && *V)
+                return isCell(*V) ? ptr_to<CellExprAST>(*V)->Val : *V;
+
+    if (Caller.Site >= CallSites.size())
+        CallSites.resize(Caller.Site + 1);
+    auto& Site = CallSites[Caller.Site];
+    if (Site.Scope != *S)
     {
-        ERR_INFO = "[eval_call_expr] ReferenceError: '" + Caller->Callee + "' is not defined. ";
-        eval_err(ERR_INFO);
+        auto V = (*S)->get_slot(Name);
+        if (!V)
+            return nullptr;
+        Site.Scope = *S;
+        Site.Slot = V;
     }
+    auto& V = *Site.Slot;
+    if (V && isCell(V))
+        return ptr_to<CellExprAST>(V)->Val;
+    return V;
+}
 
-    // Get function definition
-    auto Func = ptr_to<FunctionAST>(F);
+// Inline body for a call of Closure at this site, decided once the site
+// called its function InlineAfter times. Another function starts over.
+const Inline::BodyImpl* EvalImpl::inline_at(const CallExprAST& Caller, const ClosureValueExprAST& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!Inlining || PerfEntries || Closure.Memo || !Closure.Upvalues.empty() || Closure.SelfNamed)
+        return nullptr;
+    if (Caller.Site >= CallSites.size())
+        CallSites.resize(Caller.Site + 1);
+    auto& Site = CallSites[Caller.Site];
+    if (Site.Func != Closure.Func)
+    {
+        Site.Func = Closure.Func;
+        Site.Inlined = nullptr;
+        Site.Calls = 0;
+    }
+    if (Site.Calls < Inline::InlineAfter)
+    {
+        if (++Site.Calls < Inline::InlineAfter)
+            return nullptr;
+        // Numbers only run faster as a kernel
+        auto& Func = *Closure.Func;
+        if (NumericKernels && Func.Kernel != FunctionAST::KernelState::never && Numeric::kernel_for(Func, Args, false))
+            return nullptr;
+        auto B = Inline::inline_body(Func);
+        if (B && Args.size() >= B->Params)
+            Site.Inlined = B;
+    }
+    return Site.Inlined.get();
+}
 
-    // Creat new function environment, Switch sub scope
-    enter_new_env();
+// Parameters read Args, other names are the globals of the closure as in
+// its frame. The lines are those the body would run at.
+std::shared_ptr<ExprAST> EvalImpl::eval_inline(const Inline::BodyImpl& Body, const std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+#ifdef elog
+    log("in eval_inline");
+#endif
+    auto CallerScope = std::move(CurScope);
+    auto CallerArgs = InlineArgs;
+    CurScope = globals_of(Closure);
+    InlineArgs = &Args;
 
-    // Set parameters
-    if (Caller->Args.size() >= Func->Proto->Args.size())
+    std::shared_ptr<ExprAST> R;
+    for (auto& X : Body.Exits)
     {
-        for (int i = 0; i < Func->Proto->Args.size(); ++i)
+        if (X.Cond)
         {
-            // If variable, get value
-            auto tmp_V = eval_expression(Caller->Args[i]);
-            if (isVariable(tmp_V)) tmp_V = get_variable_value(tmp_V);
-            CurScope->set(get_name(Func->Proto->Args[i]), tmp_V);
+            EvalLineNumber = X.CondLine;
+            auto C = eval_rvalue(X.Cond);
+            if (!C || !value_to_bool(C))
+                continue;
         }
+        EvalLineNumber = X.Line;
+        R = eval_rvalue(X.Value);
+        break;
     }
-    else
+
+    InlineArgs = CallerArgs;
+    CurScope = std::move(CallerScope);
+    // Nothing to return is the return itself, as eval_return gives it
+    return R ? R : std::make_shared<ReturnExprAST>();
+}
+
+// f(1)(2), a[0](x), (function (x) {...})(1)
+std::shared_ptr<ExprAST> EvalImpl::eval_apply_expr(std::shared_ptr<ApplyExprAST> Apply)
+{
+#ifdef elog
+    log("in eval_apply_expr");
+#endif
+    auto Callee = eval_rvalue(Apply->Callee);
+    if (!Callee || !isClosure(Callee))
+    {
+        ERR_INFO = "[eval_apply_expr] TypeError: " + (Callee ? Callee->get_ast_name() : std::string("undefined")) + " is not a function. ";
+        eval_err(ERR_INFO);
+    }
+    return call_function(ptr_to<ClosureValueExprAST>(Callee), eval_arguments(Apply->Args));
+}
+
+// Arguments are evaluated in the caller's scope
+std::vector<std::shared_ptr<ExprAST>> EvalImpl::eval_arguments(const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    std::vector<std::shared_ptr<ExprAST>> Values;
+    Values.reserve(Args.size());
+    for (auto& A : Args)
+    {
+        // If variable, get value
+        auto tmp_V = eval_expression(A);
+        if (isVariable(tmp_V)) tmp_V = get_variable_value(tmp_V);
+        Values.push_back(tmp_V);
+    }
+    return Values;
+}
+
+/* -- Closure -- */
+namespace
+{
+    struct NameSet
+    {
+        std::unordered_set<std::string> Declared;
+        std::unordered_set<std::string> Seen;
+        std::vector<std::string> Used; // first use order
+
+        void use(const std::string& Name)
+        {
+            if (Seen.insert(Name).second)
+                Used.push_back(Name);
+        }
+    };
+}
+
+// Names declared and used by a function body.
+// A nested function is not entered, its own free names are used instead.
+static void collect_names(EvalImpl& Eval, const std::shared_ptr<ExprAST>& E, NameSet& Names)
+{
+    for_each_node(E, [&](const std::shared_ptr<ExprAST>& N) {
+        switch (N->SubType)
+        {
+            case Type::variable_expr:
+            {
+                auto V = std::static_pointer_cast<VariableExprAST>(N);
+                if (V->DefineType.empty())
+                    Names.use(V->Name);
+                else
+                    Names.Declared.insert(V->Name);
+                return false;
+            }
+            case Type::call_expr:
+                Names.use(std::static_pointer_cast<CallExprAST>(N)->Callee);
+                break;
+            case Type::function_expr:
+            {
+                auto F = std::static_pointer_cast<FunctionAST>(N);
+                if (!F->Proto->Name.empty())
+                    Names.Declared.insert(F->Proto->Name);
+                for (auto& U : Eval.resolve_upvalues(F))
+                    Names.use(U);
+                return false;
+            }
+            default:
+                break;
+        }
+        return true;
+    });
+}
+
+// Free names of F: used by the body (or a default value), not a parameter
+// and not declared inside. Computed once per function.
+const std::vector<std::string>& EvalImpl::resolve_upvalues(std::shared_ptr<FunctionAST> F)
+{
+    if (F->UpvaluesResolved)
+        return F->Upvalues;
+
+    NameSet Names;
+    for (auto& P : F->Proto->Args)
+    {
+        Names.Declared.insert(get_name(P));
+        if (isBinaryOp(P)) // default value
+            collect_names(*this, ptr_to<BinaryOpExprAST>(P)->RHS, Names);
+    }
+    if (F->Body)
+    {
+        collect_names(*this, F->Body, Names);
+        for (auto& S : F->Body->Statement)
+            if (S->SubType == Type::function_expr && !ptr_to<FunctionAST>(S)->Proto->Name.empty())
+                F->Hoisted.push_back(std::static_pointer_cast<FunctionAST>(S));
+    }
+
+    for (auto& N : Names.Used)
+        if (!Names.Declared.count(N))
+            F->Upvalues.push_back(N);
+    F->UpvaluesResolved = true;
+    return F->Upvalues;
+}
+
+// Capture the upvalues of F from the current scope chain.
+// The slot of a captured variable is turned into a cell shared with the
+// closure. Names only found in the top scope are globals, they are looked up
+// when the closure runs.
+std::shared_ptr<ClosureValueExprAST> EvalImpl::make_closure(std::shared_ptr<FunctionAST> F)
+{
+#ifdef elog
+    log("in make_closure");
+#endif
+    auto C = GC::make_traced<ClosureValueExprAST>(F);
+    auto Top = get_top_scope();
+    if (Top != Scope) // made by a module
+        C->Globals = Top;
+    if (MemoizeAll && is_pure(F))
+        C->Memo = std::make_shared<Memo::TableImpl>();
+    for (auto& Name : resolve_upvalues(F))
     {
-        for (int i = 0; i < Caller->Args.size(); i++)
+        for (auto S = CurScope; S->Parent; S = S->Parent)
         {
-            // If variable, get value
-            auto tmp_V = eval_expression(Caller->Args[i]);
-            if (isVariable(tmp_V)) tmp_V = get_variable_value(tmp_V);
-            CurScope->set(get_name(Func->Proto->Args[i]), tmp_V);
+            auto V = S->get(Name);
+            if (!V)
+                continue;
+            auto Cell = isCell(V) ? ptr_to<CellExprAST>(V) : GC::make_traced<CellExprAST>(V);
+            S->set(Name, Cell);
+            C->Upvalues.push_back({ Name, Cell });
+            break;
         }
+    }
+    return C;
+}
+/* ++ Closure ++ */
+
+std::shared_ptr<ExprAST> EvalImpl::call_function(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+#ifdef elog
+    log("in call_function");
+#endif
+    if (Closure->Func->IsAsync)
+        return call_async_function(Closure, Args);
+
+    // Tables are not shared between threads, workers skip them
+    if (!Closure->Memo || Worker)
+        return eval_function_body(Closure, Args);
+    return call_memoized(Closure, Args);
+}
+
+// Only calls with number or string arguments are cached. The results go
+// when a function the body calls is bound to another, and so does the
+// table if that leaves the function impure.
+std::shared_ptr<ExprAST> EvalImpl::call_memoized(const std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!is_pure(*Closure))
+    {
+        Closure->Memo.reset();
+        return eval_function_body(Closure, Args);
+    }
+    Closure->Memo->renew(Closure->Func->PurityVersion);
+
+    std::string Key;
+    if (!Memo::TableImpl::make_key(Args, Key))
+    {
+        Closure->Memo->bypass();
+        return eval_function_body(Closure, Args);
+    }
+    if (auto R = Closure->Memo->find(Key))
+        return R;
+    auto R = eval_function_body(Closure, Args);
+    if (Memo::TableImpl::is_cacheable(R))
+        Closure->Memo->insert(Key, R);
+    else
+        Closure->Memo->bypass();
+    return R;
+}
+
+// Under TINYJS_PERF the body runs from the trampoline of its function, perf
+// sees the script function in the call chain
+std::shared_ptr<ExprAST> EvalImpl::eval_function_body(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+#ifdef elog
+    log("in eval_function_body");
+#endif
+    if (!PerfEntries)
+        return run_function_body(Closure, Args);
+    return run_perf_entry(Closure, Args);
+}
+
+std::shared_ptr<ExprAST> EvalImpl::run_perf_entry(std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto& Func = *Closure->Func;
+    auto Entry = reinterpret_cast<Perf::Entry>(Func.PerfEntry.load(std::memory_order_acquire));
+    if (!Entry)
+    {
+        // Two threads may both make one, either names the function
+        Entry = Perf::make_entry(Func.Proto->Name, Func.File, Func.Line);
+        if (!Entry)
+            return run_function_body(Closure, Args);
+        Func.PerfEntry.store(reinterpret_cast<void*>(Entry), std::memory_order_release);
+    }
+    struct Call
+    {
+        EvalImpl* Eval;
+        std::shared_ptr<ClosureValueExprAST>& Closure;
+        const std::vector<std::shared_ptr<ExprAST>>& Args;
+        std::shared_ptr<ExprAST> Result;
+    } C{ this, Closure, Args, nullptr };
+    Entry(&C, [](void* P) {
+        auto C = static_cast<Call*>(P);
+        C->Result = C->Eval->run_function_body(C->Closure, C->Args);
+    });
+    return C.Result;
+}
+
+// Name of a parameter, 'x' or 'x = default'. It lives as long as the function.
+static const std::string& param_name(const std::shared_ptr<ExprAST>& P)
+{
+    auto E = P.get();
+    if (E->SubType == Type::binary_op_expr)
+        E = static_cast<BinaryOpExprAST*>(E)->LHS.get();
+    return static_cast<VariableExprAST*>(E)->Name;
+}
+
+// The frame is set up and left out of line, the body runs on a small one
+std::shared_ptr<ExprAST> EvalImpl::run_function_body(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto& Func = *Closure->Func;
+
+    // Numbers only: on raw values, no scope. Workers use what is compiled.
+    if (NumericKernels)
+        if (auto K = Numeric::kernel_for(Func, Args, !Worker))
+            if (auto R = K->call(Args))
+                return R;
+
+    if (Loop::stack_left() < StackReserve)
+        eval_err("[call_function] RangeError: Maximum call stack size exceeded.");
 
-        for (int i = Caller->Args.size(); i < Func->Proto->Args.size(); i++)
-            eval_expression(Func->Proto->Args[i]);
+    auto CallerScope = CurScope;
+    auto Frame = enter_function(Closure, Args);
+    auto ret = eval_block(Func.Body->Statement);
+    return leave_function(ret, CallerScope, Frame);
+}
+
+// Creat new function environment, the body sees its upvalues and the
+// globals it was made with, not the scope of the caller
+std::shared_ptr<EvalImpl::EnvImpl> EvalImpl::enter_function(const std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto Frame = new_scope(globals_of(Closure));
+    CurScope = Frame;
+    for (auto& U : Closure->Upvalues)
+        Frame->bind(U.first, U.second);
+    // The name of a function value hides an outer one, a parameter hides it
+    if (Closure->SelfNamed)
+        Frame->bind(Closure->Func->Proto->Name, Closure);
+
+    // Set parameters by position, a missing one takes its default value if any
+    auto& Params = Closure->Func->Proto->Args;
+    for (size_t i = 0; i < Params.size(); i++)
+    {
+        if (i < Args.size())
+            Frame->bind(param_name(Params[i]), Args[i]);
+        else if (isBinaryOp(Params[i]))
+            Frame->bind(param_name(Params[i]), eval_rvalue(ptr_to<BinaryOpExprAST>(Params[i])->RHS));
     }
 
-    // Execute function body
-    auto ret = eval_block(Func->Body->Statement);
-    switch (ret->SubType)
+    // Local functions get their cells before the body runs, a function
+    // captures the ones declared after it and sees them once they are made
+    for (auto& F : Closure->Func->Hoisted)
+        if (!Frame->get(F->Proto->Name))
+            Frame->bind(F->Proto->Name, GC::make_traced<CellExprAST>(nullptr));
+    return Frame;
+}
+
+// What the body ended with to the result of the call, back to the caller's scope
+std::shared_ptr<ExprAST> EvalImpl::leave_function(std::shared_ptr<ExprAST> Ret, std::shared_ptr<EnvImpl>& CallerScope, std::shared_ptr<EnvImpl>& Frame)
+{
+    switch (Ret->SubType)
     {
         case Type::return_expr:
         {
-            auto R = eval_return(ptr_to<ReturnExprAST>(ret));
-            if (isVariable(R) || isFunction(R))
+            auto R = eval_return(ptr_to<ReturnExprAST>(Ret));
+            if (isVariable(R))
                 R = find_name(get_name(R));
-            recover_prev_env(); // Exit curr environment
+            CurScope = CallerScope; // Exit curr environment
+            release_scope(Frame);
             return R;
         }
         case Type::break_expr:
@@ -257,8 +944,9 @@ std::shared_ptr<ExprAST> EvalImpl::eval_call_expr(std::shared_ptr<CallExprAST> C
             break;
     }
 
-    recover_prev_env(); // Exit curr environment
-    return ret;
+    CurScope = CallerScope; // Exit curr environment
+    release_scope(Frame);
+    return Ret;
 }
 
 std::shared_ptr<ExprAST> EvalImpl::eval_unary_op_expr(std::shared_ptr<UnaryOpExprAST> expr)
@@ -266,8 +954,15 @@ std::shared_ptr<ExprAST> EvalImpl::eval_unary_op_expr(std::shared_ptr<UnaryOpExp
 #ifdef elog
     log("in eval_unary_op_expr");
 #endif
-    auto Op = expr->Op;
-    auto E = eval_one(expr->Expression);
+    if (expr->Code || compile_root(expr))
+        return expr->Code->Run(*this);
+
+    // - - !x ... applies from the innermost operator out, in a loop
+    std::vector<UnaryOpExprAST*> Chain{expr.get()};
+    while (isUnaryOp(Chain.back()->Expression))
+        Chain.push_back(static_cast<UnaryOpExprAST*>(Chain.back()->Expression.get()));
+
+    auto E = eval_one(Chain.back()->Expression);
     auto _v = E;
     if (isVariable(E))
     {
@@ -279,13 +974,16 @@ std::shared_ptr<ExprAST> EvalImpl::eval_unary_op_expr(std::shared_ptr<UnaryOpExp
         }
     }
 
-    if (Op == "-") return _mul(_v, std::make_shared<IntegerValueExprAST>(-1));
-    if (Op == "+") return _mul(_v, std::make_shared<IntegerValueExprAST>(1));
-    if (Op == "~") return _bit_not(_v);
-    if (Op == "!") return _not(_v);
-
-    eval_err("Uncaught SyntaxError: Unexpected token "+ Op);
-    return nullptr;
+    for (auto U = Chain.rbegin(); U != Chain.rend(); U++)
+    {
+        auto& Op = (*U)->Op;
+        if (Op == "-")      _v = _mul(_v, GC::make_value<IntegerValueExprAST>(-1));
+        else if (Op == "+") _v = _mul(_v, GC::make_value<IntegerValueExprAST>(1));
+        else if (Op == "~") _v = _bit_not(_v);
+        else if (Op == "!") _v = _not(_v);
+        else eval_err("Uncaught SyntaxError: Unexpected token "+ Op);
+    }
+    return _v;
 }
 
 std::shared_ptr<ExprAST> EvalImpl::eval_binary_op_expr(std::shared_ptr<BinaryOpExprAST> expr)
@@ -293,15 +991,270 @@ std::shared_ptr<ExprAST> EvalImpl::eval_binary_op_expr(std::shared_ptr<BinaryOpE
 #ifdef elog
     log("in eval_binary_op_expr");
 #endif
-    auto LHS = eval_expression(expr->LHS);
-    auto RHS = eval_expression(expr->RHS);
+    if (expr->Code || compile_root(expr))
+        return expr->Code->Run(*this);
+    return eval_binary_chain(expr);
+}
 
-    // null => 0
-    if (!LHS) LHS = std::make_shared<IntegerValueExprAST>(0);
-    if (!RHS) RHS = std::make_shared<IntegerValueExprAST>(0);
-    return eval_bin_op_expr_helper(expr->Op, LHS, RHS);
+std::shared_ptr<ExprAST> EvalImpl::eval_binary_chain(const std::shared_ptr<BinaryOpExprAST>& expr)
+{
+    // a[i] = value
+    if (expr->Op == "=" && isIndex(expr->LHS))
+        return eval_index_assign(ptr_to<IndexExprAST>(expr->LHS), expr->RHS);
+    // o.name = value
+    if (expr->Op == "=" && isMember(expr->LHS))
+        return eval_member_assign(ptr_to<MemberExprAST>(expr->LHS), expr->RHS);
+
+    // a + b + c ... parses as ((a + b) + c) ..., the left operands are
+    // walked down and folded back up in a loop instead of one call each.
+    // The left end (or an element assignment in the chain) is evaluated
+    // as usual.
+    std::vector<BinaryOpExprAST*> Chain{ expr.get() };
+    auto Left = expr->LHS;
+    while (isBinaryOp(Left))
+    {
+        auto B = static_cast<BinaryOpExprAST*>(Left.get());
+        if (B->Op == "=" && (isIndex(B->LHS) || isMember(B->LHS)))
+            break;
+        Chain.push_back(B);
+        Left = B->LHS;
+    }
+
+    auto LHS = eval_expression(Left);
+    for (auto B = Chain.rbegin(); B != Chain.rend(); B++)
+    {
+        auto RHS = eval_expression((*B)->RHS);
+        // null => 0
+        if (!LHS) LHS = GC::make_value<IntegerValueExprAST>(0);
+        if (!RHS) RHS = GC::make_value<IntegerValueExprAST>(0);
+        LHS = eval_bin_op_expr_helper((*B)->Op, LHS, RHS);
+    }
+    return LHS;
 }
 
+std::shared_ptr<ExprAST> EvalImpl::eval_array_expr(std::shared_ptr<ArrayExprAST> Array)
+{
+#ifdef elog
+    log("in eval_array_expr");
+#endif
+    auto Arr = GC::make_traced<ArrayValueExprAST>();
+    Arr->reserve(Array->Elements.size());
+    for (auto& E : Array->Elements)
+        Arr->push(eval_rvalue(E));
+    return Arr;
+}
+
+std::shared_ptr<ExprAST> EvalImpl::eval_object_expr(std::shared_ptr<ObjectExprAST> Object)
+{
+#ifdef elog
+    log("in eval_object_expr");
+#endif
+    auto Obj = GC::make_traced<ObjectValueExprAST>();
+    for (auto& P : Object->Props)
+        Obj->set(P.first, eval_rvalue(P.second));
+    return Obj;
+}
+
+// Length of an array or typed array
+size_t EvalImpl::get_length(std::shared_ptr<ExprAST> Arr)
+{
+    if (isArray(Arr))
+        return ptr_to<ArrayValueExprAST>(Arr)->size();
+    return ptr_to<TypedArrayValueExprAST>(Arr)->Length;
+}
+
+// Check Index is an integer in [0, Limit)
+size_t EvalImpl::get_array_index(std::shared_ptr<ExprAST> Arr, std::shared_ptr<ExprAST> Index, size_t Limit)
+{
+    if (!isInt(Index))
+        eval_err("[get_array_index] TypeError: array index must be an integer, got " + Index->get_ast_name() + ".");
+    auto i = get_value<IntegerValueExprAST>(Index);
+    if (i < 0 || (size_t)i >= Limit)
+    {
+        ERR_INFO = "[get_array_index] RangeError: index " + std::to_string(i) + " out of range, length is " + std::to_string(get_length(Arr)) + ".";
+        eval_err(ERR_INFO);
+    }
+    return i;
+}
+
+std::shared_ptr<ExprAST> EvalImpl::eval_index_expr(std::shared_ptr<IndexExprAST> Index)
+{
+#ifdef elog
+    log("in eval_index_expr");
+#endif
+    auto Object = eval_rvalue(Index->Object);
+    auto Idx = eval_rvalue(Index->Index);
+
+    if (isArray(Object))
+    {
+        auto Arr = ptr_to<ArrayValueExprAST>(Object);
+        return Arr->get(get_array_index(Arr, Idx, Arr->size()));
+    }
+
+    if (isTypedArray(Object))
+    {
+        auto Arr = ptr_to<TypedArrayValueExprAST>(Object);
+        return Arr->get(get_array_index(Arr, Idx, Arr->Length));
+    }
+
+    // o["key"], a missing key reads as null
+    if (isObject(Object))
+    {
+        if (!isString(Idx))
+            eval_err("[eval_index_expr] TypeError: object key must be a string, got " + Idx->get_ast_name() + ".");
+        auto V = ptr_to<ObjectValueExprAST>(Object)->get(get_value<StringValueExprAST>(Idx));
+        return V ? V : null_value();
+    }
+
+    if (isString(Object))
+    {
+        auto& Str = ptr_to<StringValueExprAST>(Object)->Val;
+        if (!isInt(Idx) || get_value<IntegerValueExprAST>(Idx) < 0 || (size_t)get_value<IntegerValueExprAST>(Idx) >= Str.length())
+            eval_err("[eval_index_expr] RangeError: string index out of range.");
+        return GC::make_value<StringValueExprAST>(Str.substr(get_value<IntegerValueExprAST>(Idx), 1));
+    }
+
+    eval_err("[eval_index_expr] TypeError: " + Object->get_ast_name() + " is not indexable.");
+    return nullptr;
+}
+
+std::shared_ptr<ExprAST> EvalImpl::eval_index_assign(std::shared_ptr<IndexExprAST> Index, std::shared_ptr<ExprAST> RHS)
+{
+#ifdef elog
+    log("in eval_index_assign");
+#endif
+    auto Object = eval_rvalue(Index->Object);
+    auto Idx = eval_rvalue(Index->Index);
+    auto Value = eval_rvalue(RHS);
+
+    if (isTypedArray(Object))
+    {
+        if (!isInt(Value) && !isFloat(Value))
+            eval_err("[eval_index_assign] TypeError: typed array element must be a number, got " + Value->get_ast_name() + ".");
+        auto Arr = ptr_to<TypedArrayValueExprAST>(Object);
+        if (Arr->ReadOnly)
+            eval_err("[eval_index_assign] TypeError: " + Arr->kind_name() + " is a read only view.");
+        Arr->set(get_array_index(Arr, Idx, Arr->Length), Value);
+        return Value;
+    }
+
+    if (isObject(Object))
+    {
+        if (!isString(Idx))
+            eval_err("[eval_index_assign] TypeError: object key must be a string, got " + Idx->get_ast_name() + ".");
+        ptr_to<ObjectValueExprAST>(Object)->set(get_value<StringValueExprAST>(Idx), Value);
+        return Value;
+    }
+
+    if (!isArray(Object))
+        eval_err("[eval_index_assign] TypeError: cannot assign to an index of " + Object->get_ast_name() + ".");
+
+    // a[a.length] = v appends
+    auto Arr = ptr_to<ArrayValueExprAST>(Object);
+    Arr->set(get_array_index(Arr, Idx, Arr->size() + 1), Value);
+    return Value;
+}
+
+std::shared_ptr<ExprAST> EvalImpl::eval_member_expr(std::shared_ptr<MemberExprAST> Member)
+{
+#ifdef elog
+    log("in eval_member_expr");
+#endif
+    auto Object = eval_rvalue(Member->Object);
+    // A missing property reads as null
+    if (isObject(Object))
+    {
+        auto V = ptr_to<ObjectValueExprAST>(Object)->get(Member->Name);
+        return V ? V : null_value();
+    }
+    if (Member->Name == "length")
+    {
+        if (isArray(Object) || isTypedArray(Object))
+            return GC::make_value<IntegerValueExprAST>(get_length(Object));
+        if (isString(Object))
+            return GC::make_value<IntegerValueExprAST>(get_value<StringValueExprAST>(Object).length());
+    }
+
+    eval_err("[eval_member_expr] TypeError: " + Object->get_ast_name() + " has no property '" + Member->Name + "'.");
+    return nullptr;
+}
+
+std::shared_ptr<ExprAST> EvalImpl::eval_member_assign(std::shared_ptr<MemberExprAST> Member, std::shared_ptr<ExprAST> RHS)
+{
+#ifdef elog
+    log("in eval_member_assign");
+#endif
+    auto Object = eval_rvalue(Member->Object);
+    auto Value = eval_rvalue(RHS);
+    if (!isObject(Object))
+        eval_err("[eval_member_assign] TypeError: cannot set property '" + Member->Name + "' of " + Object->get_ast_name() + ".");
+    ptr_to<ObjectValueExprAST>(Object)->set(Member->Name, Value);
+    return Value;
+}
+
+std::shared_ptr<ExprAST> EvalImpl::eval_method_call_expr(std::shared_ptr<MethodCallExprAST> Method)
+{
+#ifdef elog
+    log("in eval_method_call_expr");
+#endif
+    // JSON.parse(...): a built in namespace, unless the script binds the name
+    if (isVariable(Method->Object))
+    {
+        auto Name = get_name(Method->Object);
+        if (!find_name(Name))
+            if (auto Native = get_native(Name + "." + Method->Name))
+            {
+                auto R = call_native(Native, Name + "." + Method->Name, Method->Args);
+                return R ? R : Method;
+            }
+    }
+
+    auto Object = eval_rvalue(Method->Object);
+    if (isArray(Object))
+    {
+        auto Arr = ptr_to<ArrayValueExprAST>(Object);
+        // a.push(v, ...) => new length
+        if (Method->Name == "push")
+        {
+            for (auto& E : Method->Args)
+                Arr->push(eval_rvalue(E));
+            return GC::make_value<IntegerValueExprAST>(Arr->size());
+        }
+        // a.pop() => last element
+        if (Method->Name == "pop")
+        {
+            if (!Arr->size())
+                eval_err("[eval_method_call_expr] RangeError: pop from empty array.");
+            return Arr->pop();
+        }
+    }
+
+    // re.test(s), s.match(re), s.replace(re, r): the built in with the object first
+    if ((isRegex(Object) && Method->Name == "test") ||
+        (isString(Object) && (Method->Name == "match" || Method->Name == "replace")))
+    {
+        std::vector<std::shared_ptr<ExprAST>> Args{ Object };
+        Args.insert(Args.end(), Method->Args.begin(), Method->Args.end());
+        return call_native(get_native(Method->Name), Method->Name, Args);
+    }
+
+    // p.then(f) => promise of f(result)
+    if (isPromise(Object) && Method->Name == "then")
+    {
+        if (Method->Args.size() != 1)
+            eval_err("[eval_method_call_expr] TypeError: then expects 1 argument.");
+        return promise_then(ptr_to<PromiseValueExprAST>(Object), eval_rvalue(Method->Args[0]));
+    }
+
+    // o.f(x): a function kept in an object, a module namespace for one
+    if (isObject(Object))
+        if (auto F = ptr_to<ObjectValueExprAST>(Object)->get(Method->Name))
+            if (isClosure(F))
+                return call_function(ptr_to<ClosureValueExprAST>(F), eval_arguments(Method->Args));
+
+    eval_err("[eval_method_call_expr] TypeError: " + Object->get_ast_name() + "." + Method->Name + " is not a function.");
+    return nullptr;
+}
 
 // Calculation of evaluation
 std::shared_ptr<ExprAST> EvalImpl::eval_bin_op_expr_helper(const std::string& Op, std::shared_ptr<ExprAST> LHS, std::shared_ptr<ExprAST> RHS)
@@ -379,6 +1332,7 @@ std::shared_ptr<ExprAST> EvalImpl::eval_bin_op_expr_helper(const std::string& Op
     else if (Op == ">=") return _not_less(lvalue, rvalue);
     else if (Op == "<=") return _not_more(lvalue, rvalue);
     else if (Op == "==") return _equal(lvalue, rvalue);
+    else if (Op == "!=") return _not_equal(lvalue, rvalue);
     else if (Op == "&&") return _and(lvalue, rvalue);
     else if (Op == "||") return _or(lvalue, rvalue);
     else if (Op == ">>") return _bit_rshift(lvalue, rvalue);
@@ -400,32 +1354,32 @@ std::shared_ptr<ExprAST> EvalImpl::_add(const std::shared_ptr<ExprAST> LHS, cons
     /* Number */
     // 1+1=2
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) + get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) + get_value<IntegerValueExprAST>(RHS));
     // 1+1.0=2.0
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) + get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) + get_value<FloatValueExprAST>(RHS));
     // 1.0+1=2.0
     if (isFloat(LHS) && isInt(RHS)) 
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) + get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) + get_value<IntegerValueExprAST>(RHS));
     // 1.0+1.0=2.0
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) + get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) + get_value<FloatValueExprAST>(RHS));
     /* String */
     // "1"+"1"="11"
     if (isString(LHS) && isString(RHS))
-        return std::make_shared<StringValueExprAST>(get_value<StringValueExprAST>(LHS) + get_value<StringValueExprAST>(RHS));
+        return GC::make_value<StringValueExprAST>(get_value<StringValueExprAST>(LHS) + get_value<StringValueExprAST>(RHS));
     // 1+"1"="11"
     if (isInt(LHS) && isString(RHS))
-        return std::make_shared<StringValueExprAST>(std::to_string(get_value<IntegerValueExprAST>(LHS)) + get_value<StringValueExprAST>(RHS));
+        return GC::make_value<StringValueExprAST>(std::to_string(get_value<IntegerValueExprAST>(LHS)) + get_value<StringValueExprAST>(RHS));
     // "1"+1="11"
     if (isString(LHS) && isInt(RHS))
-        return std::make_shared<StringValueExprAST>(get_value<StringValueExprAST>(LHS) + std::to_string(get_value<IntegerValueExprAST>(RHS)));
+        return GC::make_value<StringValueExprAST>(get_value<StringValueExprAST>(LHS) + std::to_string(get_value<IntegerValueExprAST>(RHS)));
     // 1.0+"1"="1.01"
     if (isFloat(LHS) && isString(RHS))
-        return std::make_shared<StringValueExprAST>(std::to_string(get_value<FloatValueExprAST>(LHS)) + get_value<StringValueExprAST>(RHS));
+        return GC::make_value<StringValueExprAST>(std::to_string(get_value<FloatValueExprAST>(LHS)) + get_value<StringValueExprAST>(RHS));
     // "1"+1.1="11.1"
     if (isString(LHS) && isFloat(RHS))
-        return std::make_shared<StringValueExprAST>(get_value<StringValueExprAST>(LHS) + std::to_string(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<StringValueExprAST>(get_value<StringValueExprAST>(LHS) + std::to_string(get_value<FloatValueExprAST>(RHS)));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_add] Invalid '+' expression.");
@@ -436,16 +1390,16 @@ std::shared_ptr<ExprAST> EvalImpl::_sub(const std::shared_ptr<ExprAST> LHS, cons
 {
     // 1-1=0
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) - get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) - get_value<IntegerValueExprAST>(RHS));
     // 1-1.0=0.0
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) - get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) - get_value<FloatValueExprAST>(RHS));
     // 1.0-1=0.0
     if (isFloat(LHS) && isInt(RHS)) 
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) - get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) - get_value<IntegerValueExprAST>(RHS));
     // 1.0-1.0=0.0
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) - get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) - get_value<FloatValueExprAST>(RHS));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_sub] Invalid '-' expression.");
@@ -456,16 +1410,16 @@ std::shared_ptr<ExprAST> EvalImpl::_mul(const std::shared_ptr<ExprAST> LHS, cons
 {
     // 1*1=1
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) * get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) * get_value<IntegerValueExprAST>(RHS));
     // 1*1.0=1.0
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) * get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) * get_value<FloatValueExprAST>(RHS));
     // 1.0*1=1.0
     if (isFloat(LHS) && isInt(RHS)) 
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) * get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) * get_value<IntegerValueExprAST>(RHS));
     // 1.0*1.0=1.0
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) * get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) * get_value<FloatValueExprAST>(RHS));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_mul] Invalid '*' expression.");
@@ -474,18 +1428,23 @@ std::shared_ptr<ExprAST> EvalImpl::_mul(const std::shared_ptr<ExprAST> LHS, cons
 
 std::shared_ptr<ExprAST> EvalImpl::_div(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
-    // 1/1=1
+    // 1/1=1, 1/0 as 1/0.0
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) / get_value<IntegerValueExprAST>(RHS));
+    {
+        auto L = get_value<IntegerValueExprAST>(LHS), R = get_value<IntegerValueExprAST>(RHS);
+        if (R == 0)
+            return GC::make_value<FloatValueExprAST>(L / 0.0);
+        return GC::make_value<IntegerValueExprAST>(Numeric::divide(L, R));
+    }
     // 1/1.0=1.0
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) / get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<IntegerValueExprAST>(LHS) / get_value<FloatValueExprAST>(RHS));
     // 1.0/1=1.0
     if (isFloat(LHS) && isInt(RHS)) 
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) / get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) / get_value<IntegerValueExprAST>(RHS));
     // 1.0/1.0=1.0
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) / get_value<FloatValueExprAST>(RHS));
+        return GC::make_value<FloatValueExprAST>(get_value<FloatValueExprAST>(LHS) / get_value<FloatValueExprAST>(RHS));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_div] Invalid '/' expression.");
@@ -494,18 +1453,23 @@ std::shared_ptr<ExprAST> EvalImpl::_div(const std::shared_ptr<ExprAST> LHS, cons
 
 std::shared_ptr<ExprAST> EvalImpl::_mod(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
-    // 1%1=0
+    // 1%1=0, 1%0 as 1%0.0
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) % get_value<IntegerValueExprAST>(RHS));
+    {
+        auto L = get_value<IntegerValueExprAST>(LHS), R = get_value<IntegerValueExprAST>(RHS);
+        if (R == 0)
+            return GC::make_value<FloatValueExprAST>(fmod(L, 0.0));
+        return GC::make_value<IntegerValueExprAST>(Numeric::modulo(L, R));
+    }
     // 1%1.0=0.0
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(fmod(get_value<IntegerValueExprAST>(LHS), get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<FloatValueExprAST>(fmod(get_value<IntegerValueExprAST>(LHS), get_value<FloatValueExprAST>(RHS)));
     // 1.0%1=0.0
     if (isFloat(LHS) && isInt(RHS)) 
-        return std::make_shared<FloatValueExprAST>(fmod(get_value<FloatValueExprAST>(LHS), get_value<IntegerValueExprAST>(RHS)));
+        return GC::make_value<FloatValueExprAST>(fmod(get_value<FloatValueExprAST>(LHS), get_value<IntegerValueExprAST>(RHS)));
     // 1.0%1.0=0.0
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<FloatValueExprAST>(fmod(get_value<FloatValueExprAST>(LHS), get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<FloatValueExprAST>(fmod(get_value<FloatValueExprAST>(LHS), get_value<FloatValueExprAST>(RHS)));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_mod] Invalid \'%\' expression.");
@@ -513,25 +1477,25 @@ std::shared_ptr<ExprAST> EvalImpl::_mod(const std::shared_ptr<ExprAST> LHS, cons
 }
 
 /* '!' */
-inline std::shared_ptr<ExprAST> EvalImpl::_not(const std::shared_ptr<ExprAST> RHS)
+std::shared_ptr<ExprAST> EvalImpl::_not(const std::shared_ptr<ExprAST> RHS)
 {
-    return std::make_shared<IntegerValueExprAST>(!value_to_bool(RHS));
+    return GC::make_value<IntegerValueExprAST>(!value_to_bool(RHS));
 }
 
 /* >  <  >=  <=  == */
 std::shared_ptr<ExprAST> EvalImpl::_greater(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) > get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) > get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) > get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) > get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) > get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) > get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) > get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) > get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_greater] Invalid '>' expression.");
@@ -544,16 +1508,16 @@ std::shared_ptr<ExprAST> EvalImpl::_less(const std::shared_ptr<ExprAST> LHS, con
     log("in _less");
 #endif
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) < get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) < get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) < get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) < get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) < get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) < get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) < get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) < get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_less] Invalid '<' expression.");
@@ -563,16 +1527,16 @@ std::shared_ptr<ExprAST> EvalImpl::_less(const std::shared_ptr<ExprAST> LHS, con
 std::shared_ptr<ExprAST> EvalImpl::_not_more(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) <= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) <= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) <= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) <= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) <= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) <= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) <= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) <= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_not_more] Invalid '<=' expression.");
@@ -582,16 +1546,16 @@ std::shared_ptr<ExprAST> EvalImpl::_not_more(const std::shared_ptr<ExprAST> LHS,
 std::shared_ptr<ExprAST> EvalImpl::_not_less(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) >= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) >= get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) >= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) >= get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_not_less] Invalid '>=' expression.");
@@ -601,36 +1565,51 @@ std::shared_ptr<ExprAST> EvalImpl::_not_less(const std::shared_ptr<ExprAST> LHS,
 std::shared_ptr<ExprAST> EvalImpl::_equal(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) == get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) == get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) == get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) == get_value<IntegerValueExprAST>(RHS) ? 1 : 0);
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) == get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) == get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) == get_value<FloatValueExprAST>(RHS) ? 1 : 0);
+        return GC::make_value<IntegerValueExprAST>(get_value<FloatValueExprAST>(LHS) == get_value<FloatValueExprAST>(RHS) ? 1 : 0);
 
     if (isString(LHS) && isString(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<StringValueExprAST>(LHS) == get_value<StringValueExprAST>(RHS) ? 1 : 0); 
+        return GC::make_value<IntegerValueExprAST>(get_value<StringValueExprAST>(LHS) == get_value<StringValueExprAST>(RHS) ? 1 : 0); 
+
+    // Array and function compare by reference
+    if ((isArray(LHS) || isTypedArray(LHS)) && (isArray(RHS) || isTypedArray(RHS)))
+        return GC::make_value<IntegerValueExprAST>(LHS == RHS ? 1 : 0);
+    if (isClosure(LHS) || isClosure(RHS))
+        return GC::make_value<IntegerValueExprAST>(LHS == RHS ? 1 : 0);
+    // Object and regex by reference, null only equals null
+    if (isObject(LHS) || isObject(RHS) || isNull(LHS) || isNull(RHS) || isRegex(LHS) || isRegex(RHS))
+        return GC::make_value<IntegerValueExprAST>(LHS == RHS ? 1 : 0);
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_equal] Invalid '==' expression.");
     return nullptr;
 }
 
+std::shared_ptr<ExprAST> EvalImpl::_not_equal(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
+{
+    auto Eq = _equal(LHS, RHS);
+    return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(Eq) ? 0 : 1);
+}
+
 
 
 /* & | << >> ^ ~ */
-inline std::shared_ptr<ExprAST> EvalImpl::_and(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
+std::shared_ptr<ExprAST> EvalImpl::_and(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (value_to_bool(LHS))
         return RHS;
     return LHS;
 }
 
-inline std::shared_ptr<ExprAST> EvalImpl::_or(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
+std::shared_ptr<ExprAST> EvalImpl::_or(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (value_to_bool(LHS))
         return LHS;
@@ -640,16 +1619,16 @@ inline std::shared_ptr<ExprAST> EvalImpl::_or(const std::shared_ptr<ExprAST> LHS
 std::shared_ptr<ExprAST> EvalImpl::_bit_rshift(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >> get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >> get_value<IntegerValueExprAST>(RHS));
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) >> get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) >> get_value<IntegerValueExprAST>(RHS));
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >> (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) >> (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) >> (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) >> (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_bit_rshift] Invalid '>>' expression.");
@@ -659,16 +1638,16 @@ std::shared_ptr<ExprAST> EvalImpl::_bit_rshift(const std::shared_ptr<ExprAST> LH
 std::shared_ptr<ExprAST> EvalImpl::_bit_lshift(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) << get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) << get_value<IntegerValueExprAST>(RHS));
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) << get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) << get_value<IntegerValueExprAST>(RHS));
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) << (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) << (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) << (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) << (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_bit_lshift] Invalid '<<' expression.");
@@ -678,16 +1657,16 @@ std::shared_ptr<ExprAST> EvalImpl::_bit_lshift(const std::shared_ptr<ExprAST> LH
 std::shared_ptr<ExprAST> EvalImpl::_bit_and(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) & get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) & get_value<IntegerValueExprAST>(RHS));
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) & get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) & get_value<IntegerValueExprAST>(RHS));
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) & (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) & (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) & (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) & (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_bit_and] Invalid '&' expression.");
@@ -697,16 +1676,16 @@ std::shared_ptr<ExprAST> EvalImpl::_bit_and(const std::shared_ptr<ExprAST> LHS,
 std::shared_ptr<ExprAST> EvalImpl::_bit_or(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) | get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) | get_value<IntegerValueExprAST>(RHS));
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) | get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) | get_value<IntegerValueExprAST>(RHS));
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) | (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) | (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) | (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) | (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_bit_or] Invalid '|' expression.");
@@ -716,16 +1695,16 @@ std::shared_ptr<ExprAST> EvalImpl::_bit_or(const std::shared_ptr<ExprAST> LHS, c
 std::shared_ptr<ExprAST> EvalImpl::_bit_xor(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) ^ get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) ^ get_value<IntegerValueExprAST>(RHS));
 
     if (isFloat(LHS) && isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) ^ get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>((IntType)(get_value<FloatValueExprAST>(LHS)) ^ get_value<IntegerValueExprAST>(RHS));
 
     if (isInt(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) ^ (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>(get_value<IntegerValueExprAST>(LHS) ^ (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     if (isFloat(LHS) && isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) ^ (IntType)(get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>((IntType)get_value<FloatValueExprAST>(LHS) ^ (IntType)(get_value<FloatValueExprAST>(RHS)));
 
     LHS->print_ast(); RHS->print_ast();
     eval_err("[_bit_xor] Invalid '^' expression.");
@@ -736,10 +1715,10 @@ std::shared_ptr<ExprAST> EvalImpl::_bit_xor(const std::shared_ptr<ExprAST> LHS,
 std::shared_ptr<ExprAST> EvalImpl::_bit_not(const std::shared_ptr<ExprAST> RHS)
 {
     if (isInt(RHS))
-        return std::make_shared<IntegerValueExprAST>(~get_value<IntegerValueExprAST>(RHS));
+        return GC::make_value<IntegerValueExprAST>(~get_value<IntegerValueExprAST>(RHS));
 
     if (isFloat(RHS))
-        return std::make_shared<IntegerValueExprAST>(~((IntType)get_value<FloatValueExprAST>(RHS)));
+        return GC::make_value<IntegerValueExprAST>(~((IntType)get_value<FloatValueExprAST>(RHS)));
 
     RHS->print_ast();
     eval_err("[_bit_not] Invalid '~' expression.");
@@ -2,11 +2,23 @@
 #define TINYJS_EVAL
 
 #include <cmath>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include "env.h"
 #include "ast.h"
 #include "log.h"
 #include "built_in.h"
+#include "output.h"
+#include "loop.h"
+#include "regex.h"
+#include "module.h"
+#include "reload.h"
+#include "perf.h"
+#include "numeric.h"
+#include "inline.h"
+#include "compile.h"
 
 // #define elog
 
@@ -20,7 +32,7 @@ namespace Eval
     {
     using IntType = long long;
     using T = std::vector<std::shared_ptr<ExprAST>>;
-    using EnvImpl = EnvImpl<T::value_type>;
+    using EnvImpl = Env::EnvImpl<T::value_type>;
     
     private:
         std::shared_ptr<EnvImpl> Scope;
@@ -29,6 +41,42 @@ namespace Eval
         T Expression; // T := vector<unique_ptr<ExprAST>>
         unsigned long long EvalLineNumber;
         std::string ERR_INFO;
+        bool MemoizeAll = getenv("TINYJS_MEMOIZE") != nullptr; // memoize every pure function
+        bool PerfEntries = Perf::enabled(); // call bodies through their trampolines (perf.h)
+        bool NumericKernels = getenv("TINYJS_NO_KERNELS") == nullptr; // numeric.h
+        bool Inlining = getenv("TINYJS_NO_INLINE") == nullptr; // inline.h
+        bool Compiling = getenv("TINYJS_NO_COMPILE") == nullptr; // compile.h
+        const std::vector<std::shared_ptr<ExprAST>>* InlineArgs = nullptr; // of the inline body running
+        bool Worker = false; // runs on a thread of the pool (parallel.cpp)
+        // Compiled patterns by flags and source, a worker keeps its own
+        std::unordered_map<std::string, std::shared_ptr<Regex::MatcherImpl>> Regexes;
+        // Modules this evaluator ran, by canonical path (module.cpp)
+        struct ModuleInstance
+        {
+            std::shared_ptr<const Module::SourceImpl> Source;
+            std::shared_ptr<EnvImpl> Scope; // its top scope
+            bool Running = true;
+        };
+        std::unordered_map<std::string, ModuleInstance> Modules;
+        std::string ModuleDir = "."; // imports of the running file are found from here
+        std::unique_ptr<Reload::WatchImpl> Watch; // TINYJS_WATCH (reload.cpp)
+        // A call fails with a RangeError when less is left on the stack
+        static constexpr size_t StackReserve = 128 << 10;
+        // Released scopes kept for reuse
+        static constexpr size_t MaxPooledScopes = 64;
+        std::vector<std::shared_ptr<EnvImpl>> ScopePool;
+        // Callee slot of a call site in a top scope, by CallExprAST::Site.
+        // Holding the scope keeps the slot valid, a redefinition writes it.
+        // The function it calls and how often, with its inline body if any.
+        struct CallSite
+        {
+            std::shared_ptr<EnvImpl> Scope;
+            std::shared_ptr<ExprAST>* Slot = nullptr;
+            std::shared_ptr<FunctionAST> Func;
+            std::shared_ptr<const Inline::BodyImpl> Inlined;
+            uint32_t Calls = 0;
+        };
+        std::vector<CallSite> CallSites;
 
     public:
         EvalImpl() = delete;
@@ -42,7 +90,10 @@ namespace Eval
                 EvalLineNumber = 1;
                 ERR_INFO = "";
             }
+            resolve_built_in(this->Expression);
         }
+        // Worker of a parallel builtin, it only reads the globals of the main evaluator
+        EvalImpl(std::shared_ptr<EnvImpl> Globals) : Scope(Globals), CurScope(Globals), EvalLineNumber(1), Worker(true) { }
         ~EvalImpl() = default;
         
         EvalImpl(const EvalImpl&) = delete;
@@ -50,21 +101,46 @@ namespace Eval
         EvalImpl(EvalImpl&&) = delete;
         const EvalImpl& operator =(EvalImpl&&) = delete;
 
-        /* Attention !!! Wait for rewrite !!! */
-        std::shared_ptr<ExprAST> exec_built_in(std::shared_ptr<ExprAST> Func)
+        // Call a native function, the arguments are evaluated in the caller's scope
+        std::shared_ptr<ExprAST> exec_built_in(const NativeFunction* Native, std::shared_ptr<CallExprAST> Caller)
         {
-            auto F = ptr_to<CallExprAST>(Func);
-            auto Name = F->Callee;
-            if (Name == "print")
-            {
-                for (int i = 0; i < F->Args.size(); i++)
-                {
-                    auto arg = F->Args[i];
-                    print_value(eval_expression(arg));
-                }
-            }
-            return F;
+            auto R = call_native(Native, Caller->Callee, Caller->Args);
+            return R ? R : Caller;
+        }
+        std::shared_ptr<ExprAST> call_native(const NativeFunction* Native, const std::string& Name, const std::vector<std::shared_ptr<ExprAST>>& ArgExprs)
+        {
+            std::vector<std::shared_ptr<ExprAST>> Args;
+            Args.reserve(ArgExprs.size());
+            for (auto& A : ArgExprs)
+                Args.push_back(Native->Raw ? eval_expression(A) : eval_rvalue(A));
+            if (Args.size() < (size_t)Native->Arity)
+                eval_err("[exec_built_in] TypeError: " + Name + " expects " + std::to_string(Native->Arity) + " arguments.");
+            return Native->Fn(*this, Args);
         }
+        void resolve_built_in(const std::vector<std::shared_ptr<ExprAST>>& Statements);
+
+        /* Typed array built in (built_in.cpp) */
+        std::shared_ptr<ExprAST> builtin_typed_array(TypedKind Kind, std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_reduce(const std::string& Name, std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_dot(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_add(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_scale(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_map(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_index_of(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_count(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_text(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_keys(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::string_view to_byte_view(std::vector<std::shared_ptr<ExprAST>>& Args, size_t First, const std::string& Where);
+        std::shared_ptr<TypedArrayValueExprAST> to_typed_array(std::shared_ptr<ExprAST> V, const std::string& Where);
+        std::shared_ptr<TypedArrayValueExprAST> to_numeric_array(std::shared_ptr<ExprAST> V, const std::string& Where);
+        /* Regex built in (built_in.cpp) */
+        std::shared_ptr<Regex::MatcherImpl> get_regex(const std::string& Source, const std::string& Flags, const std::string& Where);
+        std::shared_ptr<Regex::MatcherImpl> to_regex(std::shared_ptr<ExprAST> V, const std::string& Where);
+        std::shared_ptr<ExprAST> eval_regex_expr(std::shared_ptr<RegexExprAST> Regex);
+        std::shared_ptr<ExprAST> builtin_regexp(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_test(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_match(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_replace(std::vector<std::shared_ptr<ExprAST>>& Args);
 
         /* -- Scope -- */
         std::shared_ptr<EnvImpl> get_top_scope()
@@ -75,33 +151,61 @@ namespace Eval
             return _CurScope;
         }
 
+        // Scopes of blocks and calls come from the pool and go back to it
+        // when nothing else holds them
+        std::shared_ptr<EnvImpl> new_scope(std::shared_ptr<EnvImpl> Parent, const std::string& Name = "")
+        {
+            if (ScopePool.empty())
+                return std::make_shared<EnvImpl>(Name, std::move(Parent));
+            auto S = std::move(ScopePool.back());
+            ScopePool.pop_back();
+            S->Name = Name;
+            S->Parent = std::move(Parent);
+            return S;
+        }
+        void release_scope(std::shared_ptr<EnvImpl>& S)
+        {
+            if (S.use_count() != 1 || ScopePool.size() >= MaxPooledScopes)
+                return;
+            S->reset();
+            S->Parent.reset();
+            ScopePool.push_back(std::move(S));
+        }
+
         void enter_new_env()
-        { CurScope.reset(new EnvImpl(CurScope)); }
+        { CurScope = new_scope(CurScope); }
         void enter_new_env(const std::string& Name)
-        { CurScope.reset(new EnvImpl(Name, CurScope)); }
+        { CurScope = new_scope(CurScope, Name); }
 
         void recover_prev_env()
         {
-            if (CurScope->Parent)
-                CurScope = CurScope->Parent;
+            if (!CurScope->Parent)
+                return;
+            auto Prev = std::move(CurScope);
+            CurScope = Prev->Parent;
+            release_scope(Prev);
         }
 
+        // Scopes without the bit of Name are skipped (EnvImpl::name_bit)
         std::shared_ptr<EnvImpl> find_name_belong_scope(const std::string& Name)
         {
-            auto val = CurScope->get(Name);
-            auto _CurScope = CurScope;
-            // Search for parent scope
-            while (!val && _CurScope->Parent)
-            {
-                _CurScope = _CurScope->Parent;
-                val = _CurScope->get(Name);
-            }
-            if (!val) return CurScope;
-            return _CurScope;
+            auto Bit = EnvImpl::name_bit(Name);
+            for (auto S = &CurScope; *S; S = &(*S)->Parent)
+                if ((*S)->may_have(Bit))
+                    if (auto V = (*S)->get_slot(Name); V && *V)
+                        return *S;
+            return CurScope;
         }
 
         bool is_top_scope()
         { return CurScope->Parent ? false : true; }
+
+        // Globals a closure runs with: of its module, or of the script
+        std::shared_ptr<EnvImpl> globals_of(const std::shared_ptr<ClosureValueExprAST>& C)
+        {
+            auto G = C->Globals.lock();
+            return G ? G : Scope;
+        }
         /* ++ Scope ++ */
 
         bool is_interrupt_control_flow(std::shared_ptr<ExprAST> E)
@@ -120,12 +224,29 @@ namespace Eval
         /* -- Name -- */
         // Find exist name
         // if (!find_name()) => Check name is exist?
+        // A captured variable is read through its cell.
         std::shared_ptr<ExprAST> find_name(const std::string& Name)
-        { return find_name_belong_scope(Name)->get(Name); }
+        { return find_name(Name, EnvImpl::name_bit(Name)); }
+        // Bit is EnvImpl::name_bit(Name)
+        std::shared_ptr<ExprAST> find_name(const std::string& Name, uint64_t Bit)
+        {
+            for (auto S = &CurScope; *S; S = &(*S)->Parent)
+                if ((*S)->may_have(Bit))
+                    if (auto V = (*S)->get_slot(Name); V && *V)
+                        return isCell(*V) ? ptr_to<CellExprAST>(*V)->Val : *V;
+            return nullptr;
+        }
 
-        // Set a variable or function
+        // Set a variable or function, a captured variable is written through its cell.
         void set_name(const std::string& Name, std::shared_ptr<ExprAST> Value)
-        { find_name_belong_scope(Name)->set(Name, Value); }
+        {
+            auto Scope = find_name_belong_scope(Name);
+            auto V = Scope->get(Name);
+            if (V && isCell(V))
+                ptr_to<CellExprAST>(V)->Val = Value;
+            else
+                Scope->set(Name, Value);
+        }
 
         // get name
         std::string get_name(std::shared_ptr<ExprAST> V)
@@ -140,6 +261,8 @@ namespace Eval
                     return ptr_to<CallExprAST>(V)->Callee;
                 case Type::function_expr:
                     return ptr_to<FunctionAST>(V)->Proto->Name;
+                case Type::closure_value:
+                    return ptr_to<ClosureValueExprAST>(V)->Func->Proto->Name;
                 default:
                     return "";
             }
@@ -166,6 +289,10 @@ namespace Eval
                     if (ptr_to<StringValueExprAST>(V)->Val.length())
                         return true;
                     return false;
+                case Type::array_value: case Type::typed_array_value: case Type::closure_value:
+                case Type::promise_value: case Type::file_value: case Type::object_value:
+                case Type::regex_value:
+                    return true;
                 case Type::variable_expr:
                 {
                     auto v = ptr_to<VariableExprAST>(V);
@@ -189,18 +316,127 @@ namespace Eval
         { return std::static_pointer_cast<T>(P); }
 
         /* -- Value -- */
-        void print_value(std::shared_ptr<ExprAST> V)
+        // Write an element of an array, without newline.
+        void print_element(std::shared_ptr<ExprAST> V)
         {
+            auto& Out = Output::out();
             switch (V->SubType)
             {
                 case Type::integer_expr:
-                    std::cout << get_value<IntegerValueExprAST>(V) << std::endl;
+                    Out.write_int(get_value<IntegerValueExprAST>(V));
                     break;
                 case Type::float_expr:
-                    std::cout << get_value<FloatValueExprAST>(V) << std::endl;
+                    Out.write_double(get_value<FloatValueExprAST>(V));
+                    break;
+                case Type::string_expr:
+                    Out.put('"');
+                    Out.write(get_value<StringValueExprAST>(V));
+                    Out.put('"');
+                    break;
+                case Type::array_value:
+                {
+                    auto Arr = ptr_to<ArrayValueExprAST>(V);
+                    Out.put('[');
+                    for (size_t i = 0; i < Arr->size(); i++)
+                    {
+                        if (i) Out.write(", ", 2);
+                        // Self reference
+                        if (Arr->Kind == ElementsKind::generic && Arr->Values[i] == V)
+                            Out.write("[...]");
+                        else
+                            print_element(Arr->get(i));
+                    }
+                    Out.put(']');
+                    break;
+                }
+                case Type::typed_array_value:
+                {
+                    auto Arr = ptr_to<TypedArrayValueExprAST>(V);
+                    Out.write(Arr->kind_name());
+                    Out.write(" [");
+                    for (size_t i = 0; i < Arr->Length; i++)
+                    {
+                        if (i) Out.write(", ", 2);
+                        print_element(Arr->get(i));
+                    }
+                    Out.put(']');
+                    break;
+                }
+                case Type::closure_value:
+                {
+                    auto Name = get_name(V);
+                    Out.write(Name.empty() ? "[Function (anonymous)]" : "[Function: " + Name + "]");
+                    break;
+                }
+                case Type::promise_value:
+                {
+                    auto P = ptr_to<PromiseValueExprAST>(V);
+                    Out.write("Promise { ");
+                    if (!P->settled())
+                        Out.write("<pending>");
+                    else if (P->Result)
+                        print_element(P->Result);
+                    Out.write(" }");
+                    break;
+                }
+                case Type::file_value:
+                {
+                    auto H = ptr_to<FileValueExprAST>(V)->Handle;
+                    Out.write("[File: " + H->Path + (H->is_open() ? "]" : " (closed)]"));
+                    break;
+                }
+                case Type::object_value:
+                {
+                    auto Obj = ptr_to<ObjectValueExprAST>(V);
+                    if (!Obj->size())
+                    {
+                        Out.write("{}", 2);
+                        break;
+                    }
+                    Out.write("{ ", 2);
+                    for (size_t i = 0; i < Obj->size(); i++)
+                    {
+                        if (i) Out.write(", ", 2);
+                        Out.write(Obj->Keys[i]);
+                        Out.write(": ", 2);
+                        // Self reference
+                        if (Obj->Values[i] == V)
+                            Out.write("{...}");
+                        else
+                            print_element(Obj->Values[i]);
+                    }
+                    Out.write(" }", 2);
+                    break;
+                }
+                case Type::null_value:
+                    Out.write("null", 4);
+                    break;
+                case Type::regex_value:
+                {
+                    auto Re = ptr_to<RegexValueExprAST>(V);
+                    Out.write("/" + Re->Source + "/" + Re->Flags);
+                    break;
+                }
+                default:
+                    Out.write(V->get_ast_name());
+                    break;
+            }
+        }
+
+        void print_value(std::shared_ptr<ExprAST> V)
+        {
+            auto& Out = Output::out();
+            switch (V->SubType)
+            {
+                case Type::array_value: case Type::typed_array_value: case Type::closure_value:
+                case Type::promise_value: case Type::file_value: case Type::integer_expr: case Type::float_expr:
+                case Type::object_value: case Type::null_value: case Type::regex_value:
+                    print_element(V);
+                    Out.newline();
                     break;
                 case Type::string_expr:
-                    std::cout << get_value<StringValueExprAST>(V) << std::endl;
+                    Out.write(get_value<StringValueExprAST>(V));
+                    Out.newline();
                     break;
                 case Type::variable_expr:
                 {
@@ -208,16 +444,18 @@ namespace Eval
                     auto _var = get_variable_value(_v);
                     if (!_var)
                     {
-                        std::cout << "[warnning] Variable '"<< _v->Name << "' = undefined." << std::endl;
+                        Out.write("[warnning] Variable '" + _v->Name + "' = undefined.");
+                        Out.newline();
                         return;
                     }
 
-                    std::cout << "Variable '" << _v->Name << "' = ";
+                    Out.write("Variable '" + _v->Name + "' = ");
                     print_value(_var);
                     break;
                 }
                 default:
-                    std::cout << "[print_value] ExprAST Undefined." << std::endl;
+                    Out.write("[print_value] ExprAST Undefined.");
+                    Out.newline();
                     V->print_ast();
                     break;
             }
@@ -236,30 +474,142 @@ namespace Eval
             if (!v) return nullptr;
             return v;
         }
+
+        // Evaluate E, a variable is resolved to its value.
+        std::shared_ptr<ExprAST> eval_rvalue(std::shared_ptr<ExprAST> E)
+        {
+            auto V = eval_expression(E);
+            return V && isVariable(V) ? variable_rvalue(V) : V;
+        }
+        std::shared_ptr<ExprAST> variable_rvalue(const std::shared_ptr<ExprAST>& V);
         /* ++ Value ++ */
 
         std::shared_ptr<ExprAST> eval_function_expr(std::shared_ptr<FunctionAST> F);
+        std::shared_ptr<ClosureValueExprAST> eval_function_value(std::shared_ptr<FunctionAST> F);
         std::shared_ptr<ExprAST> eval_return(std::shared_ptr<ReturnExprAST> R);
         std::shared_ptr<ExprAST> eval_if_else(std::shared_ptr<IfExprAST> If);
+        bool eval_condition(const std::shared_ptr<ExprAST>& CondExpr);
         std::shared_ptr<ExprAST> eval_for(std::shared_ptr<ForExprAST> For);
+        bool match_counting_for(std::shared_ptr<ForExprAST> For);
+        bool eval_counting_for(std::shared_ptr<ForExprAST> For, std::shared_ptr<ExprAST>& Ret);
+        std::shared_ptr<ExprAST> eval_for_of(std::shared_ptr<ForOfExprAST> ForOf);
+        std::shared_ptr<ExprAST> eval_for_of_lines(std::shared_ptr<ForOfExprAST> ForOf, std::shared_ptr<FileValueExprAST> File);
         std::shared_ptr<ExprAST> eval_while(std::shared_ptr<WhileExprAST> While);
         std::shared_ptr<ExprAST> eval_do_while(std::shared_ptr<DoWhileExprAST> DoWhile);
         std::shared_ptr<ExprAST> eval_call_expr(std::shared_ptr<CallExprAST> Caller);
+        std::shared_ptr<ExprAST> find_callee(const CallExprAST& Caller);
+        void callee_err(const CallExprAST& Caller, bool Defined);
+        const Inline::BodyImpl* inline_at(const CallExprAST& Caller, const ClosureValueExprAST& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> eval_inline(const Inline::BodyImpl& Body, const std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        /* Closure */
+        std::shared_ptr<ClosureValueExprAST> make_closure(std::shared_ptr<FunctionAST> F);
+        const std::vector<std::string>& resolve_upvalues(std::shared_ptr<FunctionAST> F);
+        std::shared_ptr<ExprAST> eval_apply_expr(std::shared_ptr<ApplyExprAST> Apply);
+        std::vector<std::shared_ptr<ExprAST>> eval_arguments(const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> call_function(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> call_memoized(const std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> eval_function_body(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> run_perf_entry(std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> run_function_body(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<EnvImpl> enter_function(const std::shared_ptr<ClosureValueExprAST>& Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> leave_function(std::shared_ptr<ExprAST> Ret, std::shared_ptr<EnvImpl>& CallerScope, std::shared_ptr<EnvImpl>& Frame);
+        /* Memoization (memo.cpp) */
+        bool is_pure(std::shared_ptr<FunctionAST> F);
+        bool is_pure(const ClosureValueExprAST& C);
+        std::shared_ptr<ExprAST> callee_of(const ClosureValueExprAST& C, const std::string& Name);
+        std::shared_ptr<ExprAST> builtin_memoize(std::vector<std::shared_ptr<ExprAST>>& Args);
+        /* Parallel (parallel.cpp) */
+        std::shared_ptr<ClosureValueExprAST> to_parallel_function(std::shared_ptr<ExprAST> V, const std::string& Where);
+        void prepare_parallel(std::shared_ptr<ClosureValueExprAST> F, std::vector<FunctionAST*>& Seen);
+        void run_parallel(size_t N, const std::function<void(EvalImpl& Worker, size_t Begin, size_t End)>& Body);
+        std::shared_ptr<ExprAST> builtin_parallel_for(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_parallel_reduce(std::vector<std::shared_ptr<ExprAST>>& Args);
+        /* Event loop (async.cpp) */
+        std::shared_ptr<ExprAST> call_async_function(std::shared_ptr<ClosureValueExprAST> Closure, const std::vector<std::shared_ptr<ExprAST>>& Args);
+        void resume_fiber(Loop::FiberImpl* F);
+        std::shared_ptr<ExprAST> eval_await_expr(std::shared_ptr<AwaitExprAST> Await);
+        void settle_promise(std::shared_ptr<PromiseValueExprAST> P, std::shared_ptr<ExprAST> V);
+        std::shared_ptr<ExprAST> promise_then(std::shared_ptr<PromiseValueExprAST> P, std::shared_ptr<ExprAST> Callback);
+        double to_milliseconds(std::shared_ptr<ExprAST> V, const std::string& Where);
+        std::shared_ptr<ExprAST> builtin_set_timer(std::vector<std::shared_ptr<ExprAST>>& Args, bool Repeat);
+        std::shared_ptr<ExprAST> builtin_clear_timer(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_sleep(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_read_file(std::vector<std::shared_ptr<ExprAST>>& Args);
+        /* File (io.cpp) */
+        std::shared_ptr<File::HandleImpl> to_open_file(std::shared_ptr<ExprAST> V, const std::string& Where);
+        std::shared_ptr<ExprAST> builtin_open(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_read_line(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_eof(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_write(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_close(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_map_file(std::vector<std::shared_ptr<ExprAST>>& Args);
+        /* JSON (io.cpp) */
+        std::shared_ptr<ExprAST> parse_json(std::string_view Text, const std::string& Where);
+        std::shared_ptr<ExprAST> builtin_json_parse(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_json_stringify(std::vector<std::shared_ptr<ExprAST>>& Args);
+        std::shared_ptr<ExprAST> builtin_json_read(std::vector<std::shared_ptr<ExprAST>>& Args);
+        /* Module (module.cpp) */
+        void prepare_module(const std::vector<std::shared_ptr<ExprAST>>& Body);
+        ModuleInstance& load_module(const std::string& Spec);
+        std::shared_ptr<ExprAST> eval_import_expr(std::shared_ptr<ImportExprAST> Import);
+        std::shared_ptr<ExprAST> eval_export_expr(std::shared_ptr<ExportExprAST> Export);
+        /* Hot reload (reload.cpp) */
+        void watch(const std::string& Path, double IntervalMs);
+        void reload();
         std::shared_ptr<ExprAST> eval_unary_op_expr(std::shared_ptr<UnaryOpExprAST> expr);
+        /* Array */
+        std::shared_ptr<ExprAST> eval_array_expr(std::shared_ptr<ArrayExprAST> Array);
+        std::shared_ptr<ExprAST> eval_index_expr(std::shared_ptr<IndexExprAST> Index);
+        std::shared_ptr<ExprAST> eval_index_assign(std::shared_ptr<IndexExprAST> Index, std::shared_ptr<ExprAST> RHS);
+        std::shared_ptr<ExprAST> eval_member_expr(std::shared_ptr<MemberExprAST> Member);
+        std::shared_ptr<ExprAST> eval_member_assign(std::shared_ptr<MemberExprAST> Member, std::shared_ptr<ExprAST> RHS);
+        std::shared_ptr<ExprAST> eval_object_expr(std::shared_ptr<ObjectExprAST> Object);
+        std::shared_ptr<ExprAST> eval_method_call_expr(std::shared_ptr<MethodCallExprAST> Method);
+        size_t get_length(std::shared_ptr<ExprAST> Arr);
+        size_t get_array_index(std::shared_ptr<ExprAST> Arr, std::shared_ptr<ExprAST> Index, size_t Limit);
+        /* Compiled expressions (compile.cpp) */
+        // Compile Root on its first evaluation, workers only run what is compiled
+        template <typename Node>
+        bool compile_root(const std::shared_ptr<Node>& Root)
+        {
+            if (!Compiling || Worker || Root->CodeTried)
+                return false;
+            Root->CodeTried = true;
+            if (auto C = compile_code(Root, false, 0))
+                Root->Code = std::make_shared<Compile::CodeImpl>(Compile::CodeImpl{ std::move(C) });
+            return Root->Code != nullptr;
+        }
+        Compile::Code compile_code(const std::shared_ptr<ExprAST>& E, bool ByEvalOne, int Depth);
+        Compile::Code compile_binary(const std::shared_ptr<BinaryOpExprAST>& B, int Depth);
+        Compile::Code compile_unary(const std::shared_ptr<UnaryOpExprAST>& U, int Depth);
+        bool compile_operand(const std::shared_ptr<ExprAST>& E, bool ByEvalOne, int Depth, Compile::Operand& O);
+        std::shared_ptr<ExprAST> run_operand(const Compile::Operand& O)
+        { return O.Const ? O.Const : O.Var ? nullptr : O.Run(*this); }
+        std::shared_ptr<ExprAST> resolve_operand(const Compile::Operand& O, std::shared_ptr<ExprAST> V, bool Unary);
         /* Binary op expr */
         std::shared_ptr<ExprAST> eval_binary_op_expr(std::shared_ptr<BinaryOpExprAST> expr);
+        std::shared_ptr<ExprAST> eval_binary_chain(const std::shared_ptr<BinaryOpExprAST>& expr);
         std::shared_ptr<ExprAST> eval_one_bin_op_expr(std::shared_ptr<ExprAST> E);
         std::shared_ptr<ExprAST> eval_bin_op_expr_helper(const std::string& Op, std::shared_ptr<ExprAST> LHS, std::shared_ptr<ExprAST> RHS);
         /* Block */
         std::shared_ptr<ExprAST> eval_block(std::vector<std::shared_ptr<ExprAST>>& Statement);
+        std::shared_ptr<ExprAST> eval_compound_expr(const std::shared_ptr<ExprAST>& E);
+        std::shared_ptr<ExprAST> eval_return_expr(const std::shared_ptr<ExprAST>& E);
 
         void eval()
         {
             for (auto& i : Expression)
             {
+                GC::heap().maybe_collect(); // safe point
                 EvalLineNumber = i->LineNumber;
                 eval_one(i);
             }
+            Loop::loop().run(); // timers, reads and async functions still pending
+            Output::out().flush();
+            if (getenv("TINYJS_GC_STATS"))
+                fprintf(stderr, "%s\n", GC::heap().stats_string().c_str());
+            if (getenv("TINYJS_MODULE_STATS"))
+                fprintf(stderr, "%s\n", Module::cache().stats_string().c_str());
         }
 
         // API (Interpreter)
@@ -275,39 +625,56 @@ namespace Eval
             return nullptr;
         }
 
+        // Every script call goes through here: it keeps a small frame, the
+        // casts live in eval_as and the kinds that are rare on a call path
+        // are evaluated out of line
         std::shared_ptr<ExprAST> eval_expression(std::shared_ptr<ExprAST> E)
         {
             switch (E->SubType)
             {
-                case Type::return_expr: case Type::break_expr: case Type::continue_expr:
+                case Type::return_expr:
+                    return eval_return_expr(E);
+                case Type::break_expr: case Type::continue_expr:
                 case Type::integer_expr: case Type::float_expr: case Type::string_expr:
-                case Type::variable_expr:
+                case Type::variable_expr: case Type::array_value: case Type::typed_array_value:
+                case Type::closure_value: case Type::promise_value: case Type::file_value:
+                case Type::object_value: case Type::null_value: case Type::regex_value:
                     return E;
+                case Type::inline_arg:
+                    return (*InlineArgs)[static_cast<InlineArgExprAST*>(E.get())->Index];
+                case Type::function_expr:
+                    return eval_as<FunctionAST, &EvalImpl::eval_function_value>(E);
                 case Type::if_else_expr:
-                    return eval_if_else(ptr_to<IfExprAST>(E));
-                case Type::for_expr:
-                    return eval_for(ptr_to<ForExprAST>(E));
-                case Type::while_expr:
-                    return eval_while(ptr_to<WhileExprAST>(E));
-                case Type::do_while_expr:
-                    return eval_do_while(ptr_to<DoWhileExprAST>(E));
+                    return eval_as<IfExprAST, &EvalImpl::eval_if_else>(E);
                 case Type::unary_op_expr:
-                    return eval_unary_op_expr(ptr_to<UnaryOpExprAST>(E));
+                    return eval_as<UnaryOpExprAST, &EvalImpl::eval_unary_op_expr>(E);
                 case Type::binary_op_expr:
-                    return eval_binary_op_expr(ptr_to<BinaryOpExprAST>(E));
+                    return eval_as<BinaryOpExprAST, &EvalImpl::eval_binary_op_expr>(E);
                 case Type::call_expr:
-                    return eval_call_expr(ptr_to<CallExprAST>(E));
+                    return eval_as<CallExprAST, &EvalImpl::eval_call_expr>(E);
+                case Type::index_expr:
+                    return eval_as<IndexExprAST, &EvalImpl::eval_index_expr>(E);
+                case Type::member_expr:
+                    return eval_as<MemberExprAST, &EvalImpl::eval_member_expr>(E);
                 default:
-                    E->print_ast();
-                    eval_err("Illegal statement");
+                    return eval_compound_expr(E);
             }
             return nullptr;
         }
 
+        template <typename Node, auto F>
+        std::shared_ptr<ExprAST> eval_as(const std::shared_ptr<ExprAST>& E)
+        { return (this->*F)(std::static_pointer_cast<Node>(E)); }
+
         void eval_err(const std::string& loginfo)
         {
+            static std::mutex ErrLock; // first failing worker reports
+            std::lock_guard<std::mutex> G(ErrLock);
+            Output::out().flush(); // keep the order of output and error
             std::cerr << "[Eval Error] in line: " << EvalLineNumber << std::endl;
             std::cerr << loginfo << std::endl;
+            if (Worker) // the other threads are still running, skip the destructors
+                std::_Exit(1);
             exit(1);
         }
 
@@ -327,6 +694,7 @@ namespace Eval
         std::shared_ptr<ExprAST> _not_more(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS);
         std::shared_ptr<ExprAST> _not_less(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS);
         std::shared_ptr<ExprAST> _equal(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS);
+        std::shared_ptr<ExprAST> _not_equal(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS);
 
         std::shared_ptr<ExprAST> _and(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS);
         std::shared_ptr<ExprAST> _or(const std::shared_ptr<ExprAST> LHS, const std::shared_ptr<ExprAST> RHS);
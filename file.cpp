@@ -0,0 +1,178 @@
+#include "file.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace File;
+
+/* -- Reader -- */
+ReaderImpl::ReaderImpl(int Fd, size_t Capacity) : Fd(Fd), Buf(new char[Capacity]), Capacity(Capacity) { }
+
+// Move the unread tail to the front and read behind it.
+// The buffer grows only for a line longer than the whole buffer.
+bool ReaderImpl::fill()
+{
+    if (Eof)
+        return false;
+    if (Pos)
+    {
+        memmove(Buf.get(), Buf.get() + Pos, End - Pos);
+        End -= Pos;
+        Pos = 0;
+    }
+    if (End == Capacity)
+    {
+        std::unique_ptr<char[]> Bigger(new char[Capacity * 2]);
+        memcpy(Bigger.get(), Buf.get(), End);
+        Buf = std::move(Bigger);
+        Capacity *= 2;
+    }
+
+    while (true)
+    {
+        auto N = ::read(Fd, Buf.get() + End, Capacity - End);
+        if (N > 0)
+        {
+            End += N;
+            return true;
+        }
+        if (N < 0 && errno == EINTR)
+            continue;
+        if (N < 0)
+            Err = errno;
+        Eof = true;
+        return false;
+    }
+}
+
+bool ReaderImpl::read_line(std::string_view& Line)
+{
+    size_t Scanned = 0; // bytes after Pos known to hold no newline
+    while (true)
+    {
+        auto Start = Buf.get() + Pos;
+        if (auto NL = static_cast<char*>(memchr(Start + Scanned, '\n', End - Pos - Scanned)))
+        {
+            size_t Len = NL - Start;
+            if (Len && Start[Len - 1] == '\r')
+                Len--;
+            Line = std::string_view(Start, Len);
+            Pos += NL - Start + 1;
+            return true;
+        }
+        Scanned = End - Pos;
+        if (!fill())
+        {
+            // Last line without a newline
+            if (Pos == End)
+                return false;
+            Line = std::string_view(Buf.get() + Pos, End - Pos);
+            Pos = End;
+            return true;
+        }
+    }
+}
+
+bool ReaderImpl::eof()
+{
+    return Pos == End && !fill();
+}
+/* ++ Reader ++ */
+
+/* -- Handle -- */
+std::shared_ptr<HandleImpl> HandleImpl::open(const std::string& Path, const std::string& Mode, int& Err)
+{
+    int Flags;
+    if (Mode == "r")      Flags = O_RDONLY;
+    else if (Mode == "w") Flags = O_WRONLY | O_CREAT | O_TRUNC;
+    else if (Mode == "a") Flags = O_WRONLY | O_CREAT | O_APPEND;
+    else
+    {
+        Err = EINVAL;
+        return nullptr;
+    }
+
+    int Fd = ::open(Path.c_str(), Flags | O_CLOEXEC, 0644);
+    if (Fd < 0)
+    {
+        Err = errno;
+        return nullptr;
+    }
+
+    auto H = std::make_shared<HandleImpl>();
+    H->Path = Path;
+    H->Fd = Fd;
+    if (Mode == "r")
+    {
+        posix_fadvise(Fd, 0, 0, POSIX_FADV_SEQUENTIAL); // larger read ahead
+        H->Reader.reset(new ReaderImpl(Fd));
+    }
+    else
+        H->Writer.reset(new Output::WriterImpl(Fd, ReaderImpl::DefaultCapacity));
+    Err = 0;
+    return H;
+}
+
+int HandleImpl::close()
+{
+    if (Fd < 0)
+        return 0;
+    Writer.reset(); // flushes
+    Reader.reset();
+    int R = ::close(Fd) ? errno : 0;
+    Fd = -1;
+    return R;
+}
+/* ++ Handle ++ */
+
+/* -- Mapping -- */
+std::shared_ptr<MappingImpl> MappingImpl::map(const std::string& Path, bool Sequential, int& Err)
+{
+    int Fd = ::open(Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (Fd < 0)
+    {
+        Err = errno;
+        return nullptr;
+    }
+    struct stat St;
+    if (fstat(Fd, &St) < 0)
+        Err = errno;
+    else if (!S_ISREG(St.st_mode)) // a pipe or device has no fixed size to map
+        Err = S_ISDIR(St.st_mode) ? EISDIR : ENODEV;
+    else
+        Err = 0;
+    if (Err)
+    {
+        ::close(Fd);
+        return nullptr;
+    }
+
+    auto M = std::make_shared<MappingImpl>();
+    M->Path = Path;
+    M->Size = St.st_size;
+    if (M->Size) // mmap refuses a zero length
+    {
+        void* P = mmap(nullptr, M->Size, PROT_READ, MAP_PRIVATE, Fd, 0);
+        if (P == MAP_FAILED)
+        {
+            Err = errno;
+            ::close(Fd);
+            return nullptr;
+        }
+        if (Sequential)
+            madvise(P, M->Size, MADV_SEQUENTIAL);
+        M->Data = P;
+    }
+    ::close(Fd); // the mapping stays valid
+    Err = 0;
+    return M;
+}
+
+MappingImpl::~MappingImpl()
+{
+    if (Data)
+        munmap(const_cast<void*>(Data), Size);
+}
+/* ++ Mapping ++ */
@@ -0,0 +1,91 @@
+#ifndef TINYJS_FILE
+#define TINYJS_FILE
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "output.h"
+
+// Files opened by a script (open, readLine, write, close, for-of lines).
+// Reads go through one large buffer: a line is sliced out of it in place
+// and only the unfinished tail is moved to the front before the next
+// read, so memory stays flat however large the file is. Writes use the
+// buffered writer of the script output.
+//
+// mapFile maps a whole file read only instead: scripts index the pages the
+// kernel already holds, nothing is read into the heap.
+
+namespace File
+{
+    class ReaderImpl
+    {
+    private:
+        int Fd;
+        std::unique_ptr<char[]> Buf;
+        size_t Capacity;
+        size_t Pos = 0, End = 0; // unread bytes are [Pos, End)
+        bool Eof = false;
+        int Err = 0;
+
+        bool fill();
+
+    public:
+        static const size_t DefaultCapacity = 1 << 20;
+
+        explicit ReaderImpl(int Fd, size_t Capacity = DefaultCapacity);
+
+        ReaderImpl(const ReaderImpl&) = delete;
+        const ReaderImpl& operator =(const ReaderImpl&) = delete;
+
+        // Next line without its "\n" or "\r\n", false at end of file.
+        // Line points into the buffer, valid until the next call.
+        bool read_line(std::string_view& Line);
+        bool eof();
+        // errno of a failed read, 0 if none
+        int error() const { return Err; }
+    };
+
+    class HandleImpl
+    {
+    public:
+        std::string Path;
+        int Fd = -1;
+        std::unique_ptr<ReaderImpl> Reader; // mode "r"
+        std::unique_ptr<Output::WriterImpl> Writer; // mode "w" or "a"
+
+        // nullptr and Err set when Path can not be opened or Mode is unknown
+        static std::shared_ptr<HandleImpl> open(const std::string& Path, const std::string& Mode, int& Err);
+
+        HandleImpl() = default;
+        ~HandleImpl() { close(); }
+
+        HandleImpl(const HandleImpl&) = delete;
+        const HandleImpl& operator =(const HandleImpl&) = delete;
+
+        bool is_open() const { return Fd >= 0; }
+        // Write out what is buffered and close, returns errno of close()
+        int close();
+    };
+
+    // Private read only mapping of a whole file, unmapped when released
+    class MappingImpl
+    {
+    public:
+        std::string Path;
+        const void* Data = nullptr; // nullptr for an empty file
+        size_t Size = 0;
+
+        // nullptr and Err set when Path can not be opened or mapped.
+        // Sequential hints the kernel to read ahead and drop pages behind.
+        static std::shared_ptr<MappingImpl> map(const std::string& Path, bool Sequential, int& Err);
+
+        MappingImpl() = default;
+        ~MappingImpl();
+
+        MappingImpl(const MappingImpl&) = delete;
+        const MappingImpl& operator =(const MappingImpl&) = delete;
+    };
+}
+
+#endif
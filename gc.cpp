@@ -0,0 +1,232 @@
+#include "gc.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <new>
+using namespace GC;
+
+HeapImpl& GC::heap()
+{
+    static HeapImpl Heap;
+    return Heap;
+}
+
+/* -- Collector -- */
+void HeapImpl::track(std::shared_ptr<void> Owner, Traceable* Object)
+{
+    std::lock_guard<std::mutex> G(Lock);
+    Object->Tracked = true;
+    Objects.push_back({ Owner, Object });
+    AllocatedBytes += Object->heap_size();
+}
+
+size_t HeapImpl::collect()
+{
+    auto Start = std::chrono::steady_clock::now();
+    std::vector<std::shared_ptr<void>> Live;
+    size_t Garbage = 0, LiveBytes = 0;
+    {
+        std::lock_guard<std::mutex> G(Lock);
+
+        // Hold every live container, forget the dead ones
+        std::vector<Traceable*> Heap;
+        Live.reserve(Objects.size());
+        Heap.reserve(Objects.size());
+        size_t j = 0;
+        for (auto& E : Objects)
+        {
+            auto P = E.Owner.lock();
+            if (!P) continue;
+            Objects[j++] = E;
+            Live.push_back(std::move(P));
+            Heap.push_back(E.Object);
+        }
+        Objects.resize(j);
+
+        // References from outside the heap, -1 for the one in Live
+        for (size_t i = 0; i < Heap.size(); i++)
+        {
+            Heap[i]->GCRefs = Live[i].use_count() - 1;
+            Heap[i]->Marked = false;
+        }
+        std::vector<Traceable*> Edges;
+        for (auto* O : Heap)
+        {
+            Edges.clear();
+            O->trace(Edges);
+            for (auto* C : Edges)
+                if (C->Tracked) C->GCRefs--;
+        }
+
+        // Mark from the roots
+        std::vector<Traceable*> Work;
+        for (auto* O : Heap)
+            if (O->GCRefs > 0)
+            {
+                O->Marked = true;
+                Work.push_back(O);
+            }
+        while (!Work.empty())
+        {
+            auto* O = Work.back();
+            Work.pop_back();
+            Edges.clear();
+            O->trace(Edges);
+            for (auto* C : Edges)
+                if (C->Tracked && !C->Marked)
+                {
+                    C->Marked = true;
+                    Work.push_back(C);
+                }
+        }
+
+        // Sweep, the reference counts free what is cleared
+        for (auto* O : Heap)
+        {
+            if (O->Marked)
+                LiveBytes += O->heap_size();
+            else
+            {
+                O->clear_edges();
+                Garbage++;
+            }
+        }
+
+        AllocatedBytes = LiveBytes;
+        NextCollection = LiveBytes * 2 > MinHeapBytes ? LiveBytes * 2 : MinHeapBytes;
+        Stat.LiveObjects = Heap.size() - Garbage;
+        Stat.LiveBytes = LiveBytes;
+        Stat.FreedObjects += Garbage;
+    }
+    Live.clear();
+
+    double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+    std::lock_guard<std::mutex> G(Lock);
+    Stat.Collections++;
+    Stat.LastPauseMs = Ms;
+    Stat.TotalPauseMs += Ms;
+    if (Ms > Stat.MaxPauseMs) Stat.MaxPauseMs = Ms;
+    return Garbage;
+}
+
+Stats HeapImpl::stats()
+{
+    std::lock_guard<std::mutex> G(Lock);
+    Stats S = Stat;
+    nursery_stats(S);
+    return S;
+}
+
+std::string HeapImpl::stats_string()
+{
+    auto S = stats();
+    char Buf[256];
+    snprintf(Buf, sizeof(Buf),
+             "[gc] collections: %llu, pause total: %.3f ms, max: %.3f ms, live: %zu objects / %zu bytes, freed: %llu objects, nursery: %llu chunks / %llu bytes, pinned: %llu chunks",
+             S.Collections, S.TotalPauseMs, S.MaxPauseMs, S.LiveObjects, S.LiveBytes, S.FreedObjects, S.NurseryChunks, S.NurseryBytes, S.PinnedChunks);
+    return Buf;
+}
+/* ++ Collector ++ */
+
+/* -- Nursery -- */
+namespace
+{
+    const size_t ChunkSize = 64 << 10;
+    const size_t HeaderSize = 64;
+    const size_t MaxSmall = 256;
+
+    // Chunks are ChunkSize aligned, the header is found by masking an address.
+    // Live is only touched by frees until the owner retires the chunk and
+    // adds its allocation count, whoever brings it to zero frees the chunk.
+    // A retired chunk that still has live objects is pinned until they die.
+    struct Chunk
+    {
+        std::atomic<long> Live;
+    };
+
+    std::atomic<unsigned long long> ChunkCount(0), ByteCount(0), PinnedCount(0);
+
+    struct Nursery
+    {
+        Chunk* Current = nullptr;
+        char* Top = nullptr;
+        char* End = nullptr;
+        long Allocated = 0;
+
+        void retire()
+        {
+            if (Current)
+            {
+                PinnedCount.fetch_add(1, std::memory_order_relaxed);
+                if (Current->Live.fetch_add(Allocated, std::memory_order_acq_rel) + Allocated == 0)
+                {
+                    PinnedCount.fetch_sub(1, std::memory_order_relaxed);
+                    free(Current);
+                }
+            }
+            Current = nullptr;
+            Top = End = nullptr;
+            Allocated = 0;
+        }
+
+        ~Nursery() { retire(); }
+    };
+
+    thread_local Nursery ThreadNursery;
+
+    Chunk* new_chunk(Nursery& N)
+    {
+        N.retire();
+        void* Mem = aligned_alloc(ChunkSize, ChunkSize);
+        if (!Mem) throw std::bad_alloc();
+        auto* C = new (Mem) Chunk;
+        C->Live.store(0, std::memory_order_relaxed);
+        N.Current = C;
+        N.Top = static_cast<char*>(Mem) + HeaderSize;
+        N.End = static_cast<char*>(Mem) + ChunkSize;
+        ChunkCount.fetch_add(1, std::memory_order_relaxed);
+        return C;
+    }
+}
+
+void* GC::nursery_alloc(size_t Bytes)
+{
+    Bytes = (Bytes + 15) & ~size_t(15);
+    if (Bytes > MaxSmall)
+        return ::operator new(Bytes);
+
+    auto& N = ThreadNursery;
+    if (N.Top + Bytes > N.End)
+    {
+        ByteCount.fetch_add(N.Top ? N.Top - (char*)N.Current : 0, std::memory_order_relaxed);
+        new_chunk(N);
+    }
+    void* P = N.Top;
+    N.Top += Bytes;
+    N.Allocated++;
+    return P;
+}
+
+void GC::nursery_free(void* P, size_t Bytes)
+{
+    Bytes = (Bytes + 15) & ~size_t(15);
+    if (Bytes > MaxSmall)
+    {
+        ::operator delete(P);
+        return;
+    }
+    auto* C = reinterpret_cast<Chunk*>(reinterpret_cast<uintptr_t>(P) & ~uintptr_t(ChunkSize - 1));
+    if (C->Live.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        PinnedCount.fetch_sub(1, std::memory_order_relaxed);
+        free(C);
+    }
+}
+
+void GC::nursery_stats(Stats& S)
+{
+    S.NurseryChunks = ChunkCount.load(std::memory_order_relaxed);
+    S.NurseryBytes = ByteCount.load(std::memory_order_relaxed);
+    S.PinnedChunks = PinnedCount.load(std::memory_order_relaxed);
+}
+/* ++ Nursery ++ */
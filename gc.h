@@ -0,0 +1,148 @@
+#ifndef TINYJS_GC
+#define TINYJS_GC
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Heap management for runtime values.
+//
+// Values stay reference counted, the collector exists for what reference
+// counting can not free: cycles between containers (an array holding
+// itself, closures capturing each other, ...).
+//
+// Collector: mark-sweep over the tracked containers (Traceable).
+//   Roots are the scope chain and the evaluator stack. Both hold plain
+//   std::shared_ptr, so they are found by subtracting the references the
+//   heap holds on itself from every use_count: what is left comes from a
+//   root. Marking then follows the edges from there, and every container
+//   left unmarked is garbage. Its edges are cleared, which breaks the cycle
+//   and lets the reference counts free it.
+//   A collection runs at a statement boundary once the tracked heap has
+//   grown past twice its size after the previous collection.
+//
+// Nursery: boxed numbers and other small nodes are bump allocated from
+//   64 KiB chunks (make_value). A chunk counts its live objects and goes
+//   back to malloc when the last one dies, so short lived temporaries cost
+//   a pointer bump instead of a malloc/free pair.
+//   Objects are never moved, so one long lived value keeps its whole chunk:
+//   at worst a chunk per surviving value, 64 KiB each. Retired chunks that
+//   are still held are reported as pinned in the stats.
+
+namespace GC
+{
+    class Traceable
+    {
+    public:
+        bool Tracked = false;
+        long GCRefs = 0;
+        bool Marked = false;
+
+        virtual ~Traceable() = default;
+        // Append every tracked container this object holds a reference to,
+        // once per held reference.
+        virtual void trace(std::vector<Traceable*>& Out) = 0;
+        // Drop all references, the object is garbage.
+        virtual void clear_edges() = 0;
+        // Approximate bytes owned by the object.
+        virtual size_t heap_size() const = 0;
+    };
+
+    struct Stats
+    {
+        unsigned long long Collections = 0;
+        double TotalPauseMs = 0;
+        double MaxPauseMs = 0;
+        double LastPauseMs = 0;
+        size_t LiveObjects = 0;
+        size_t LiveBytes = 0;
+        unsigned long long FreedObjects = 0;
+        unsigned long long NurseryChunks = 0;
+        unsigned long long NurseryBytes = 0;
+        unsigned long long PinnedChunks = 0;
+    };
+
+    class HeapImpl
+    {
+    private:
+        struct Entry
+        {
+            std::weak_ptr<void> Owner;
+            Traceable* Object;
+        };
+        std::vector<Entry> Objects;
+        std::mutex Lock;
+        std::atomic<size_t> AllocatedBytes;
+        std::atomic<size_t> NextCollection;
+        std::atomic<int> Disabled;
+        Stats Stat;
+
+    public:
+        static const size_t MinHeapBytes = 4 << 20;
+
+        HeapImpl() : AllocatedBytes(0), NextCollection(MinHeapBytes), Disabled(0) { }
+
+        HeapImpl(const HeapImpl&) = delete;
+        const HeapImpl& operator =(const HeapImpl&) = delete;
+
+        // Register a container, Owner is the shared_ptr managing Object.
+        void track(std::shared_ptr<void> Owner, Traceable* Object);
+
+        bool should_collect() const { return !Disabled && AllocatedBytes >= NextCollection; }
+        void maybe_collect() { if (should_collect()) collect(); }
+        // Returns the number of objects found to be garbage.
+        size_t collect();
+
+        // No collection while disabled, e.g. while other threads run script code.
+        void disable() { Disabled++; }
+        void enable() { Disabled--; }
+
+        Stats stats();
+        std::string stats_string();
+    };
+
+    // The process wide heap
+    HeapImpl& heap();
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T> make_traced(Args&&... args)
+    {
+        auto P = std::make_shared<T>(std::forward<Args>(args)...);
+        heap().track(P, P.get());
+        return P;
+    }
+
+    /* -- Nursery -- */
+    void* nursery_alloc(size_t Bytes);
+    void nursery_free(void* P, size_t Bytes);
+    void nursery_stats(Stats& S);
+
+    template <typename T>
+    class NurseryAllocator
+    {
+    public:
+        using value_type = T;
+        NurseryAllocator() = default;
+        template <typename U> NurseryAllocator(const NurseryAllocator<U>&) { }
+
+        T* allocate(size_t n) { return static_cast<T*>(nursery_alloc(n * sizeof(T))); }
+        void deallocate(T* p, size_t n) { nursery_free(p, n * sizeof(T)); }
+
+        template <typename U> bool operator ==(const NurseryAllocator<U>&) const { return true; }
+        template <typename U> bool operator !=(const NurseryAllocator<U>&) const { return false; }
+    };
+
+    // Allocate a small value node in the nursery.
+    template <typename T, typename... Args>
+    std::shared_ptr<T> make_value(Args&&... args)
+    {
+        return std::allocate_shared<T>(NurseryAllocator<T>(), std::forward<Args>(args)...);
+    }
+    /* ++ Nursery ++ */
+}
+
+#endif
@@ -0,0 +1,182 @@
+#include "inline.h"
+#include <string>
+#include <unordered_map>
+using namespace Inline;
+using namespace AST;
+
+namespace
+{
+    class CloneImpl
+    {
+    public:
+        const std::string& Self;
+        std::unordered_map<std::string, size_t> Params; // a repeated name is the last one
+        size_t Nodes = 0;
+
+        CloneImpl(const std::string& Self) : Self(Self) { }
+
+        // E with its parameters read from the call, nullptr if it can not be inlined.
+        // MaxNodes also bounds how deep this recurses.
+        Expr clone(const Expr& E)
+        {
+            if (!E || ++Nodes > MaxNodes)
+                return nullptr;
+            Expr C;
+            switch (E->SubType)
+            {
+                case Type::integer_expr: case Type::float_expr: case Type::string_expr:
+                    return E;
+                case Type::variable_expr:
+                {
+                    auto V = static_cast<VariableExprAST*>(E.get());
+                    if (!V->DefineType.empty())
+                        return nullptr;
+                    auto P = Params.find(V->Name);
+                    if (P == Params.end())
+                        return E; // a global
+                    C = std::make_shared<InlineArgExprAST>(P->second);
+                    break;
+                }
+                case Type::unary_op_expr:
+                {
+                    auto U = static_cast<UnaryOpExprAST*>(E.get());
+                    auto X = clone(U->Expression);
+                    if (!X)
+                        return nullptr;
+                    C = std::make_shared<UnaryOpExprAST>(U->Op, X);
+                    break;
+                }
+                case Type::binary_op_expr:
+                {
+                    auto B = static_cast<BinaryOpExprAST*>(E.get());
+                    if (B->Op == "=")
+                        return nullptr;
+                    auto L = clone(B->LHS);
+                    auto R = L ? clone(B->RHS) : nullptr;
+                    if (!R)
+                        return nullptr;
+                    C = std::make_shared<BinaryOpExprAST>(B->Op, L, R);
+                    break;
+                }
+                case Type::index_expr:
+                {
+                    auto I = static_cast<IndexExprAST*>(E.get());
+                    auto O = clone(I->Object);
+                    auto X = O ? clone(I->Index) : nullptr;
+                    if (!X)
+                        return nullptr;
+                    C = std::make_shared<IndexExprAST>(O, X);
+                    break;
+                }
+                case Type::call_expr:
+                {
+                    // Not itself, and not a parameter: the callee is found in the globals
+                    auto Call = static_cast<CallExprAST*>(E.get());
+                    if (Call->Callee == Self || Params.count(Call->Callee))
+                        return nullptr;
+                    std::vector<Expr> Args;
+                    for (auto& A : Call->Args)
+                    {
+                        Args.push_back(clone(A));
+                        if (!Args.back())
+                            return nullptr;
+                    }
+                    auto N = std::make_shared<CallExprAST>(Call->Callee, std::move(Args));
+                    N->Native = Call->Native;
+                    C = N;
+                    break;
+                }
+                default:
+                    return nullptr;
+            }
+            C->LineNumber = E->LineNumber;
+            return C;
+        }
+
+        // The value of a block that is just `return e;`
+        const ReturnExprAST* only_return(const std::shared_ptr<BlockExprAST>& Block)
+        {
+            if (!Block || Block->Statement.size() != 1 || Block->Statement[0]->SubType != Type::return_expr)
+                return nullptr;
+            auto R = static_cast<ReturnExprAST*>(Block->Statement[0].get());
+            return R->RetValue ? R : nullptr;
+        }
+
+        bool add_exit(BodyImpl& B, const Expr& Cond, IntType CondLine, const ReturnExprAST& R)
+        {
+            BodyImpl::Exit X;
+            if (Cond && !(X.Cond = clone(Cond)))
+                return false;
+            if (!(X.Value = clone(R.RetValue)))
+                return false;
+            X.CondLine = CondLine;
+            X.Line = R.LineNumber;
+            B.Exits.push_back(std::move(X));
+            return true;
+        }
+
+        // if (c) return a; [else if (d) return b;] [else return e;]
+        // Ends is set when the else branch returns, whatever follows is never run.
+        // The conditions of an else if chain run at the line of its first if.
+        bool guards(const IfExprAST& If, IntType Line, BodyImpl& B, bool& Ends)
+        {
+            auto R = only_return(If.IfBlock);
+            if (!R || !add_exit(B, If.Cond, Line, *R))
+                return false;
+            if (If.ElseIf)
+                return If.ElseIf->SubType == Type::if_else_expr
+                    && guards(*static_cast<IfExprAST*>(If.ElseIf.get()), Line, B, Ends);
+            Ends = false;
+            if (!If.ElseBlock || If.ElseBlock->Statement.empty())
+                return true;
+            auto E = only_return(If.ElseBlock);
+            Ends = true;
+            return E && add_exit(B, nullptr, 0, *E);
+        }
+
+        // Guards and a final return, every path returns a value
+        bool exits(const std::vector<Expr>& Statements, BodyImpl& B)
+        {
+            for (auto& S : Statements)
+            {
+                if (S->SubType == Type::return_expr)
+                {
+                    auto R = static_cast<ReturnExprAST*>(S.get());
+                    return R->RetValue && add_exit(B, nullptr, 0, *R);
+                }
+                if (S->SubType != Type::if_else_expr)
+                    return false;
+                bool Ends = false;
+                if (!guards(*static_cast<IfExprAST*>(S.get()), S->LineNumber, B, Ends))
+                    return false;
+                if (Ends)
+                    return true;
+            }
+            return false;
+        }
+    };
+}
+
+std::shared_ptr<const BodyImpl> Inline::inline_body(const FunctionAST& F)
+{
+    if (!F.Body || F.IsAsync)
+        return nullptr;
+
+    CloneImpl C(F.Proto->Name);
+    auto& Params = F.Proto->Args;
+    for (size_t i = 0; i < Params.size(); i++)
+    {
+        auto P = Params[i].get();
+        if (P->SubType == Type::binary_op_expr) // x = default
+            P = static_cast<BinaryOpExprAST*>(P)->LHS.get();
+        if (P->SubType != Type::variable_expr)
+            return nullptr;
+        C.Params[static_cast<VariableExprAST*>(P)->Name] = i;
+    }
+
+    auto B = std::make_shared<BodyImpl>();
+    B->Params = Params.size();
+    if (!C.exits(F.Body->Statement, *B))
+        return nullptr;
+    return B;
+}
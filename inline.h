@@ -0,0 +1,47 @@
+#ifndef TINYJS_INLINE
+#define TINYJS_INLINE
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ast.h"
+
+// Inlining: small functions evaluated in place at their call sites.
+//
+// A call site that called the same function InlineAfter times asks for
+// its inline body. A body is one when it only returns: a return of an
+// expression, after guards `if (c) return e;` (with else and else if
+// branches of one return each), and its expressions are at most MaxNodes
+// of constants, names, operators, indexing and calls to other functions.
+// Parameters become InlineArgExprAST leaves that read the arguments of the
+// call, other names are the globals the function sees.
+//
+// The site then evaluates the body with the arguments in hand: no frame,
+// no block scopes, no return value to unwrap. Anything else, a recursive
+// function, a closure with upvalues, assignments, loops, `let`, is called
+// as usual. TINYJS_NO_INLINE turns inlining off.
+
+namespace Inline
+{
+    constexpr uint32_t InlineAfter = 16;
+    constexpr size_t MaxNodes = 32;
+
+    class BodyImpl
+    {
+    public:
+        // Tried in order, the first one whose Cond holds gives the result,
+        // the last one has no Cond. Lines are of the if and of the return.
+        struct Exit
+        {
+            AST::Expr Cond, Value;
+            AST::IntType CondLine = 0, Line = 0;
+        };
+        std::vector<Exit> Exits;
+        size_t Params = 0;
+    };
+
+    // The inline body of F, nullptr if F is not small or simple enough
+    std::shared_ptr<const BodyImpl> inline_body(const AST::FunctionAST& F);
+}
+
+#endif
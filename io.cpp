@@ -0,0 +1,230 @@
+#include "eval.h"
+#include "json.h"
+#include <algorithm>
+#include <cstring>
+using namespace Eval;
+
+/* -- File built in -- */
+std::shared_ptr<File::HandleImpl> EvalImpl::to_open_file(std::shared_ptr<ExprAST> V, const std::string& Where)
+{
+    if (!V || !isFile(V))
+        eval_err("[" + Where + "] TypeError: expected a file, got " + (V ? V->get_ast_name() : std::string("undefined")) + ".");
+    auto H = ptr_to<FileValueExprAST>(V)->Handle;
+    if (!H->is_open())
+        eval_err("[" + Where + "] Error: '" + H->Path + "' is closed.");
+    return H;
+}
+
+// open(path) / open(path, mode), mode is "r" (default), "w" or "a"
+std::shared_ptr<ExprAST> EvalImpl::builtin_open(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isString(Args[0]))
+        eval_err("[open] TypeError: path must be a string.");
+    std::string Mode = "r";
+    if (Args.size() > 1)
+    {
+        if (!isString(Args[1]))
+            eval_err("[open] TypeError: mode must be a string.");
+        Mode = get_value<StringValueExprAST>(Args[1]);
+    }
+
+    int Err;
+    auto Path = get_value<StringValueExprAST>(Args[0]);
+    auto H = File::HandleImpl::open(Path, Mode, Err);
+    if (!H && Err == EINVAL)
+        eval_err("[open] TypeError: unknown mode '" + Mode + "'.");
+    if (!H)
+        eval_err("[open] Error: can not open '" + Path + "': " + strerror(Err) + ".");
+    return std::make_shared<FileValueExprAST>(H);
+}
+
+// readLine(f) => next line without "\n", 0 at end of file
+std::shared_ptr<ExprAST> EvalImpl::builtin_read_line(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto H = to_open_file(Args[0], "readLine");
+    if (!H->Reader)
+        eval_err("[readLine] TypeError: '" + H->Path + "' is not open for reading.");
+    std::string_view Line;
+    if (H->Reader->read_line(Line))
+        return GC::make_value<StringValueExprAST>(std::string(Line));
+    if (H->Reader->error())
+        eval_err("[readLine] Error: reading '" + H->Path + "': " + strerror(H->Reader->error()) + ".");
+    return GC::make_value<IntegerValueExprAST>(0);
+}
+
+// eof(f) => 1 once every line has been read
+std::shared_ptr<ExprAST> EvalImpl::builtin_eof(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto H = to_open_file(Args[0], "eof");
+    if (!H->Reader)
+        eval_err("[eof] TypeError: '" + H->Path + "' is not open for reading.");
+    return GC::make_value<IntegerValueExprAST>(H->Reader->eof() ? 1 : 0);
+}
+
+// write(f, v, ...), strings as they are, numbers as print shows them
+std::shared_ptr<ExprAST> EvalImpl::builtin_write(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto H = to_open_file(Args[0], "write");
+    if (!H->Writer)
+        eval_err("[write] TypeError: '" + H->Path + "' is not open for writing.");
+    auto& Out = *H->Writer;
+    for (size_t i = 1; i < Args.size(); i++)
+    {
+        auto& V = Args[i];
+        if (isString(V))
+            Out.write(get_value<StringValueExprAST>(V));
+        else if (isInt(V))
+            Out.write_int(get_value<IntegerValueExprAST>(V));
+        else if (isFloat(V))
+            Out.write_double(get_value<FloatValueExprAST>(V));
+        else
+            eval_err("[write] TypeError: can not write " + V->get_ast_name() + ".");
+    }
+    return nullptr;
+}
+
+// close(f), what write buffered goes out first
+std::shared_ptr<ExprAST> EvalImpl::builtin_close(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isFile(Args[0]))
+        eval_err("[close] TypeError: expected a file, got " + Args[0]->get_ast_name() + ".");
+    auto H = ptr_to<FileValueExprAST>(Args[0])->Handle;
+    if (int Err = H->close())
+        eval_err("[close] Error: closing '" + H->Path + "': " + strerror(Err) + ".");
+    return nullptr;
+}
+
+// mapFile(path) => read only Uint8Array over the bytes of path, nothing is copied.
+// mapFile(path, "Int32Array" / "Float64Array") views the bytes as those elements.
+// The mapping lives as long as the array, the kernel is told it is read in order.
+std::shared_ptr<ExprAST> EvalImpl::builtin_map_file(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isString(Args[0]))
+        eval_err("[mapFile] TypeError: path must be a string.");
+    auto Kind = TypedKind::uint8;
+    if (Args.size() > 1)
+    {
+        auto Name = isString(Args[1]) ? get_value<StringValueExprAST>(Args[1]) : std::string();
+        if (Name == "Float64Array")    Kind = TypedKind::float64;
+        else if (Name == "Int32Array") Kind = TypedKind::int32;
+        else if (Name != "Uint8Array")
+            eval_err("[mapFile] TypeError: kind must be \"Uint8Array\", \"Int32Array\" or \"Float64Array\".");
+    }
+
+    int Err;
+    auto Path = get_value<StringValueExprAST>(Args[0]);
+    auto M = File::MappingImpl::map(Path, true, Err);
+    if (!M)
+        eval_err("[mapFile] Error: can not map '" + Path + "': " + strerror(Err) + ".");
+    size_t Size = TypedArrayValueExprAST::element_size(Kind);
+    if (M->Size % Size)
+        eval_err("[mapFile] RangeError: size of '" + Path + "' is not a multiple of " + std::to_string(Size) + ".");
+    return std::make_shared<TypedArrayValueExprAST>(Kind, M, const_cast<void*>(M->Data), M->Size / Size, true);
+}
+/* ++ File built in ++ */
+
+// for (line of f), one line per round, the file is never held whole.
+// A `let` line variable is overwritten in place while nothing else holds
+// its string, a round then costs no allocation.
+std::shared_ptr<ExprAST> EvalImpl::eval_for_of_lines(std::shared_ptr<ForOfExprAST> ForOf, std::shared_ptr<FileValueExprAST> File)
+{
+#ifdef elog
+    log("in eval_for_of_lines");
+#endif
+    auto H = to_open_file(File, "eval_for_of");
+    if (!H->Reader)
+        eval_err("[eval_for_of] TypeError: '" + H->Path + "' is not open for reading.");
+    auto Var = ForOf->Var;
+    std::shared_ptr<ExprAST>* Slot = nullptr;
+    std::string_view Line;
+
+    // The body may close the file
+    while (H->is_open() && H->Reader->read_line(Line))
+    {
+        if (Var->DefineType == "let")
+        {
+            if (Slot && *Slot && isString(*Slot) && Slot->use_count() == 1)
+                ptr_to<StringValueExprAST>(*Slot)->Val.assign(Line.data(), Line.size());
+            else
+            {
+                CurScope->set(Var->Name, GC::make_value<StringValueExprAST>(std::string(Line)));
+                Slot = CurScope->get_slot(Var->Name);
+            }
+        }
+        else if (Var->DefineType == "var")
+            get_top_scope()->set(Var->Name, GC::make_value<StringValueExprAST>(std::string(Line)));
+        else
+            set_name(Var->Name, GC::make_value<StringValueExprAST>(std::string(Line)));
+
+        auto R = eval_block(ForOf->Block->Statement);
+        if (is_interrupt_control_flow(R))
+        {
+            if (isBreak(R))
+                break;
+            else if (isReturn(R))
+                return R;
+        }
+    }
+
+    if (H->is_open() && H->Reader->error())
+        eval_err("[eval_for_of] Error: reading '" + H->Path + "': " + strerror(H->Reader->error()) + ".");
+    return ForOf;
+}
+
+/* -- JSON built in -- */
+std::shared_ptr<ExprAST> EvalImpl::parse_json(std::string_view Text, const std::string& Where)
+{
+    Json::ParserImpl Parser(Text);
+    std::shared_ptr<ExprAST> V;
+    if (!Parser.parse(V))
+        eval_err("[" + Where + "] SyntaxError: " + Parser.error() + ".");
+    return V;
+}
+
+// JSON.parse(text) / JSON.parse(bytes, start, end).
+// A Uint8Array (mapFile) is parsed in place, [start, end) picks one record.
+std::shared_ptr<ExprAST> EvalImpl::builtin_json_parse(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (isString(Args[0]))
+        return parse_json(ptr_to<StringValueExprAST>(Args[0])->Val, "JSON.parse");
+    if (isTypedArray(Args[0]))
+        return parse_json(to_byte_view(Args, 0, "JSON.parse"), "JSON.parse");
+    eval_err("[JSON.parse] TypeError: expected a string or a Uint8Array, got " + Args[0]->get_ast_name() + ".");
+    return nullptr;
+}
+
+// JSON.stringify(v) / JSON.stringify(v, null, indent)
+std::shared_ptr<ExprAST> EvalImpl::builtin_json_stringify(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    int Indent = 0;
+    if (Args.size() > 1 && !isNull(Args[1]))
+        eval_err("[JSON.stringify] TypeError: a replacer is not supported, pass null.");
+    if (Args.size() > 2)
+    {
+        if (!isInt(Args[2]))
+            eval_err("[JSON.stringify] TypeError: indent must be an integer.");
+        Indent = std::clamp<long long>(get_value<IntegerValueExprAST>(Args[2]), 0, 10);
+    }
+
+    std::string Out, Err;
+    if (!Json::stringify(Args[0], Indent, Out, Err))
+        eval_err("[JSON.stringify] " + Err + ".");
+    return GC::make_value<StringValueExprAST>(std::move(Out));
+}
+
+// JSON.read(f) => next record of a newline delimited JSON file, null at the end.
+// The line is parsed in the read buffer, blank lines are skipped.
+std::shared_ptr<ExprAST> EvalImpl::builtin_json_read(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    auto H = to_open_file(Args[0], "JSON.read");
+    if (!H->Reader)
+        eval_err("[JSON.read] TypeError: '" + H->Path + "' is not open for reading.");
+    std::string_view Line;
+    while (H->Reader->read_line(Line))
+        if (Line.find_first_not_of(" \t") != std::string_view::npos)
+            return parse_json(Line, "JSON.read");
+    if (H->Reader->error())
+        eval_err("[JSON.read] Error: reading '" + H->Path + "': " + strerror(H->Reader->error()) + ".");
+    return null_value();
+}
+/* ++ JSON built in ++ */
@@ -0,0 +1,1327 @@
+#include "ir.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <tuple>
+using namespace IR;
+
+namespace
+{
+    const int MaxDepth = 10000; // of reads through the blocks, building recurses as deep
+
+    // The operations of the kernels, to_real up to truth_d, have no effects
+    bool pure(Op O) { return O >= Op::to_real && O <= Op::truth_d; }
+
+    bool unary(Op O)
+    {
+        switch (O)
+        {
+            case Op::to_real: case Op::to_integer: case Op::bit_not:
+            case Op::not_i: case Op::not_d: case Op::truth_d:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool commutative(Op O)
+    {
+        switch (O)
+        {
+            case Op::add_i: case Op::mul_i: case Op::add_d: case Op::mul_d: case Op::eq_i: case Op::eq_d:
+            case Op::bit_and: case Op::bit_or: case Op::bit_xor:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    Kind result_kind(Op O)
+    {
+        switch (O)
+        {
+            case Op::to_real: case Op::add_d: case Op::sub_d: case Op::mul_d: case Op::div_d: case Op::mod_d:
+            case Op::and_d: case Op::or_d:
+                return Kind::real;
+            default:
+                return Kind::integer;
+        }
+    }
+
+    Kind operand_kind(Op O)
+    {
+        switch (O)
+        {
+            case Op::to_integer: case Op::add_d: case Op::sub_d: case Op::mul_d: case Op::div_d: case Op::mod_d:
+            case Op::lt_d: case Op::le_d: case Op::gt_d: case Op::ge_d: case Op::eq_d:
+            case Op::not_d: case Op::truth_d: case Op::and_d: case Op::or_d:
+                return Kind::real;
+            default:
+                return Kind::integer;
+        }
+    }
+
+    // An operation as the kernels run it. Integers wrap around.
+    template <Op O>
+    inline Value apply(Value L, Value R)
+    {
+        using U = unsigned long long;
+        Value V;
+        if constexpr (O == Op::to_real)         V.D = (double)L.I;
+        else if constexpr (O == Op::to_integer) V.I = (long long)L.D;
+        else if constexpr (O == Op::add_i)      V.I = (long long)((U)L.I + (U)R.I);
+        else if constexpr (O == Op::sub_i)      V.I = (long long)((U)L.I - (U)R.I);
+        else if constexpr (O == Op::mul_i)      V.I = (long long)((U)L.I * (U)R.I);
+        else if constexpr (O == Op::div_i)      V.I = Numeric::divide(L.I, R.I);
+        else if constexpr (O == Op::mod_i)      V.I = Numeric::modulo(L.I, R.I);
+        else if constexpr (O == Op::add_d)      V.D = L.D + R.D;
+        else if constexpr (O == Op::sub_d)      V.D = L.D - R.D;
+        else if constexpr (O == Op::mul_d)      V.D = L.D * R.D;
+        else if constexpr (O == Op::div_d)      V.D = L.D / R.D;
+        else if constexpr (O == Op::mod_d)      V.D = fmod(L.D, R.D);
+        else if constexpr (O == Op::lt_i)       V.I = L.I <  R.I;
+        else if constexpr (O == Op::le_i)       V.I = L.I <= R.I;
+        else if constexpr (O == Op::gt_i)       V.I = L.I >  R.I;
+        else if constexpr (O == Op::ge_i)       V.I = L.I >= R.I;
+        else if constexpr (O == Op::eq_i)       V.I = L.I == R.I;
+        else if constexpr (O == Op::lt_d)       V.I = L.D <  R.D;
+        else if constexpr (O == Op::le_d)       V.I = L.D <= R.D;
+        else if constexpr (O == Op::gt_d)       V.I = L.D >  R.D;
+        else if constexpr (O == Op::ge_d)       V.I = L.D >= R.D;
+        else if constexpr (O == Op::eq_d)       V.I = L.D == R.D;
+        else if constexpr (O == Op::shl)        V.I = (long long)((U)L.I << R.I);
+        else if constexpr (O == Op::shr)        V.I = L.I >> R.I;
+        else if constexpr (O == Op::bit_and)    V.I = L.I & R.I;
+        else if constexpr (O == Op::bit_or)     V.I = L.I | R.I;
+        else if constexpr (O == Op::bit_xor)    V.I = L.I ^ R.I;
+        else if constexpr (O == Op::bit_not)    V.I = ~L.I;
+        else if constexpr (O == Op::not_i)      V.I = !L.I;
+        else if constexpr (O == Op::not_d)      V.I = !L.D;
+        else if constexpr (O == Op::truth_d)    V.I = L.D ? 1 : 0;
+        // && and || evaluate both sides, the value is one of them
+        else if constexpr (O == Op::and_i)      V = L.I ? R : L;
+        else if constexpr (O == Op::and_d)      V = L.D ? R : L;
+        else if constexpr (O == Op::or_i)       V = L.I ? L : R;
+        else if constexpr (O == Op::or_d)       V = L.D ? L : R;
+        return V;
+    }
+
+    // The value of a pure operation on constants, false if it traps or is
+    // not defined (it is left to run)
+    bool fold(Op O, Value L, Value R, Value& V)
+    {
+        switch (O)
+        {
+            case Op::div_i: case Op::mod_i:
+                if (R.I == 0 || (L.I == LLONG_MIN && R.I == -1))
+                    return false;
+                break;
+            case Op::shl: case Op::shr:
+                if (R.I < 0 || R.I > 63)
+                    return false;
+                break;
+            case Op::to_integer:
+                if (!(L.D > -9.2e18 && L.D < 9.2e18))
+                    return false;
+                break;
+            default:
+                break;
+        }
+        switch (O)
+        {
+            case Op::to_real:    V = apply<Op::to_real>(L, R); return true;
+            case Op::to_integer: V = apply<Op::to_integer>(L, R); return true;
+            case Op::add_i:      V = apply<Op::add_i>(L, R); return true;
+            case Op::sub_i:      V = apply<Op::sub_i>(L, R); return true;
+            case Op::mul_i:      V = apply<Op::mul_i>(L, R); return true;
+            case Op::div_i:      V = apply<Op::div_i>(L, R); return true;
+            case Op::mod_i:      V = apply<Op::mod_i>(L, R); return true;
+            case Op::add_d:      V = apply<Op::add_d>(L, R); return true;
+            case Op::sub_d:      V = apply<Op::sub_d>(L, R); return true;
+            case Op::mul_d:      V = apply<Op::mul_d>(L, R); return true;
+            case Op::div_d:      V = apply<Op::div_d>(L, R); return true;
+            case Op::mod_d:      V = apply<Op::mod_d>(L, R); return true;
+            case Op::lt_i:       V = apply<Op::lt_i>(L, R); return true;
+            case Op::le_i:       V = apply<Op::le_i>(L, R); return true;
+            case Op::gt_i:       V = apply<Op::gt_i>(L, R); return true;
+            case Op::ge_i:       V = apply<Op::ge_i>(L, R); return true;
+            case Op::eq_i:       V = apply<Op::eq_i>(L, R); return true;
+            case Op::lt_d:       V = apply<Op::lt_d>(L, R); return true;
+            case Op::le_d:       V = apply<Op::le_d>(L, R); return true;
+            case Op::gt_d:       V = apply<Op::gt_d>(L, R); return true;
+            case Op::ge_d:       V = apply<Op::ge_d>(L, R); return true;
+            case Op::eq_d:       V = apply<Op::eq_d>(L, R); return true;
+            case Op::shl:        V = apply<Op::shl>(L, R); return true;
+            case Op::shr:        V = apply<Op::shr>(L, R); return true;
+            case Op::bit_and:    V = apply<Op::bit_and>(L, R); return true;
+            case Op::bit_or:     V = apply<Op::bit_or>(L, R); return true;
+            case Op::bit_xor:    V = apply<Op::bit_xor>(L, R); return true;
+            case Op::bit_not:    V = apply<Op::bit_not>(L, R); return true;
+            case Op::not_i:      V = apply<Op::not_i>(L, R); return true;
+            case Op::not_d:      V = apply<Op::not_d>(L, R); return true;
+            case Op::truth_d:    V = apply<Op::truth_d>(L, R); return true;
+            case Op::and_i:      V = apply<Op::and_i>(L, R); return true;
+            case Op::and_d:      V = apply<Op::and_d>(L, R); return true;
+            case Op::or_i:       V = apply<Op::or_i>(L, R); return true;
+            case Op::or_d:       V = apply<Op::or_d>(L, R); return true;
+            default:             return false;
+        }
+    }
+
+    // Calls Fn on every operand of I, by reference
+    template <typename Fn>
+    void each_operand(Inst& I, Fn&& F)
+    {
+        if (I.Code == Op::phi)
+            for (auto& A : I.Args)
+                F(A);
+        else if (pure(I.Code))
+        {
+            F(I.A);
+            if (!unary(I.Code))
+                F(I.B);
+        }
+    }
+
+    const char* op_name(Op O)
+    {
+        static const char* Names[] = {
+            "constant", "load", "to_real", "to_integer",
+            "add_i", "sub_i", "mul_i", "div_i", "mod_i", "add_d", "sub_d", "mul_d", "div_d", "mod_d",
+            "lt_i", "le_i", "gt_i", "ge_i", "eq_i", "lt_d", "le_d", "gt_d", "ge_d", "eq_d",
+            "shl", "shr", "bit_and", "bit_or", "bit_xor", "bit_not",
+            "not_i", "not_d", "and_i", "and_d", "or_i", "or_d", "truth_d",
+            "seq", "store", "eval", "if_else", "while_loop", "do_while_loop", "for_loop", "ret", "brk", "cont",
+            "phi", "copy", "jump", "jump_unless",
+        };
+        return Names[(size_t)O];
+    }
+}
+
+/* -- SSA construction -- */
+namespace IR
+{
+    // From the nodes of a kernel in one walk, as Braun et al. ("Simple and
+    // Efficient Construction of Static Single Assignment Form") do it: a slot
+    // is read where it was last stored in the block, else from the blocks
+    // before it, with a phi where there are several. A block is sealed once
+    // all its predecessors are known, until then its phis wait for operands.
+    class BuilderImpl
+    {
+    public:
+        FunctionImpl& F;
+        const Numeric::KernelImpl& K;
+        bool Failed = false;
+
+        BuilderImpl(FunctionImpl& F, const Numeric::KernelImpl& K) : F(F), K(K) { }
+
+        void build()
+        {
+            F.Params = K.Params.size();
+            F.Result = K.Result;
+            Cur = block();
+            seal(Cur);
+            for (uint32_t i = 0; i < K.Params.size(); i++)
+            {
+                auto V = inst(Op::load, i);
+                F.Insts[V].K = K.Params[i];
+                write(i, V, Cur);
+            }
+            statement(K.Body);
+            if (Cur != None) // the kernel always returns
+                Failed = true;
+            F.resolve();
+            F.simplify_phis();
+        }
+
+    private:
+        struct Loop
+        {
+            std::vector<uint32_t> Breaks, Continues; // blocks that jump out, to the next turn
+        };
+        std::vector<std::vector<uint32_t>> Defs; // of every slot, by block
+        std::vector<bool> Sealed;
+        std::vector<std::vector<std::pair<uint32_t, uint32_t>>> Incomplete; // slot and phi, by block
+        std::vector<Loop> Loops;
+        uint32_t Cur = None; // None after a return, break or continue
+        int Depth = 0;
+
+        uint32_t block()
+        {
+            F.Blocks.emplace_back();
+            Defs.emplace_back(K.Slots, None);
+            Sealed.push_back(false);
+            Incomplete.emplace_back();
+            return F.Blocks.size() - 1;
+        }
+
+        uint32_t inst(Op Code, uint32_t A = None, uint32_t B = None)
+        {
+            Inst I;
+            I.Code = Code;
+            I.A = A;
+            I.B = B;
+            I.Block = Cur;
+            I.K = pure(Code) ? result_kind(Code) : Kind::none;
+            F.Insts.push_back(I);
+            F.Forward.push_back(None);
+            F.Blocks[Cur].Insts.push_back(F.Insts.size() - 1);
+            return F.Insts.size() - 1;
+        }
+
+        uint32_t phi(uint32_t B)
+        {
+            Inst I;
+            I.Code = Op::phi;
+            I.Block = B;
+            F.Insts.push_back(I);
+            F.Forward.push_back(None);
+            auto V = F.Insts.size() - 1;
+            auto& L = F.Blocks[B].Insts;
+            auto At = std::find_if(L.begin(), L.end(), [&](uint32_t i) { return F.Insts[i].Code != Op::phi; });
+            L.insert(At, V);
+            return V;
+        }
+
+        // A constant used where Kind is, for dumps
+        void typed(uint32_t V, Kind Of)
+        {
+            auto& I = F.Insts[V];
+            if (I.Code == Op::constant && I.K == Kind::none && V != F.Undef)
+                I.K = Of;
+        }
+
+        void link(uint32_t From, uint32_t To) { F.Blocks[To].Preds.push_back(From); }
+
+        void jump(uint32_t From, uint32_t To)
+        {
+            F.Blocks[From].Out = Block::Exit::jump;
+            F.Blocks[From].Succ[0] = To;
+            link(From, To);
+        }
+
+        // The false edge is set by the caller, when that block is made
+        void branch(uint32_t From, uint32_t Cond, uint32_t True)
+        {
+            auto& B = F.Blocks[From];
+            B.Out = Block::Exit::branch;
+            B.Cond = Cond;
+            B.Succ[0] = True;
+            link(From, True);
+        }
+
+        void otherwise(uint32_t From, uint32_t False)
+        {
+            F.Blocks[From].Succ[1] = False;
+            link(From, False);
+        }
+
+        void write(uint32_t Slot, uint32_t V, uint32_t B) { Defs[B][Slot] = V; }
+
+        uint32_t read(uint32_t Slot, uint32_t B)
+        {
+            if (Slot >= K.Slots || ++Depth > MaxDepth)
+            {
+                Failed = true;
+                Depth--;
+                return F.undef();
+            }
+            auto V = Defs[B][Slot];
+            if (V != None)
+                V = F.find(V);
+            else if (!Sealed[B])
+            {
+                V = phi(B);
+                Incomplete[B].push_back({ Slot, V });
+            }
+            else if (F.Blocks[B].Preds.size() == 1)
+                V = read(Slot, F.Blocks[B].Preds[0]);
+            else if (F.Blocks[B].Preds.empty()) // never stored
+                V = F.undef();
+            else
+            {
+                V = phi(B);
+                write(Slot, V, B); // loops end here
+                V = operands(Slot, V);
+            }
+            write(Slot, V, B);
+            Depth--;
+            return V;
+        }
+
+        uint32_t operands(uint32_t Slot, uint32_t Phi)
+        {
+            auto B = F.Insts[Phi].Block;
+            for (size_t i = 0; i < F.Blocks[B].Preds.size(); i++)
+            {
+                auto V = read(Slot, F.Blocks[B].Preds[i]);
+                F.Insts[Phi].Args.push_back(V);
+                if (F.Insts[Phi].K == Kind::none)
+                    F.Insts[Phi].K = F.Insts[V].K;
+            }
+            // Of one value but itself
+            uint32_t Same = None;
+            for (auto A : F.Insts[Phi].Args)
+            {
+                A = F.find(A);
+                if (A == Same || A == Phi)
+                    continue;
+                if (Same != None)
+                    return Phi;
+                Same = A;
+            }
+            if (Same == None)
+                Same = F.undef();
+            F.replace(Phi, Same);
+            return Same;
+        }
+
+        void seal(uint32_t B)
+        {
+            Sealed[B] = true;
+            auto Phis = std::move(Incomplete[B]);
+            Incomplete[B].clear();
+            for (auto& P : Phis)
+                operands(P.first, P.second);
+        }
+
+        uint32_t value(uint32_t i)
+        {
+            const Numeric::Node& N = K.Nodes[i];
+            if (N.Code == Op::constant)
+            {
+                auto V = inst(Op::constant);
+                F.Insts[V].Imm = N.Imm;
+                return V;
+            }
+            if (N.Code == Op::load)
+                return read(N.A, Cur);
+            if (!pure(N.Code) || ++Depth > MaxDepth)
+            {
+                Failed = true;
+                return F.undef();
+            }
+            auto A = value(N.A);
+            typed(A, operand_kind(N.Code));
+            auto B = None;
+            if (!unary(N.Code))
+            {
+                B = value(N.B);
+                typed(B, operand_kind(N.Code));
+            }
+            Depth--;
+            return inst(N.Code, A, B);
+        }
+
+        void statement(uint32_t i)
+        {
+            if (i == None || Cur == None || Failed)
+                return;
+            const Numeric::Node& N = K.Nodes[i];
+            switch (N.Code)
+            {
+                case Op::seq:
+                    for (uint32_t j = 0; j < N.B; j++)
+                        statement(K.Lists[N.A + j]);
+                    return;
+                case Op::store:
+                    write(N.A, value(N.B), Cur);
+                    return;
+                case Op::eval:
+                    value(N.A);
+                    return;
+                case Op::if_else:
+                {
+                    auto From = Cur;
+                    branch(From, value(N.A), block());
+                    Cur = F.Blocks[From].Succ[0];
+                    seal(Cur);
+                    statement(N.B);
+                    auto Then = Cur, Else = From;
+                    if (N.C != None)
+                    {
+                        otherwise(From, Cur = block());
+                        seal(Cur);
+                        statement(N.C);
+                        Else = Cur;
+                    }
+                    auto Join = block();
+                    if (N.C == None)
+                        otherwise(From, Join);
+                    else if (Else != None)
+                        jump(Else, Join);
+                    if (Then != None)
+                        jump(Then, Join);
+                    seal(Join);
+                    Cur = F.Blocks[Join].Preds.empty() ? None : Join;
+                    return;
+                }
+                case Op::while_loop: case Op::for_loop:
+                {
+                    // while: head (cond) -> body -> head
+                    // for:   init, head (cond) -> body -> step -> head
+                    bool For = N.Code == Op::for_loop;
+                    if (For)
+                        statement(N.A);
+                    auto Pre = Cur, Head = block();
+                    jump(Pre, Head);
+                    Cur = Head;
+                    branch(Head, value(N.B), block());
+                    Cur = F.Blocks[Head].Succ[0];
+                    seal(Cur);
+                    Loops.emplace_back();
+                    statement(N.C);
+                    if (For)
+                    {
+                        auto Step = block();
+                        if (Cur != None)
+                            jump(Cur, Step);
+                        for (auto B : Loops.back().Continues)
+                            jump(B, Step);
+                        seal(Step);
+                        Cur = F.Blocks[Step].Preds.empty() ? None : Step;
+                        statement(N.D);
+                    }
+                    else
+                        for (auto B : Loops.back().Continues)
+                            jump(B, Head);
+                    if (Cur != None)
+                        jump(Cur, Head);
+                    seal(Head);
+                    auto Exit = block();
+                    otherwise(Head, Exit);
+                    for (auto B : Loops.back().Breaks)
+                        jump(B, Exit);
+                    Loops.pop_back();
+                    seal(Exit);
+                    F.Loops.push_back({ Pre, Head, Exit, Head, Exit });
+                    Cur = Exit;
+                    return;
+                }
+                case Op::do_while_loop:
+                {
+                    // body -> cond -> body
+                    auto Pre = Cur, Body = block();
+                    jump(Pre, Body);
+                    Cur = Body;
+                    Loops.emplace_back();
+                    statement(N.C);
+                    auto Cond = block();
+                    if (Cur != None)
+                        jump(Cur, Cond);
+                    for (auto B : Loops.back().Continues)
+                        jump(B, Cond);
+                    seal(Cond);
+                    bool Turns = !F.Blocks[Cond].Preds.empty() && N.B != None;
+                    if (Turns)
+                    {
+                        Cur = Cond;
+                        branch(Cond, value(N.B), Body);
+                    }
+                    seal(Body);
+                    auto Exit = block();
+                    if (Turns)
+                        otherwise(Cond, Exit);
+                    else if (!F.Blocks[Cond].Preds.empty())
+                        jump(Cond, Exit);
+                    for (auto B : Loops.back().Breaks)
+                        jump(B, Exit);
+                    Loops.pop_back();
+                    seal(Exit);
+                    F.Loops.push_back({ Pre, Body, Exit, Body, Exit });
+                    Cur = F.Blocks[Exit].Preds.empty() ? None : Exit;
+                    return;
+                }
+                case Op::ret:
+                {
+                    auto V = value(N.A);
+                    typed(V, K.Result);
+                    F.Blocks[Cur].Out = Block::Exit::ret;
+                    F.Blocks[Cur].Value = V;
+                    Cur = None;
+                    return;
+                }
+                case Op::brk: case Op::cont:
+                    if (Loops.empty())
+                    {
+                        Failed = true;
+                        return;
+                    }
+                    (N.Code == Op::brk ? Loops.back().Breaks : Loops.back().Continues).push_back(Cur);
+                    Cur = None;
+                    return;
+                default:
+                    value(i);
+                    return;
+            }
+        }
+    };
+}
+
+std::unique_ptr<FunctionImpl> FunctionImpl::build(const Numeric::KernelImpl& K, const std::string& Name)
+{
+    auto F = std::make_unique<FunctionImpl>();
+    F->Name = Name;
+    BuilderImpl B(*F, K);
+    B.build();
+    if (B.Failed)
+        return nullptr;
+    return F;
+}
+/* ++ SSA construction ++ */
+
+uint32_t FunctionImpl::find(uint32_t V)
+{
+    if (V == None)
+        return V;
+    auto R = V;
+    while (Forward[R] != None)
+        R = Forward[R];
+    while (V != R)
+    {
+        auto Next = Forward[V];
+        Forward[V] = R;
+        V = Next;
+    }
+    return R;
+}
+
+void FunctionImpl::replace(uint32_t V, uint32_t By)
+{
+    if (V == By)
+        return;
+    Forward[V] = By;
+    Insts[V].Dead = true;
+}
+
+void FunctionImpl::resolve()
+{
+    for (auto& I : Insts)
+        if (!I.Dead)
+            each_operand(I, [&](uint32_t& V) { V = find(V); });
+    for (auto& B : Blocks)
+    {
+        B.Cond = find(B.Cond);
+        B.Value = find(B.Value);
+        B.Insts.erase(std::remove_if(B.Insts.begin(), B.Insts.end(), [&](uint32_t i) { return Insts[i].Dead; }), B.Insts.end());
+    }
+}
+
+void FunctionImpl::simplify_phis()
+{
+    for (bool Changed = true; Changed; )
+    {
+        Changed = false;
+        for (uint32_t i = 0; i < Insts.size(); i++)
+        {
+            if (Insts[i].Dead || Insts[i].Code != Op::phi)
+                continue;
+            uint32_t Same = None;
+            bool Trivial = true;
+            for (auto A : Insts[i].Args)
+            {
+                A = find(A);
+                if (A == Same || A == i)
+                    continue;
+                if (Same != None)
+                {
+                    Trivial = false;
+                    break;
+                }
+                Same = A;
+            }
+            if (!Trivial)
+                continue;
+            replace(i, Same != None ? Same : undef());
+            Changed = true;
+        }
+    }
+    resolve();
+}
+
+// Constants are at the start of the entry, where they come before every use
+uint32_t FunctionImpl::constant(Value Imm, Kind Of)
+{
+    Inst I;
+    I.Code = Op::constant;
+    I.Imm = Imm;
+    I.K = Of;
+    I.Block = 0;
+    Insts.push_back(I);
+    Forward.push_back(None);
+    Blocks[0].Insts.insert(Blocks[0].Insts.begin(), Insts.size() - 1);
+    return Insts.size() - 1;
+}
+
+uint32_t FunctionImpl::undef()
+{
+    if (Undef == None)
+        Undef = constant({ 0 }, Kind::none);
+    return Undef;
+}
+
+void FunctionImpl::remove_pred(uint32_t B, uint32_t Pred)
+{
+    auto& Preds = Blocks[B].Preds;
+    for (size_t k = 0; k < Preds.size(); k++)
+    {
+        if (Preds[k] != Pred)
+            continue;
+        Preds.erase(Preds.begin() + k);
+        for (auto i : Blocks[B].Insts)
+            if (Insts[i].Code == Op::phi && !Insts[i].Dead)
+                Insts[i].Args.erase(Insts[i].Args.begin() + k);
+        return;
+    }
+}
+
+// The true edge is taken last, so a branch is followed by its true block
+std::vector<uint32_t> FunctionImpl::order() const
+{
+    std::vector<uint32_t> Post;
+    std::vector<uint8_t> Seen(Blocks.size());
+    std::vector<std::pair<uint32_t, int>> Stack{ { 0, 0 } };
+    Seen[0] = 1;
+    while (!Stack.empty())
+    {
+        auto B = Stack.back().first;
+        auto& Bl = Blocks[B];
+        int Edges = Bl.Out == Block::Exit::jump ? 1 : Bl.Out == Block::Exit::branch ? 2 : 0;
+        int Next = Stack.back().second++;
+        if (Next < Edges)
+        {
+            auto S = Bl.Succ[Edges - 1 - Next];
+            if (!Seen[S])
+            {
+                Seen[S] = 1;
+                Stack.push_back({ S, 0 });
+            }
+            continue;
+        }
+        Post.push_back(B);
+        Stack.pop_back();
+    }
+    std::reverse(Post.begin(), Post.end());
+    return Post;
+}
+
+// Cooper, Harvey and Kennedy, "A Simple, Fast Dominance Algorithm"
+std::vector<uint32_t> FunctionImpl::dominators() const
+{
+    auto RPO = order();
+    std::vector<uint32_t> Index(Blocks.size(), None), Idom(Blocks.size(), None);
+    for (size_t i = 0; i < RPO.size(); i++)
+        Index[RPO[i]] = i;
+    Idom[0] = 0;
+    auto intersect = [&](uint32_t A, uint32_t B) {
+        while (A != B)
+        {
+            while (Index[A] > Index[B])
+                A = Idom[A];
+            while (Index[B] > Index[A])
+                B = Idom[B];
+        }
+        return A;
+    };
+    for (bool Changed = true; Changed; )
+    {
+        Changed = false;
+        for (size_t i = 1; i < RPO.size(); i++)
+        {
+            auto B = RPO[i];
+            uint32_t New = None;
+            for (auto P : Blocks[B].Preds)
+            {
+                if (Index[P] == None || Idom[P] == None)
+                    continue;
+                New = New == None ? P : intersect(P, New);
+            }
+            if (Idom[B] != New)
+            {
+                Idom[B] = New;
+                Changed = true;
+            }
+        }
+    }
+    return Idom;
+}
+
+/* -- Passes -- */
+// Wegman and Zadeck, "Constant Propagation with Conditional Branches". A
+// value is unknown (not yet seen, or undefined), one constant, or varying;
+// only the edges found to be taken are followed.
+void FunctionImpl::sccp()
+{
+    enum class Cell : uint8_t { top, constant, bottom };
+    std::vector<Cell> State(Insts.size(), Cell::top);
+    std::vector<Value> Val(Insts.size(), Value{ 0 });
+    std::vector<uint8_t> Live(Blocks.size()), Edge(Blocks.size() * 2);
+    std::vector<std::vector<uint32_t>> Users(Insts.size()), Branches(Insts.size());
+    for (uint32_t i = 0; i < Insts.size(); i++)
+        if (!Insts[i].Dead)
+            each_operand(Insts[i], [&](uint32_t& V) { Users[V].push_back(i); });
+    for (uint32_t b = 0; b < Blocks.size(); b++)
+        if (Blocks[b].Out == Block::Exit::branch)
+            Branches[Blocks[b].Cond].push_back(b);
+
+    std::vector<std::pair<uint32_t, int>> Flow; // edges newly taken
+    std::vector<uint32_t> Work;                 // values that changed
+    auto taken = [&](uint32_t From, uint32_t To) {
+        auto& B = Blocks[From];
+        return (B.Succ[0] == To && Edge[From * 2]) || (B.Succ[1] == To && Edge[From * 2 + 1]);
+    };
+    auto exits = [&](uint32_t B) {
+        auto& Bl = Blocks[B];
+        if (Bl.Out == Block::Exit::jump)
+            Flow.push_back({ B, 0 });
+        else if (Bl.Out == Block::Exit::branch)
+        {
+            auto C = Bl.Cond;
+            if (State[C] == Cell::constant)
+                Flow.push_back({ B, Val[C].I ? 0 : 1 });
+            else
+            {
+                Flow.push_back({ B, 0 });
+                Flow.push_back({ B, 1 });
+            }
+        }
+    };
+    auto visit = [&](uint32_t i) {
+        auto& I = Insts[i];
+        if (I.Dead || !Live[I.Block] || State[i] == Cell::bottom)
+            return;
+        Cell C = Cell::top;
+        Value V = { 0 };
+        if (I.Code == Op::constant)
+        {
+            if (i != Undef)
+            {
+                C = Cell::constant;
+                V = I.Imm;
+            }
+        }
+        else if (I.Code == Op::phi)
+        {
+            auto& Preds = Blocks[I.Block].Preds;
+            for (size_t k = 0; k < Preds.size() && C != Cell::bottom; k++)
+            {
+                auto A = I.Args[k];
+                if (!taken(Preds[k], I.Block) || State[A] == Cell::top)
+                    continue;
+                if (C == Cell::top)
+                {
+                    C = State[A];
+                    V = Val[A];
+                }
+                else if (State[A] == Cell::bottom || Val[A].I != V.I)
+                    C = Cell::bottom;
+            }
+        }
+        else if (pure(I.Code))
+        {
+            Cell L = State[I.A], R = unary(I.Code) ? Cell::constant : State[I.B];
+            if (L == Cell::bottom || R == Cell::bottom)
+                C = Cell::bottom;
+            else if (L == Cell::constant && R == Cell::constant)
+                C = fold(I.Code, Val[I.A], unary(I.Code) ? Value{ 0 } : Val[I.B], V) ? Cell::constant : Cell::bottom;
+        }
+        else
+            C = Cell::bottom;
+        if (C == Cell::constant && State[i] == Cell::constant && V.I != Val[i].I)
+            C = Cell::bottom;
+        if (C == State[i])
+            return;
+        State[i] = C;
+        Val[i] = V;
+        Work.insert(Work.end(), Users[i].begin(), Users[i].end());
+        for (auto B : Branches[i])
+            if (Live[B])
+                exits(B);
+    };
+
+    Live[0] = 1;
+    for (auto i : Blocks[0].Insts)
+        visit(i);
+    exits(0);
+    while (!Flow.empty() || !Work.empty())
+    {
+        if (Work.empty())
+        {
+            auto [From, Which] = Flow.back();
+            Flow.pop_back();
+            if (Edge[From * 2 + Which])
+                continue;
+            Edge[From * 2 + Which] = 1;
+            auto To = Blocks[From].Succ[Which];
+            if (Live[To])
+            {
+                for (auto i : Blocks[To].Insts)
+                    if (Insts[i].Code == Op::phi)
+                        visit(i);
+                continue;
+            }
+            Live[To] = 1;
+            for (auto i : Blocks[To].Insts)
+                visit(i);
+            exits(To);
+            continue;
+        }
+        auto i = Work.back();
+        Work.pop_back();
+        visit(i);
+    }
+
+    // Branches on constants become jumps, blocks never reached go
+    for (uint32_t b = 0; b < Blocks.size(); b++)
+    {
+        auto& B = Blocks[b];
+        if (!Live[b])
+        {
+            B.Dead = true;
+            for (auto i : B.Insts)
+                Insts[i].Dead = true;
+            continue;
+        }
+        if (B.Out != Block::Exit::branch || State[B.Cond] != Cell::constant)
+            continue;
+        int Keep = Val[B.Cond].I ? 0 : 1;
+        auto To = B.Succ[Keep], Gone = B.Succ[1 - Keep];
+        B.Out = Block::Exit::jump;
+        B.Succ[0] = To;
+        B.Succ[1] = None;
+        B.Cond = None;
+        if (Gone != To)
+            remove_pred(Gone, b);
+    }
+    for (uint32_t b = 0; b < Blocks.size(); b++)
+    {
+        if (Blocks[b].Dead)
+            continue;
+        for (size_t k = Blocks[b].Preds.size(); k-- > 0; )
+            if (Blocks[Blocks[b].Preds[k]].Dead)
+                remove_pred(b, Blocks[b].Preds[k]);
+    }
+    auto Count = Insts.size();
+    for (uint32_t i = 0; i < Count; i++)
+    {
+        if (Insts[i].Dead || State[i] != Cell::constant || Insts[i].Code == Op::constant)
+            continue;
+        replace(i, constant(Val[i], Insts[i].K));
+    }
+    resolve();
+    simplify_phis();
+}
+
+// An operation that computes what one that dominates it computed is that
+// one: values are numbered down the dominator tree, with what is known in
+// the blocks above. Constants all go to the entry.
+void FunctionImpl::gvn()
+{
+    for (uint32_t b = 1; b < Blocks.size(); b++)
+    {
+        auto& L = Blocks[b].Insts;
+        for (size_t j = 0; j < L.size(); )
+        {
+            if (Insts[L[j]].Code != Op::constant)
+            {
+                j++;
+                continue;
+            }
+            Insts[L[j]].Block = 0;
+            Blocks[0].Insts.insert(Blocks[0].Insts.begin(), L[j]);
+            L.erase(L.begin() + j);
+        }
+    }
+
+    auto Idom = dominators();
+    auto RPO = order();
+    std::vector<std::vector<uint32_t>> Children(Blocks.size());
+    for (size_t i = 1; i < RPO.size(); i++)
+        Children[Idom[RPO[i]]].push_back(RPO[i]);
+
+    // Operation, operands (a phi is of its block), constant
+    using Key = std::tuple<Op, uint32_t, uint32_t, long long, std::vector<uint32_t>>;
+    std::map<Key, uint32_t> Known;
+    std::vector<std::vector<std::map<Key, uint32_t>::iterator>> Added(Blocks.size());
+    std::vector<std::pair<uint32_t, bool>> Stack{ { 0, false } };
+    while (!Stack.empty())
+    {
+        auto [B, Done] = Stack.back();
+        if (Done)
+        {
+            for (auto It : Added[B])
+                Known.erase(It);
+            Stack.pop_back();
+            continue;
+        }
+        Stack.back().second = true;
+        for (auto i : Blocks[B].Insts)
+        {
+            auto& I = Insts[i];
+            if (I.Dead || i == Undef)
+                continue;
+            each_operand(I, [&](uint32_t& V) { V = find(V); });
+            if (commutative(I.Code) && I.A > I.B)
+                std::swap(I.A, I.B);
+            Key K = I.Code == Op::phi ? Key{ I.Code, I.Block, None, 0, I.Args }
+                  : I.Code == Op::constant ? Key{ I.Code, None, None, I.Imm.I, {} }
+                  : Key{ I.Code, I.A, I.B, 0, {} };
+            auto [It, New] = Known.emplace(std::move(K), i);
+            if (New)
+            {
+                Added[B].push_back(It);
+                continue;
+            }
+            // Constants of the same bits are one, whatever the kind
+            if (Insts[It->second].K == Kind::none)
+                Insts[It->second].K = I.K;
+            replace(i, It->second);
+        }
+        for (auto C : Children[B])
+            Stack.push_back({ C, false });
+    }
+    resolve();
+    simplify_phis();
+}
+
+// Inner loops first, so what leaves one may leave the next one out. An
+// operation moves when its operands come from outside the loop, to the end
+// of the preheader: it then runs once, even if the loop does not turn.
+// Divisions and remainders of integers may trap, they stay.
+void FunctionImpl::licm()
+{
+    auto RPO = order();
+    for (auto& L : Loops)
+    {
+        auto& Pre = Blocks[L.Preheader];
+        if (Blocks[L.Header].Dead || Pre.Dead || Pre.Out != Block::Exit::jump || Pre.Succ[0] != L.Header)
+            continue;
+        auto inside = [&](uint32_t V) { return Insts[V].Block >= L.Begin && Insts[V].Block < L.End; };
+        for (auto B : RPO)
+        {
+            if (B < L.Begin || B >= L.End)
+                continue;
+            auto& Is = Blocks[B].Insts;
+            for (size_t j = 0; j < Is.size(); )
+            {
+                auto& I = Insts[Is[j]];
+                if (!pure(I.Code) || I.Code == Op::div_i || I.Code == Op::mod_i
+                    || inside(I.A) || (!unary(I.Code) && inside(I.B)))
+                {
+                    j++;
+                    continue;
+                }
+                I.Block = L.Preheader;
+                Pre.Insts.push_back(Is[j]);
+                Is.erase(Is.begin() + j);
+            }
+        }
+    }
+}
+
+// What no branch or return needs, through any other value, goes
+void FunctionImpl::dce()
+{
+    std::vector<uint8_t> Used(Insts.size());
+    std::vector<uint32_t> Work;
+    auto use = [&](uint32_t V) {
+        if (V != None && !Used[V])
+        {
+            Used[V] = 1;
+            Work.push_back(V);
+        }
+    };
+    for (auto& B : Blocks)
+    {
+        if (B.Dead)
+            continue;
+        if (B.Out == Block::Exit::branch)
+            use(B.Cond);
+        else if (B.Out == Block::Exit::ret)
+            use(B.Value);
+    }
+    while (!Work.empty())
+    {
+        auto V = Work.back();
+        Work.pop_back();
+        each_operand(Insts[V], [&](uint32_t& A) { use(A); });
+    }
+    for (auto& B : Blocks)
+        for (auto i : B.Insts)
+            if (!Used[i])
+                Insts[i].Dead = true;
+    resolve();
+}
+/* ++ Passes ++ */
+
+std::string FunctionImpl::dump() const
+{
+    std::string S = "function " + Name + "(" + std::to_string(Params) + ")\n";
+    auto name = [](uint32_t V) { return "v" + std::to_string(V); };
+    for (auto B : order())
+    {
+        auto& Bl = Blocks[B];
+        S += "b" + std::to_string(B) + ":";
+        if (!Bl.Preds.empty())
+        {
+            S += " ; from";
+            for (auto P : Bl.Preds)
+                S += " b" + std::to_string(P);
+        }
+        for (auto& L : Loops)
+            if (L.Header == B)
+                S += " ; loop, preheader b" + std::to_string(L.Preheader);
+        S += "\n";
+        for (auto i : Bl.Insts)
+        {
+            auto& I = Insts[i];
+            S += "  " + name(i) + " = ";
+            if (I.Code == Op::constant)
+                S += i == Undef ? "undef" : I.K == Kind::real ? std::to_string(I.Imm.D) : std::to_string(I.Imm.I);
+            else if (I.Code == Op::load)
+                S += "param " + std::to_string(I.A);
+            else
+            {
+                S += op_name(I.Code);
+                if (I.Code == Op::phi)
+                    for (auto A : I.Args)
+                        S += " " + name(A);
+                else
+                {
+                    S += " " + name(I.A);
+                    if (!unary(I.Code))
+                        S += " " + name(I.B);
+                }
+            }
+            S += "\n";
+        }
+        switch (Bl.Out)
+        {
+            case Block::Exit::jump:
+                S += "  jump b" + std::to_string(Bl.Succ[0]) + "\n";
+                break;
+            case Block::Exit::branch:
+                S += "  branch " + name(Bl.Cond) + " b" + std::to_string(Bl.Succ[0]) + " b" + std::to_string(Bl.Succ[1]) + "\n";
+                break;
+            case Block::Exit::ret:
+                S += "  ret " + name(Bl.Value) + "\n";
+                break;
+            default:
+                break;
+        }
+    }
+    return S;
+}
+
+/* -- Linear code -- */
+// Blocks in reverse post order, falling through where they can. A phi is a
+// register the edges into its block copy to, through temporaries when one
+// of them is read by another copy of the same edge.
+std::shared_ptr<const ProgramImpl> ProgramImpl::lower(const FunctionImpl& F)
+{
+    auto P = std::make_shared<ProgramImpl>();
+    auto& Code = P->Code;
+    auto RPO = F.order();
+    std::vector<uint32_t> Reg(F.Insts.size(), 0), Start(F.Blocks.size(), 0);
+    uint32_t Next = F.Params, Temps = 0;
+    for (auto B : RPO)
+        for (auto i : F.Blocks[B].Insts)
+            Reg[i] = F.Insts[i].Code == Op::load ? F.Insts[i].A : Next++;
+
+    auto emit = [&](Op O, uint32_t Dst = 0, uint32_t A = 0, uint32_t B = 0) {
+        Ins I;
+        I.Code = O;
+        I.Dst = Dst;
+        I.A = A;
+        I.B = B;
+        Code.push_back(I);
+        return Code.size() - 1;
+    };
+    // An empty block that only jumps on is skipped, unless the edge out of
+    // it has copies
+    auto thread = [&](uint32_t To) {
+        for (size_t n = 0; n < F.Blocks.size(); n++)
+        {
+            auto& B = F.Blocks[To];
+            if (!B.Insts.empty() || B.Out != Block::Exit::jump)
+                break;
+            auto& Next = F.Blocks[B.Succ[0]];
+            if (!Next.Insts.empty() && F.Insts[Next.Insts[0]].Code == Op::phi)
+                break;
+            To = B.Succ[0];
+        }
+        return To;
+    };
+    std::vector<std::pair<size_t, uint32_t>> Jumps; // to blocks, set once they are placed
+    auto jump = [&](uint32_t To) { Jumps.push_back({ emit(Op::jump), thread(To) }); };
+    // Copies of the edge, destination and source
+    auto copies = [&](uint32_t From, uint32_t To) {
+        std::vector<std::pair<uint32_t, uint32_t>> C;
+        auto& Preds = F.Blocks[To].Preds;
+        size_t k = std::find(Preds.begin(), Preds.end(), From) - Preds.begin();
+        for (auto i : F.Blocks[To].Insts)
+            if (F.Insts[i].Code == Op::phi && Reg[F.Insts[i].Args[k]] != Reg[i])
+                C.push_back({ Reg[i], Reg[F.Insts[i].Args[k]] });
+        return C;
+    };
+    auto place = [&](const std::vector<std::pair<uint32_t, uint32_t>>& C) {
+        bool Overlap = false;
+        for (auto& X : C)
+            for (auto& Y : C)
+                Overlap = Overlap || X.second == Y.first;
+        if (!Overlap)
+        {
+            for (auto& X : C)
+                emit(Op::copy, X.first, X.second);
+            return;
+        }
+        for (size_t j = 0; j < C.size(); j++)
+            emit(Op::copy, Next + j, C[j].second);
+        for (size_t j = 0; j < C.size(); j++)
+            emit(Op::copy, C[j].first, Next + j);
+        Temps = std::max<uint32_t>(Temps, C.size());
+    };
+
+    for (size_t n = 0; n < RPO.size(); n++)
+    {
+        auto B = RPO[n];
+        auto Following = n + 1 < RPO.size() ? RPO[n + 1] : None;
+        auto& Bl = F.Blocks[B];
+        Start[B] = Code.size();
+        for (auto i : Bl.Insts)
+        {
+            auto& I = F.Insts[i];
+            if (I.Code == Op::phi || I.Code == Op::load)
+                continue;
+            if (I.Code == Op::constant)
+                Code[emit(Op::constant, Reg[i])].Imm = I.Imm;
+            else
+                emit(I.Code, Reg[i], Reg[I.A], unary(I.Code) ? 0 : Reg[I.B]);
+        }
+        switch (Bl.Out)
+        {
+            case Block::Exit::ret:
+                emit(Op::ret, 0, Reg[Bl.Value]);
+                break;
+            case Block::Exit::jump:
+                place(copies(B, Bl.Succ[0]));
+                if (Bl.Succ[0] != Following)
+                    jump(Bl.Succ[0]);
+                break;
+            case Block::Exit::branch:
+            {
+                auto True = copies(B, Bl.Succ[0]), False = copies(B, Bl.Succ[1]);
+                auto Unless = emit(Op::jump_unless, 0, Reg[Bl.Cond]);
+                if (False.empty())
+                    Jumps.push_back({ Unless, thread(Bl.Succ[1]) });
+                place(True);
+                if (Bl.Succ[0] != Following || !False.empty())
+                    jump(Bl.Succ[0]);
+                if (False.empty())
+                    break;
+                Code[Unless].B = Code.size();
+                place(False);
+                if (Bl.Succ[1] != Following)
+                    jump(Bl.Succ[1]);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    for (auto& J : Jumps)
+    {
+        auto& I = Code[J.first];
+        (I.Code == Op::jump ? I.A : I.B) = Start[J.second];
+    }
+    P->Registers = Next + Temps;
+    return P;
+}
+
+Value ProgramImpl::run(const Value* Params, size_t Count) const
+{
+    // The registers are on the stack unless there are many
+    Value Small[64];
+    std::unique_ptr<Value[]> Large;
+    Value* R = Small;
+    if (Registers > 64)
+    {
+        Large.reset(new Value[Registers]);
+        R = Large.get();
+    }
+    for (size_t i = 0; i < Count; i++)
+        R[i] = Params[i];
+
+    const Ins* C = Code.data();
+    for (size_t Pc = 0; ; )
+    {
+        const Ins& I = C[Pc++];
+        switch (I.Code)
+        {
+            case Op::constant:    R[I.Dst] = I.Imm; break;
+            case Op::copy:        R[I.Dst] = R[I.A]; break;
+            case Op::jump:        Pc = I.A; break;
+            case Op::jump_unless: if (!R[I.A].I) Pc = I.B; break;
+            case Op::ret:         return R[I.A];
+
+            case Op::to_real:    R[I.Dst] = apply<Op::to_real>(R[I.A], R[I.B]); break;
+            case Op::to_integer: R[I.Dst] = apply<Op::to_integer>(R[I.A], R[I.B]); break;
+            case Op::add_i:      R[I.Dst] = apply<Op::add_i>(R[I.A], R[I.B]); break;
+            case Op::sub_i:      R[I.Dst] = apply<Op::sub_i>(R[I.A], R[I.B]); break;
+            case Op::mul_i:      R[I.Dst] = apply<Op::mul_i>(R[I.A], R[I.B]); break;
+            case Op::div_i:      R[I.Dst] = apply<Op::div_i>(R[I.A], R[I.B]); break;
+            case Op::mod_i:      R[I.Dst] = apply<Op::mod_i>(R[I.A], R[I.B]); break;
+            case Op::add_d:      R[I.Dst] = apply<Op::add_d>(R[I.A], R[I.B]); break;
+            case Op::sub_d:      R[I.Dst] = apply<Op::sub_d>(R[I.A], R[I.B]); break;
+            case Op::mul_d:      R[I.Dst] = apply<Op::mul_d>(R[I.A], R[I.B]); break;
+            case Op::div_d:      R[I.Dst] = apply<Op::div_d>(R[I.A], R[I.B]); break;
+            case Op::mod_d:      R[I.Dst] = apply<Op::mod_d>(R[I.A], R[I.B]); break;
+            case Op::lt_i:       R[I.Dst] = apply<Op::lt_i>(R[I.A], R[I.B]); break;
+            case Op::le_i:       R[I.Dst] = apply<Op::le_i>(R[I.A], R[I.B]); break;
+            case Op::gt_i:       R[I.Dst] = apply<Op::gt_i>(R[I.A], R[I.B]); break;
+            case Op::ge_i:       R[I.Dst] = apply<Op::ge_i>(R[I.A], R[I.B]); break;
+            case Op::eq_i:       R[I.Dst] = apply<Op::eq_i>(R[I.A], R[I.B]); break;
+            case Op::lt_d:       R[I.Dst] = apply<Op::lt_d>(R[I.A], R[I.B]); break;
+            case Op::le_d:       R[I.Dst] = apply<Op::le_d>(R[I.A], R[I.B]); break;
+            case Op::gt_d:       R[I.Dst] = apply<Op::gt_d>(R[I.A], R[I.B]); break;
+            case Op::ge_d:       R[I.Dst] = apply<Op::ge_d>(R[I.A], R[I.B]); break;
+            case Op::eq_d:       R[I.Dst] = apply<Op::eq_d>(R[I.A], R[I.B]); break;
+            case Op::shl:        R[I.Dst] = apply<Op::shl>(R[I.A], R[I.B]); break;
+            case Op::shr:        R[I.Dst] = apply<Op::shr>(R[I.A], R[I.B]); break;
+            case Op::bit_and:    R[I.Dst] = apply<Op::bit_and>(R[I.A], R[I.B]); break;
+            case Op::bit_or:     R[I.Dst] = apply<Op::bit_or>(R[I.A], R[I.B]); break;
+            case Op::bit_xor:    R[I.Dst] = apply<Op::bit_xor>(R[I.A], R[I.B]); break;
+            case Op::bit_not:    R[I.Dst] = apply<Op::bit_not>(R[I.A], R[I.B]); break;
+            case Op::not_i:      R[I.Dst] = apply<Op::not_i>(R[I.A], R[I.B]); break;
+            case Op::not_d:      R[I.Dst] = apply<Op::not_d>(R[I.A], R[I.B]); break;
+            case Op::truth_d:    R[I.Dst] = apply<Op::truth_d>(R[I.A], R[I.B]); break;
+            case Op::and_i:      R[I.Dst] = apply<Op::and_i>(R[I.A], R[I.B]); break;
+            case Op::and_d:      R[I.Dst] = apply<Op::and_d>(R[I.A], R[I.B]); break;
+            case Op::or_i:       R[I.Dst] = apply<Op::or_i>(R[I.A], R[I.B]); break;
+            case Op::or_d:       R[I.Dst] = apply<Op::or_d>(R[I.A], R[I.B]); break;
+            default:             break;
+        }
+    }
+}
+/* ++ Linear code ++ */
+
+std::shared_ptr<const ProgramImpl> IR::compile(const Numeric::KernelImpl& K, const std::string& Name)
+{
+    static const bool Off = getenv("TINYJS_NO_IR") != nullptr;
+    static const bool Dump = getenv("TINYJS_IR_DUMP") != nullptr;
+    if (Off)
+        return nullptr;
+    auto F = FunctionImpl::build(K, Name);
+    if (!F)
+        return nullptr;
+    F->sccp();
+    F->gvn();
+    F->licm();
+    F->dce();
+    if (Dump)
+        fprintf(stderr, "%s", F->dump().c_str());
+    return ProgramImpl::lower(*F);
+}
@@ -0,0 +1,127 @@
+#ifndef TINYJS_IR
+#define TINYJS_IR
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "numeric.h"
+
+// SSA form of numeric kernels, with optimization passes.
+//
+// A kernel (numeric.h) is the body of a FunctionAST lowered to typed
+// operations on slots. Here it becomes a control flow graph of basic
+// blocks in SSA form: every value is defined once by an operation of the
+// kernels, a parameter or a phi at a block where paths meet. Slots are
+// gone, so the passes see the data flow:
+//
+//   sccp   constants along the executable paths only, branches on them
+//          are folded and blocks no path reaches are dropped
+//   gvn    an operation computed again where an equal one dominates it is
+//          that one (common subexpressions, across blocks)
+//   licm   operations of a loop on values from outside it move to the
+//          block before the loop
+//   dce    operations nothing uses are dropped
+//
+// lower() turns the result into linear code on registers, the kernel then
+// runs it in place of its nodes. An integer division or remainder is never
+// moved into a path that did not run it. TINYJS_NO_IR keeps kernels on
+// their nodes, TINYJS_IR_DUMP prints each function after the passes.
+
+namespace IR
+{
+    using Numeric::Op;
+    using Numeric::Kind;
+    using Numeric::Value;
+
+    constexpr uint32_t None = UINT32_MAX;
+
+    // A value. A parameter is a load of its index, an undefined one a
+    // constant of no kind.
+    struct Inst
+    {
+        Op Code;
+        uint32_t A = None, B = None;
+        Value Imm = { 0 };
+        Kind K = Kind::none;
+        uint32_t Block = None;
+        std::vector<uint32_t> Args; // of a phi, one per predecessor of its block
+        bool Dead = false;
+    };
+
+    struct Block
+    {
+        enum class Exit : uint8_t { none, jump, branch, ret };
+        std::vector<uint32_t> Insts; // phis first
+        std::vector<uint32_t> Preds;
+        Exit Out = Exit::none;
+        uint32_t Cond = None;            // branch: Succ[0] if not zero, else Succ[1]
+        uint32_t Succ[2] = { None, None };
+        uint32_t Value = None;           // ret
+        bool Dead = false;
+    };
+
+    // A loop as it was built: its blocks are those from Begin up to End
+    // (its exit), the preheader only jumps to the header
+    struct Loop
+    {
+        uint32_t Preheader, Header, Exit, Begin, End;
+    };
+
+    class FunctionImpl
+    {
+    public:
+        std::string Name;
+        std::vector<Inst> Insts;
+        std::vector<Block> Blocks; // the first one is the entry
+        std::vector<Loop> Loops;   // inner ones first
+        size_t Params = 0;
+        Kind Result = Kind::none;
+
+        // Lowered from the nodes of K
+        static std::unique_ptr<FunctionImpl> build(const Numeric::KernelImpl& K, const std::string& Name);
+
+        void sccp();
+        void gvn();
+        void licm();
+        void dce();
+
+        std::string dump() const;
+        std::vector<uint32_t> order() const; // live blocks in reverse post order
+
+    private:
+        std::vector<uint32_t> Forward; // a value replaced by another one
+        uint32_t Undef = None;
+        uint32_t find(uint32_t V);
+        void replace(uint32_t V, uint32_t By);
+        void resolve();        // operands to what they were replaced by
+        void simplify_phis();  // phis of one value are that value
+        uint32_t constant(Value Imm, Kind K);
+        uint32_t undef();
+        std::vector<uint32_t> dominators() const; // immediate dominator of every live block
+        void remove_pred(uint32_t B, uint32_t Pred);
+        friend class BuilderImpl;
+    };
+
+    // Linear code on registers, the parameters are the first ones
+    class ProgramImpl
+    {
+    public:
+        struct Ins
+        {
+            Op Code;
+            uint32_t Dst = 0, A = 0, B = 0;
+            Value Imm = { 0 };
+        };
+        std::vector<Ins> Code;
+        uint32_t Registers = 0;
+
+        static std::shared_ptr<const ProgramImpl> lower(const FunctionImpl& F);
+        Value run(const Value* Params, size_t Count) const;
+    };
+
+    // The optimized program of K, nullptr if TINYJS_NO_IR is set
+    std::shared_ptr<const ProgramImpl> compile(const Numeric::KernelImpl& K, const std::string& Name);
+}
+
+#endif
@@ -0,0 +1,579 @@
+#include "json.h"
+#include "kernel.h"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+using namespace Json;
+using namespace AST;
+
+/* -- Parser -- */
+namespace
+{
+    thread_local std::vector<std::vector<std::string>> KeyScratch;
+    thread_local std::vector<std::vector<Expr>> ValueScratch;
+}
+
+ParserImpl::ParserImpl(std::string_view Text)
+    : Begin(Text.data()), P(Text.data()), End(Text.data() + Text.size()), Keys(KeyScratch), Values(ValueScratch) { }
+
+bool ParserImpl::parse(Expr& Out)
+{
+    skip_space();
+    if (!value(Out))
+    {
+        // Let go of what the open containers held
+        for (auto& V : Values)
+            V.clear();
+        return false;
+    }
+    skip_space();
+    if (P != End)
+        return unexpected();
+    return true;
+}
+
+bool ParserImpl::fail(const std::string& What)
+{
+    Err = What + " at position " + std::to_string(P - Begin);
+    return false;
+}
+
+bool ParserImpl::unexpected()
+{
+    if (P == End)
+        return fail("Unexpected end of JSON input");
+    return fail(std::string("Unexpected token ") + *P + " in JSON");
+}
+
+void ParserImpl::skip_space()
+{
+    while (P != End && (*P == ' ' || *P == '\n' || *P == '\r' || *P == '\t'))
+        P++;
+}
+
+bool ParserImpl::value(Expr& Out)
+{
+    if (P == End)
+        return unexpected();
+    switch (*P)
+    {
+        case '{': return object(Out);
+        case '[': return array(Out);
+        case '"':
+        {
+            std::string S;
+            if (!string(S))
+                return false;
+            Out = GC::make_value<StringValueExprAST>(std::move(S));
+            return true;
+        }
+        case 't':
+            if (!word("true", 4)) return false;
+            Out = GC::make_value<IntegerValueExprAST>(1);
+            return true;
+        case 'f':
+            if (!word("false", 5)) return false;
+            Out = GC::make_value<IntegerValueExprAST>(0);
+            return true;
+        case 'n':
+            if (!word("null", 4)) return false;
+            Out = null_value();
+            return true;
+        default:
+            if (*P == '-' || (*P >= '0' && *P <= '9'))
+                return number(Out);
+            return unexpected();
+    }
+}
+
+bool ParserImpl::word(const char* Word, size_t Len)
+{
+    if ((size_t)(End - P) < Len || memcmp(P, Word, Len))
+        return unexpected();
+    P += Len;
+    return true;
+}
+
+void ParserImpl::enter_scratch()
+{
+    if ((size_t)Depth >= Values.size())
+    {
+        Keys.resize(Depth + 1);
+        Values.resize(Depth + 1);
+    }
+    Keys[Depth].clear();
+    Values[Depth].clear();
+}
+
+// object ::= '{' (string ':' value (',' string ':' value)*)? '}'
+bool ParserImpl::object(Expr& Out)
+{
+    if (++Depth > MaxDepth)
+        return fail("JSON nested too deep");
+    P++; // eat '{'
+    enter_scratch();
+    skip_space();
+    if (P != End && *P == '}')
+        P++;
+    else
+    {
+        while (true)
+        {
+            if (P == End || *P != '"')
+                return unexpected();
+            std::string Key;
+            if (!string(Key))
+                return false;
+            skip_space();
+            if (P == End || *P != ':')
+                return unexpected();
+            P++;
+            skip_space();
+            Expr V;
+            if (!value(V))
+                return false;
+            Keys[Depth].push_back(std::move(Key));
+            Values[Depth].push_back(std::move(V));
+            skip_space();
+            if (P != End && *P == ',')
+            {
+                P++;
+                skip_space();
+                continue;
+            }
+            if (P != End && *P == '}')
+            {
+                P++;
+                break;
+            }
+            return unexpected();
+        }
+    }
+
+    auto Obj = GC::make_traced<ObjectValueExprAST>();
+    auto& K = Keys[Depth];
+    auto& V = Values[Depth];
+    Obj->Keys.reserve(K.size());
+    Obj->Values.reserve(K.size());
+    for (size_t i = 0; i < K.size(); i++)
+        Obj->set(std::move(K[i]), std::move(V[i])); // a repeated key keeps the last value
+    K.clear();
+    V.clear();
+    Depth--;
+    Out = Obj;
+    return true;
+}
+
+// array ::= '[' (value (',' value)*)? ']'
+bool ParserImpl::array(Expr& Out)
+{
+    if (++Depth > MaxDepth)
+        return fail("JSON nested too deep");
+    P++; // eat '['
+    enter_scratch();
+    skip_space();
+    if (P != End && *P == ']')
+        P++;
+    else
+    {
+        while (true)
+        {
+            Expr V;
+            if (!value(V))
+                return false;
+            Values[Depth].push_back(std::move(V));
+            skip_space();
+            if (P != End && *P == ',')
+            {
+                P++;
+                skip_space();
+                continue;
+            }
+            if (P != End && *P == ']')
+            {
+                P++;
+                break;
+            }
+            return unexpected();
+        }
+    }
+
+    auto Arr = GC::make_traced<ArrayValueExprAST>();
+    auto& V = Values[Depth];
+    Arr->reserve(V.size());
+    for (auto& E : V)
+        Arr->push(E);
+    V.clear();
+    Depth--;
+    Out = Arr;
+    return true;
+}
+
+// Appends the decoded string, P is on the opening quote
+bool ParserImpl::string(std::string& Out)
+{
+    auto& K = Kernel::kernels();
+    P++; // eat '"'
+    while (true)
+    {
+        size_t Plain = K.string_span(P, End - P);
+        Out.append(P, Plain);
+        P += Plain;
+        if (P == End)
+            return fail("Unterminated string in JSON");
+        if (*P == '"')
+        {
+            P++;
+            return true;
+        }
+        if (*P != '\\')
+            return fail("Bad control character in string literal in JSON");
+        if (!escape(Out))
+            return false;
+    }
+}
+
+static void append_utf8(std::string& Out, uint32_t C)
+{
+    if (C < 0x80)
+        Out.push_back((char)C);
+    else if (C < 0x800)
+    {
+        Out.push_back((char)(0xc0 | (C >> 6)));
+        Out.push_back((char)(0x80 | (C & 0x3f)));
+    }
+    else if (C < 0x10000)
+    {
+        Out.push_back((char)(0xe0 | (C >> 12)));
+        Out.push_back((char)(0x80 | ((C >> 6) & 0x3f)));
+        Out.push_back((char)(0x80 | (C & 0x3f)));
+    }
+    else
+    {
+        Out.push_back((char)(0xf0 | (C >> 18)));
+        Out.push_back((char)(0x80 | ((C >> 12) & 0x3f)));
+        Out.push_back((char)(0x80 | ((C >> 6) & 0x3f)));
+        Out.push_back((char)(0x80 | (C & 0x3f)));
+    }
+}
+
+static bool read_hex4(const char* S, uint32_t& C)
+{
+    C = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        char h = S[i];
+        C <<= 4;
+        if (h >= '0' && h <= '9')      C |= h - '0';
+        else if (h >= 'a' && h <= 'f') C |= h - 'a' + 10;
+        else if (h >= 'A' && h <= 'F') C |= h - 'A' + 10;
+        else return false;
+    }
+    return true;
+}
+
+// P is on the backslash
+bool ParserImpl::escape(std::string& Out)
+{
+    if (End - P < 2)
+        return fail("Unterminated string in JSON");
+    char E = P[1];
+    P += 2;
+    switch (E)
+    {
+        case '"':  Out.push_back('"');  return true;
+        case '\\': Out.push_back('\\'); return true;
+        case '/':  Out.push_back('/');  return true;
+        case 'b':  Out.push_back('\b'); return true;
+        case 'f':  Out.push_back('\f'); return true;
+        case 'n':  Out.push_back('\n'); return true;
+        case 'r':  Out.push_back('\r'); return true;
+        case 't':  Out.push_back('\t'); return true;
+        case 'u':
+        {
+            uint32_t C;
+            if (End - P < 4 || !read_hex4(P, C))
+                return fail("Bad Unicode escape in JSON");
+            P += 4;
+            // A surrogate pair is one code point, a lone surrogate is kept as is
+            uint32_t Low;
+            if (C >= 0xd800 && C < 0xdc00 && End - P >= 6 && P[0] == '\\' && P[1] == 'u'
+                && read_hex4(P + 2, Low) && Low >= 0xdc00 && Low < 0xe000)
+            {
+                C = 0x10000 + ((C - 0xd800) << 10) + (Low - 0xdc00);
+                P += 6;
+            }
+            append_utf8(Out, C);
+            return true;
+        }
+        default:
+            P--;
+            return fail(std::string("Bad escaped character ") + E + " in JSON");
+    }
+}
+
+// number ::= '-'? ('0' | [1-9][0-9]*) ('.' [0-9]+)? ([eE] [+-]? [0-9]+)?
+bool ParserImpl::number(Expr& Out)
+{
+    const char* Start = P;
+    if (*P == '-')
+        P++;
+    if (P == End || *P < '0' || *P > '9')
+        return unexpected();
+    if (*P == '0')
+        P++;
+    else
+        while (P != End && *P >= '0' && *P <= '9')
+            P++;
+
+    bool Integral = true;
+    if (P != End && *P == '.')
+    {
+        Integral = false;
+        P++;
+        if (P == End || *P < '0' || *P > '9')
+            return unexpected();
+        while (P != End && *P >= '0' && *P <= '9')
+            P++;
+    }
+    if (P != End && (*P == 'e' || *P == 'E'))
+    {
+        Integral = false;
+        P++;
+        if (P != End && (*P == '+' || *P == '-'))
+            P++;
+        if (P == End || *P < '0' || *P > '9')
+            return unexpected();
+        while (P != End && *P >= '0' && *P <= '9')
+            P++;
+    }
+
+    if (Integral)
+    {
+        IntegerValueExprAST::value_type I;
+        auto R = std::from_chars(Start, P, I);
+        if (R.ec == std::errc() && R.ptr == P)
+        {
+            Out = GC::make_value<IntegerValueExprAST>(I);
+            return true;
+        }
+        // Too large for an integer, read it as a float
+    }
+    double D;
+    auto R = std::from_chars(Start, P, D);
+    if (R.ec == std::errc::result_out_of_range)
+        D = std::strtod(std::string(Start, P).c_str(), nullptr); // +-inf or 0, as JS does
+    Out = GC::make_value<FloatValueExprAST>(D);
+    return true;
+}
+/* ++ Parser ++ */
+
+/* -- Stringify -- */
+namespace
+{
+    class WriterImpl
+    {
+    public:
+        WriterImpl(int Indent, std::string& Out, std::string& Err) : Indent(Indent), Out(Out), Err(Err) { }
+
+        bool value(const Expr& V)
+        {
+            switch (V->SubType)
+            {
+                case Type::integer_expr:
+                    integer(std::static_pointer_cast<IntegerValueExprAST>(V)->Val);
+                    return true;
+                case Type::float_expr:
+                    number(std::static_pointer_cast<FloatValueExprAST>(V)->Val);
+                    return true;
+                case Type::string_expr:
+                    string(std::static_pointer_cast<StringValueExprAST>(V)->Val);
+                    return true;
+                case Type::null_value:
+                    Out.append("null", 4);
+                    return true;
+                case Type::array_value:
+                    return array(std::static_pointer_cast<ArrayValueExprAST>(V));
+                case Type::typed_array_value:
+                {
+                    auto Arr = std::static_pointer_cast<TypedArrayValueExprAST>(V);
+                    begin('[');
+                    for (size_t i = 0; i < Arr->Length; i++)
+                    {
+                        next(i);
+                        if (Arr->Kind == TypedKind::float64) number(Arr->f64()[i]);
+                        else if (Arr->Kind == TypedKind::int32) integer(Arr->i32()[i]);
+                        else integer(Arr->u8()[i]);
+                    }
+                    end(']', Arr->Length);
+                    return true;
+                }
+                case Type::object_value:
+                    return object(std::static_pointer_cast<ObjectValueExprAST>(V));
+                default:
+                    Err = "TypeError: " + V->get_ast_name() + " has no JSON form";
+                    return false;
+            }
+        }
+
+    private:
+        int Indent;
+        std::string& Out;
+        std::string& Err;
+        int Level = 0;
+        std::vector<const ExprAST*> Stack; // containers being written, for cycles
+
+        void integer(long long I)
+        {
+            char Tmp[24];
+            auto R = std::to_chars(Tmp, Tmp + sizeof(Tmp), I);
+            Out.append(Tmp, R.ptr - Tmp);
+        }
+
+        // Shortest form that reads back the same, NaN and infinities are null, -0 is 0
+        void number(double D)
+        {
+            if (!std::isfinite(D))
+            {
+                Out.append("null", 4);
+                return;
+            }
+            if (D == 0)
+            {
+                Out.push_back('0');
+                return;
+            }
+            char Tmp[32];
+            auto R = std::to_chars(Tmp, Tmp + sizeof(Tmp), D);
+            Out.append(Tmp, R.ptr - Tmp);
+        }
+
+        void string(const std::string& S)
+        {
+            static const char Hex[] = "0123456789abcdef";
+            auto& K = Kernel::kernels();
+            Out.push_back('"');
+            const char* P = S.data();
+            const char* End = P + S.size();
+            while (true)
+            {
+                size_t Plain = K.string_span(P, End - P);
+                Out.append(P, Plain);
+                P += Plain;
+                if (P == End)
+                    break;
+                switch (char C = *P++)
+                {
+                    case '"':  Out.append("\\\"", 2); break;
+                    case '\\': Out.append("\\\\", 2); break;
+                    case '\b': Out.append("\\b", 2);  break;
+                    case '\f': Out.append("\\f", 2);  break;
+                    case '\n': Out.append("\\n", 2);  break;
+                    case '\r': Out.append("\\r", 2);  break;
+                    case '\t': Out.append("\\t", 2);  break;
+                    default:
+                    {
+                        char U[6] = { '\\', 'u', '0', '0', Hex[(C >> 4) & 0xf], Hex[C & 0xf] };
+                        Out.append(U, 6);
+                        break;
+                    }
+                }
+            }
+            Out.push_back('"');
+        }
+
+        void newline()
+        {
+            Out.push_back('\n');
+            Out.append((size_t)Level * Indent, ' ');
+        }
+
+        void begin(char C)
+        {
+            Out.push_back(C);
+            Level++;
+        }
+
+        // Separator before the i-th element
+        void next(size_t i)
+        {
+            if (i)
+                Out.push_back(',');
+            if (Indent)
+                newline();
+        }
+
+        // An empty container stays on one line: [] {}
+        void end(char C, size_t N)
+        {
+            Level--;
+            if (Indent && N)
+                newline();
+            Out.push_back(C);
+        }
+
+        bool enter(const ExprAST* V)
+        {
+            for (auto S : Stack)
+                if (S == V)
+                {
+                    Err = "TypeError: Converting circular structure to JSON";
+                    return false;
+                }
+            Stack.push_back(V);
+            return true;
+        }
+
+        bool array(const std::shared_ptr<ArrayValueExprAST>& Arr)
+        {
+            if (!enter(Arr.get()))
+                return false;
+            size_t N = Arr->size();
+            begin('[');
+            for (size_t i = 0; i < N; i++)
+            {
+                next(i);
+                switch (Arr->Kind)
+                {
+                    case ElementsKind::packed_int:    integer(Arr->Ints[i]); break;
+                    case ElementsKind::packed_double: number(Arr->Doubles[i]); break;
+                    default:
+                        if (!value(Arr->Values[i]))
+                            return false;
+                        break;
+                }
+            }
+            Stack.pop_back();
+            end(']', N);
+            return true;
+        }
+
+        bool object(const std::shared_ptr<ObjectValueExprAST>& Obj)
+        {
+            if (!enter(Obj.get()))
+                return false;
+            size_t N = Obj->size();
+            begin('{');
+            for (size_t i = 0; i < N; i++)
+            {
+                next(i);
+                string(Obj->Keys[i]);
+                Out.push_back(':');
+                if (Indent)
+                    Out.push_back(' ');
+                if (!value(Obj->Values[i]))
+                    return false;
+            }
+            Stack.pop_back();
+            end('}', N);
+            return true;
+        }
+    };
+}
+
+bool Json::stringify(const Expr& V, int Indent, std::string& Out, std::string& Err)
+{
+    WriterImpl W(Indent, Out, Err);
+    return W.value(V);
+}
+/* ++ Stringify ++ */
@@ -0,0 +1,71 @@
+#ifndef TINYJS_JSON
+#define TINYJS_JSON
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ast.h"
+
+// JSON text <=> script values (JSON.parse, JSON.stringify, JSON.read).
+//
+// parse is one recursive descent pass that builds the values directly:
+// objects, arrays (packed while homogeneous), strings, null, integers for
+// a number without fraction or exponent that fits, floats otherwise.
+// true and false read as 1 and 0, the language has no booleans.
+// The bytes of a string up to the next quote, backslash or control
+// character are found with the string_span kernel and copied at once,
+// that is where a record spends most of its bytes.
+//
+// stringify writes the compact form, or one element per line indented by
+// Indent spaces. A function, promise or file has no JSON form and a cycle
+// has no end, both are errors.
+
+namespace Json
+{
+    using AST::Expr;
+
+    class ParserImpl
+    {
+    public:
+        static const int MaxDepth = 1000;
+
+        explicit ParserImpl(std::string_view Text);
+
+        ParserImpl(const ParserImpl&) = delete;
+        const ParserImpl& operator =(const ParserImpl&) = delete;
+
+        // The one value of the text, only whitespace may follow it.
+        // false and error() set when the text is not JSON.
+        bool parse(Expr& Out);
+        const std::string& error() const { return Err; }
+
+    private:
+        const char* Begin;
+        const char* P;
+        const char* End;
+        int Depth = 0;
+        std::string Err;
+        // Members of the open containers, one level per depth. A container
+        // is built once its size is known. The scratch is per thread and
+        // kept from parse to parse, a record then costs no regrowth.
+        std::vector<std::vector<std::string>>& Keys;
+        std::vector<std::vector<Expr>>& Values;
+
+        bool fail(const std::string& What);
+        bool unexpected();
+        void skip_space();
+        bool value(Expr& Out);
+        bool object(Expr& Out);
+        bool array(Expr& Out);
+        bool string(std::string& Out);
+        bool escape(std::string& Out);
+        bool number(Expr& Out);
+        bool word(const char* Word, size_t Len);
+        void enter_scratch();
+    };
+
+    // false and Err set when V has no JSON form
+    bool stringify(const Expr& V, int Indent, std::string& Out, std::string& Err);
+}
+
+#endif
@@ -0,0 +1,895 @@
+#include "kernel.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNEL_X86
+#include <immintrin.h>
+#endif
+
+using namespace Kernel;
+
+/* -- Scalar -- */
+static double sum_f64_scalar(const double* a, size_t n)
+{
+    double s = 0;
+    for (size_t i = 0; i < n; i++) s += a[i];
+    return s;
+}
+
+// As Math.min and Math.max: NaN if any element is NaN, -0 is below +0.
+// The result does not depend on the order, every level gives the same.
+static const double NaN_f64 = std::numeric_limits<double>::quiet_NaN();
+
+static double min2_f64(double a, double b)
+{ return a < b || (a == b && std::signbit(a)) ? a : b; }
+static double max2_f64(double a, double b)
+{ return a > b || (a == b && !std::signbit(a)) ? a : b; }
+
+static double min_f64_scalar(const double* a, size_t n)
+{
+    double m = a[0];
+    for (size_t i = 0; i < n; i++)
+    {
+        if (std::isnan(a[i])) return NaN_f64;
+        m = min2_f64(m, a[i]);
+    }
+    return m;
+}
+
+static double max_f64_scalar(const double* a, size_t n)
+{
+    double m = a[0];
+    for (size_t i = 0; i < n; i++)
+    {
+        if (std::isnan(a[i])) return NaN_f64;
+        m = max2_f64(m, a[i]);
+    }
+    return m;
+}
+
+static double dot_f64_scalar(const double* a, const double* b, size_t n)
+{
+    double s = 0;
+    for (size_t i = 0; i < n; i++) s += a[i] * b[i];
+    return s;
+}
+
+static void scale_f64_scalar(double* dst, const double* a, double k, size_t n)
+{ for (size_t i = 0; i < n; i++) dst[i] = a[i] * k; }
+
+static void add_f64_scalar(double* dst, const double* a, const double* b, size_t n)
+{ for (size_t i = 0; i < n; i++) dst[i] = a[i] + b[i]; }
+
+static void neg_f64_scalar(double* dst, const double* a, size_t n)
+{
+    for (size_t i = 0; i < n; i++) dst[i] = -a[i];
+}
+
+static void sub_f64_scalar(double* dst, const double* a, const double* b, size_t n)
+{ for (size_t i = 0; i < n; i++) dst[i] = a[i] - b[i]; }
+
+static void mul_f64_scalar(double* dst, const double* a, const double* b, size_t n)
+{ for (size_t i = 0; i < n; i++) dst[i] = a[i] * b[i]; }
+
+static void div_f64_scalar(double* dst, const double* a, const double* b, size_t n)
+{ for (size_t i = 0; i < n; i++) dst[i] = a[i] / b[i]; }
+
+static int64_t sum_i32_scalar(const int32_t* a, size_t n)
+{
+    int64_t s = 0;
+    for (size_t i = 0; i < n; i++) s += a[i];
+    return s;
+}
+
+static int32_t min_i32_scalar(const int32_t* a, size_t n)
+{
+    int32_t m = a[0];
+    for (size_t i = 1; i < n; i++) if (a[i] < m) m = a[i];
+    return m;
+}
+
+static int32_t max_i32_scalar(const int32_t* a, size_t n)
+{
+    int32_t m = a[0];
+    for (size_t i = 1; i < n; i++) if (a[i] > m) m = a[i];
+    return m;
+}
+
+static int64_t dot_i32_scalar(const int32_t* a, const int32_t* b, size_t n)
+{
+    int64_t s = 0;
+    for (size_t i = 0; i < n; i++) s += (int64_t)a[i] * b[i];
+    return s;
+}
+
+// int32 arithmetic wraps, done in uint32 to stay defined
+static void scale_i32_scalar(int32_t* dst, const int32_t* a, int32_t k, size_t n)
+{ for (size_t i = 0; i < n; i++) dst[i] = (int32_t)((uint32_t)a[i] * (uint32_t)k); }
+
+static void add_i32_scalar(int32_t* dst, const int32_t* a, const int32_t* b, size_t n)
+{ for (size_t i = 0; i < n; i++) dst[i] = (int32_t)((uint32_t)a[i] + (uint32_t)b[i]); }
+
+static uint64_t sum_u8_scalar(const uint8_t* a, size_t n)
+{
+    uint64_t s = 0;
+    for (size_t i = 0; i < n; i++) s += a[i];
+    return s;
+}
+
+static uint8_t min_u8_scalar(const uint8_t* a, size_t n)
+{
+    uint8_t m = a[0];
+    for (size_t i = 1; i < n; i++) if (a[i] < m) m = a[i];
+    return m;
+}
+
+static uint8_t max_u8_scalar(const uint8_t* a, size_t n)
+{
+    uint8_t m = a[0];
+    for (size_t i = 1; i < n; i++) if (a[i] > m) m = a[i];
+    return m;
+}
+
+static size_t count_u8_scalar(const uint8_t* a, uint8_t v, size_t n)
+{
+    size_t c = 0;
+    for (size_t i = 0; i < n; i++) c += a[i] == v;
+    return c;
+}
+
+static size_t string_span_scalar(const char* s, size_t n)
+{
+    size_t i = 0;
+    while (i < n && s[i] != '"' && s[i] != '\\' && (unsigned char)s[i] >= 0x20) i++;
+    return i;
+}
+static bool space_char(unsigned char c) { return c == ' ' || (unsigned)(c - '\t') < 5; }
+static bool word_char(unsigned char c)
+{
+    return (unsigned)((c | 0x20) - 'a') < 26 || (unsigned)(c - '0') < 10 || c == '_';
+}
+
+static size_t space_span_scalar(const char* s, size_t n, size_t* lines)
+{
+    size_t i = 0;
+    for (; i < n && space_char(s[i]); i++) *lines += s[i] == '\n';
+    return i;
+}
+
+static size_t word_span_scalar(const char* s, size_t n)
+{
+    size_t i = 0;
+    while (i < n && word_char(s[i])) i++;
+    return i;
+}
+
+static size_t digit_span_scalar(const char* s, size_t n)
+{
+    size_t i = 0;
+    while (i < n && (unsigned)(s[i] - '0') < 10) i++;
+    return i;
+}
+
+static size_t quote_span_scalar(const char* s, size_t n, char q)
+{
+    size_t i = 0;
+    while (i < n && s[i] != q && s[i] != '\\') i++;
+    return i;
+}
+
+static size_t line_span_scalar(const char* s, size_t n)
+{
+    size_t i = 0;
+    while (i < n && s[i] != '\n' && s[i] != '\r') i++;
+    return i;
+}
+/* ++ Scalar ++ */
+
+#ifdef KERNEL_X86
+/* -- SSE2 -- */
+static double sum_f64_sse2(const double* a, size_t n)
+{
+    __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s0 = _mm_add_pd(s0, _mm_loadu_pd(a + i));
+        s1 = _mm_add_pd(s1, _mm_loadu_pd(a + i + 2));
+    }
+    double lane[2];
+    _mm_storeu_pd(lane, _mm_add_pd(s0, s1));
+    double s = lane[0] + lane[1];
+    for (; i < n; i++) s += a[i];
+    return s;
+}
+
+// minpd ignores a NaN and the sign of a zero: NaNs are counted aside, and
+// the sign bits of the zeros seen decide a zero result
+static double min_f64_sse2(const double* a, size_t n)
+{
+    if (n < 2) return min_f64_scalar(a, n);
+    __m128d zero = _mm_setzero_pd(), m = _mm_loadu_pd(a);
+    __m128d nan = _mm_cmpunord_pd(m, m), neg0 = _mm_and_pd(_mm_cmpeq_pd(m, zero), m);
+    size_t i = 2;
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128d x = _mm_loadu_pd(a + i);
+        nan = _mm_or_pd(nan, _mm_cmpunord_pd(x, x));
+        neg0 = _mm_or_pd(neg0, _mm_and_pd(_mm_cmpeq_pd(x, zero), x));
+        m = _mm_min_pd(m, x);
+    }
+    if (_mm_movemask_pd(nan)) return NaN_f64;
+    double lane[2];
+    _mm_storeu_pd(lane, m);
+    double r = lane[0] < lane[1] ? lane[0] : lane[1];
+    if (r == 0) r = _mm_movemask_pd(neg0) ? -0.0 : 0.0;
+    return i < n ? min2_f64(r, min_f64_scalar(a + i, n - i)) : r;
+}
+
+static double max_f64_sse2(const double* a, size_t n)
+{
+    if (n < 2) return max_f64_scalar(a, n);
+    __m128d zero = _mm_setzero_pd(), m = _mm_loadu_pd(a);
+    __m128d nan = _mm_cmpunord_pd(m, m), pos0 = _mm_andnot_pd(m, _mm_cmpeq_pd(m, zero));
+    size_t i = 2;
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128d x = _mm_loadu_pd(a + i);
+        nan = _mm_or_pd(nan, _mm_cmpunord_pd(x, x));
+        pos0 = _mm_or_pd(pos0, _mm_andnot_pd(x, _mm_cmpeq_pd(x, zero)));
+        m = _mm_max_pd(m, x);
+    }
+    if (_mm_movemask_pd(nan)) return NaN_f64;
+    double lane[2];
+    _mm_storeu_pd(lane, m);
+    double r = lane[0] > lane[1] ? lane[0] : lane[1];
+    if (r == 0) r = _mm_movemask_pd(pos0) ? 0.0 : -0.0;
+    return i < n ? max2_f64(r, max_f64_scalar(a + i, n - i)) : r;
+}
+
+static void neg_f64_sse2(double* dst, const double* a, size_t n)
+{
+    __m128d sign = _mm_set1_pd(-0.0);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_pd(dst + i, _mm_xor_pd(_mm_loadu_pd(a + i), sign));
+    neg_f64_scalar(dst + i, a + i, n - i);
+}
+
+static double dot_f64_sse2(const double* a, const double* b, size_t n)
+{
+    __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s0 = _mm_add_pd(s0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+        s1 = _mm_add_pd(s1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+    }
+    double lane[2];
+    _mm_storeu_pd(lane, _mm_add_pd(s0, s1));
+    double s = lane[0] + lane[1];
+    for (; i < n; i++) s += a[i] * b[i];
+    return s;
+}
+
+static void scale_f64_sse2(double* dst, const double* a, double k, size_t n)
+{
+    __m128d vk = _mm_set1_pd(k);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+        _mm_storeu_pd(dst + i, _mm_mul_pd(_mm_loadu_pd(a + i), vk));
+    for (; i < n; i++) dst[i] = a[i] * k;
+}
+
+#define KERNEL_SSE2_BINARY(name, op, intrinsic) \
+static void name##_f64_sse2(double* dst, const double* a, const double* b, size_t n) \
+{ \
+    size_t i = 0; \
+    for (; i + 2 <= n; i += 2) \
+        _mm_storeu_pd(dst + i, intrinsic(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i))); \
+    for (; i < n; i++) dst[i] = a[i] op b[i]; \
+}
+
+KERNEL_SSE2_BINARY(add, +, _mm_add_pd)
+KERNEL_SSE2_BINARY(sub, -, _mm_sub_pd)
+KERNEL_SSE2_BINARY(mul, *, _mm_mul_pd)
+KERNEL_SSE2_BINARY(div, /, _mm_div_pd)
+#undef KERNEL_SSE2_BINARY
+
+static void add_i32_sse2(int32_t* dst, const int32_t* a, const int32_t* b, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_add_epi32(x, y));
+    }
+    add_i32_scalar(dst + i, a + i, b + i, n - i);
+}
+// _mm_sad_epu8 against zero adds 8 bytes into each 64 bit lane
+static uint64_t sum_u8_sse2(const uint8_t* a, size_t n)
+{
+    __m128i s = _mm_setzero_si128(), zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        s = _mm_add_epi64(s, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(a + i)), zero));
+    uint64_t lane[2];
+    _mm_storeu_si128((__m128i*)lane, s);
+    return lane[0] + lane[1] + sum_u8_scalar(a + i, n - i);
+}
+
+static uint8_t min_u8_sse2(const uint8_t* a, size_t n)
+{
+    if (n < 16) return min_u8_scalar(a, n);
+    __m128i m = _mm_loadu_si128((const __m128i*)a);
+    size_t i = 16;
+    for (; i + 16 <= n; i += 16)
+        m = _mm_min_epu8(m, _mm_loadu_si128((const __m128i*)(a + i)));
+    uint8_t lane[16];
+    _mm_storeu_si128((__m128i*)lane, m);
+    uint8_t r = min_u8_scalar(lane, 16);
+    for (; i < n; i++) if (a[i] < r) r = a[i];
+    return r;
+}
+
+static uint8_t max_u8_sse2(const uint8_t* a, size_t n)
+{
+    if (n < 16) return max_u8_scalar(a, n);
+    __m128i m = _mm_loadu_si128((const __m128i*)a);
+    size_t i = 16;
+    for (; i + 16 <= n; i += 16)
+        m = _mm_max_epu8(m, _mm_loadu_si128((const __m128i*)(a + i)));
+    uint8_t lane[16];
+    _mm_storeu_si128((__m128i*)lane, m);
+    uint8_t r = max_u8_scalar(lane, 16);
+    for (; i < n; i++) if (a[i] > r) r = a[i];
+    return r;
+}
+
+// A match is 0xff, subtracting it counts one in a byte lane.
+// The byte counters are folded into 64 bit lanes before they can wrap.
+static size_t count_u8_sse2(const uint8_t* a, uint8_t v, size_t n)
+{
+    __m128i vv = _mm_set1_epi8((char)v), zero = _mm_setzero_si128(), total = zero;
+    size_t i = 0;
+    while (i + 16 <= n)
+    {
+        __m128i c = zero;
+        for (int k = 0; k < 255 && i + 16 <= n; k++, i += 16)
+            c = _mm_sub_epi8(c, _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(a + i)), vv));
+        total = _mm_add_epi64(total, _mm_sad_epu8(c, zero));
+    }
+    uint64_t lane[2];
+    _mm_storeu_si128((__m128i*)lane, total);
+    return lane[0] + lane[1] + count_u8_scalar(a + i, v, n - i);
+}
+
+// One compare per special byte, a control character is one below 0x20:
+// x < 0x20 unsigned <=> min(x, 0x1f) == x
+static size_t string_span_sse2(const char* s, size_t n)
+{
+    __m128i quote = _mm_set1_epi8('"'), slash = _mm_set1_epi8('\\'), low = _mm_set1_epi8(0x1f);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + i));
+        __m128i hit = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, quote), _mm_cmpeq_epi8(x, slash)),
+                                   _mm_cmpeq_epi8(_mm_min_epu8(x, low), x));
+        if (int mask = _mm_movemask_epi8(hit))
+            return i + __builtin_ctz(mask);
+    }
+    return i + string_span_scalar(s + i, n - i);
+}
+// Bytes c with lo <= c < lo + count, unsigned
+static __m128i in_range_sse2(__m128i x, char lo, char count)
+{
+    __m128i t = _mm_sub_epi8(x, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(count - 1)), t);
+}
+
+static __m128i word_sse2(__m128i x)
+{
+    return _mm_or_si128(_mm_or_si128(in_range_sse2(_mm_or_si128(x, _mm_set1_epi8(0x20)), 'a', 26),
+                                     in_range_sse2(x, '0', 10)),
+                        _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+}
+
+// The newlines before the first byte out of the run are counted
+static size_t space_span_sse2(const char* s, size_t n, size_t* lines)
+{
+    __m128i blank = _mm_set1_epi8(' '), newline = _mm_set1_epi8('\n');
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + i));
+        unsigned in = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, blank), in_range_sse2(x, '\t', 5)));
+        unsigned nl = _mm_movemask_epi8(_mm_cmpeq_epi8(x, newline));
+        if (unsigned out = ~in & 0xffff)
+        {
+            *lines += __builtin_popcount(nl & ((out & -out) - 1));
+            return i + __builtin_ctz(out);
+        }
+        *lines += __builtin_popcount(nl);
+    }
+    return i + space_span_scalar(s + i, n - i, lines);
+}
+
+static size_t word_span_sse2(const char* s, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        unsigned in = _mm_movemask_epi8(word_sse2(_mm_loadu_si128((const __m128i*)(s + i))));
+        if (unsigned out = ~in & 0xffff)
+            return i + __builtin_ctz(out);
+    }
+    return i + word_span_scalar(s + i, n - i);
+}
+
+static size_t digit_span_sse2(const char* s, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        unsigned in = _mm_movemask_epi8(in_range_sse2(_mm_loadu_si128((const __m128i*)(s + i)), '0', 10));
+        if (unsigned out = ~in & 0xffff)
+            return i + __builtin_ctz(out);
+    }
+    return i + digit_span_scalar(s + i, n - i);
+}
+
+static size_t quote_span_sse2(const char* s, size_t n, char q)
+{
+    __m128i quote = _mm_set1_epi8(q), slash = _mm_set1_epi8('\\');
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + i));
+        if (int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, quote), _mm_cmpeq_epi8(x, slash))))
+            return i + __builtin_ctz(mask);
+    }
+    return i + quote_span_scalar(s + i, n - i, q);
+}
+
+static size_t line_span_sse2(const char* s, size_t n)
+{
+    __m128i lf = _mm_set1_epi8('\n'), cr = _mm_set1_epi8('\r');
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i*)(s + i));
+        if (int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(x, lf), _mm_cmpeq_epi8(x, cr))))
+            return i + __builtin_ctz(mask);
+    }
+    return i + line_span_scalar(s + i, n - i);
+}
+/* ++ SSE2 ++ */
+
+/* -- AVX2 -- */
+#define AVX2 __attribute__((target("avx2")))
+
+AVX2 static double hsum_f64_avx2(__m256d v)
+{
+    double lane[4];
+    _mm256_storeu_pd(lane, v);
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+}
+
+AVX2 static int64_t hsum_i64_avx2(__m256i v)
+{
+    int64_t lane[4];
+    _mm256_storeu_si256((__m256i*)lane, v);
+    return lane[0] + lane[1] + lane[2] + lane[3];
+}
+
+AVX2 static double sum_f64_avx2(const double* a, size_t n)
+{
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        s0 = _mm256_add_pd(s0, _mm256_loadu_pd(a + i));
+        s1 = _mm256_add_pd(s1, _mm256_loadu_pd(a + i + 4));
+    }
+    double s = hsum_f64_avx2(_mm256_add_pd(s0, s1));
+    for (; i < n; i++) s += a[i];
+    return s;
+}
+
+AVX2 static double min_f64_avx2(const double* a, size_t n)
+{
+    if (n < 4) return min_f64_scalar(a, n);
+    __m256d zero = _mm256_setzero_pd(), m = _mm256_loadu_pd(a);
+    __m256d nan = _mm256_cmp_pd(m, m, _CMP_UNORD_Q), neg0 = _mm256_and_pd(_mm256_cmp_pd(m, zero, _CMP_EQ_OQ), m);
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d x = _mm256_loadu_pd(a + i);
+        nan = _mm256_or_pd(nan, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+        neg0 = _mm256_or_pd(neg0, _mm256_and_pd(_mm256_cmp_pd(x, zero, _CMP_EQ_OQ), x));
+        m = _mm256_min_pd(m, x);
+    }
+    if (_mm256_movemask_pd(nan)) return NaN_f64;
+    double lane[4];
+    _mm256_storeu_pd(lane, m);
+    double r = min_f64_scalar(lane, 4);
+    if (r == 0) r = _mm256_movemask_pd(neg0) ? -0.0 : 0.0;
+    return i < n ? min2_f64(r, min_f64_scalar(a + i, n - i)) : r;
+}
+
+AVX2 static double max_f64_avx2(const double* a, size_t n)
+{
+    if (n < 4) return max_f64_scalar(a, n);
+    __m256d zero = _mm256_setzero_pd(), m = _mm256_loadu_pd(a);
+    __m256d nan = _mm256_cmp_pd(m, m, _CMP_UNORD_Q), pos0 = _mm256_andnot_pd(m, _mm256_cmp_pd(m, zero, _CMP_EQ_OQ));
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d x = _mm256_loadu_pd(a + i);
+        nan = _mm256_or_pd(nan, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+        pos0 = _mm256_or_pd(pos0, _mm256_andnot_pd(x, _mm256_cmp_pd(x, zero, _CMP_EQ_OQ)));
+        m = _mm256_max_pd(m, x);
+    }
+    if (_mm256_movemask_pd(nan)) return NaN_f64;
+    double lane[4];
+    _mm256_storeu_pd(lane, m);
+    double r = max_f64_scalar(lane, 4);
+    if (r == 0) r = _mm256_movemask_pd(pos0) ? 0.0 : -0.0;
+    return i < n ? max2_f64(r, max_f64_scalar(a + i, n - i)) : r;
+}
+
+AVX2 static void neg_f64_avx2(double* dst, const double* a, size_t n)
+{
+    __m256d sign = _mm256_set1_pd(-0.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(dst + i, _mm256_xor_pd(_mm256_loadu_pd(a + i), sign));
+    neg_f64_sse2(dst + i, a + i, n - i);
+}
+
+AVX2 static double dot_f64_avx2(const double* a, const double* b, size_t n)
+{
+    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        s0 = _mm256_add_pd(s0, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+        s1 = _mm256_add_pd(s1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4)));
+    }
+    double s = hsum_f64_avx2(_mm256_add_pd(s0, s1));
+    for (; i < n; i++) s += a[i] * b[i];
+    return s;
+}
+
+AVX2 static void scale_f64_avx2(double* dst, const double* a, double k, size_t n)
+{
+    __m256d vk = _mm256_set1_pd(k);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+        _mm256_storeu_pd(dst + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), vk));
+    for (; i < n; i++) dst[i] = a[i] * k;
+}
+
+#define KERNEL_AVX2_BINARY(name, op, intrinsic) \
+AVX2 static void name##_f64_avx2(double* dst, const double* a, const double* b, size_t n) \
+{ \
+    size_t i = 0; \
+    for (; i + 4 <= n; i += 4) \
+        _mm256_storeu_pd(dst + i, intrinsic(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i))); \
+    for (; i < n; i++) dst[i] = a[i] op b[i]; \
+}
+
+KERNEL_AVX2_BINARY(add, +, _mm256_add_pd)
+KERNEL_AVX2_BINARY(sub, -, _mm256_sub_pd)
+KERNEL_AVX2_BINARY(mul, *, _mm256_mul_pd)
+KERNEL_AVX2_BINARY(div, /, _mm256_div_pd)
+#undef KERNEL_AVX2_BINARY
+
+AVX2 static int64_t sum_i32_avx2(const int32_t* a, size_t n)
+{
+    // widen to int64 lanes, the sum can not overflow
+    __m256i s0 = _mm256_setzero_si256(), s1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        s0 = _mm256_add_epi64(s0, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(a + i))));
+        s1 = _mm256_add_epi64(s1, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(a + i + 4))));
+    }
+    return hsum_i64_avx2(_mm256_add_epi64(s0, s1)) + sum_i32_scalar(a + i, n - i);
+}
+
+AVX2 static int32_t min_i32_avx2(const int32_t* a, size_t n)
+{
+    if (n < 8) return min_i32_scalar(a, n);
+    __m256i m = _mm256_loadu_si256((const __m256i*)a);
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8)
+        m = _mm256_min_epi32(m, _mm256_loadu_si256((const __m256i*)(a + i)));
+    int32_t lane[8];
+    _mm256_storeu_si256((__m256i*)lane, m);
+    int32_t r = min_i32_scalar(lane, 8);
+    for (; i < n; i++) if (a[i] < r) r = a[i];
+    return r;
+}
+
+AVX2 static int32_t max_i32_avx2(const int32_t* a, size_t n)
+{
+    if (n < 8) return max_i32_scalar(a, n);
+    __m256i m = _mm256_loadu_si256((const __m256i*)a);
+    size_t i = 8;
+    for (; i + 8 <= n; i += 8)
+        m = _mm256_max_epi32(m, _mm256_loadu_si256((const __m256i*)(a + i)));
+    int32_t lane[8];
+    _mm256_storeu_si256((__m256i*)lane, m);
+    int32_t r = max_i32_scalar(lane, 8);
+    for (; i < n; i++) if (a[i] > r) r = a[i];
+    return r;
+}
+
+AVX2 static int64_t dot_i32_avx2(const int32_t* a, const int32_t* b, size_t n)
+{
+    // _mm256_mul_epi32 multiplies the low signed halves of int64 lanes
+    __m256i s = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(a + i)));
+        __m256i y = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(b + i)));
+        s = _mm256_add_epi64(s, _mm256_mul_epi32(x, y));
+    }
+    return hsum_i64_avx2(s) + dot_i32_scalar(a + i, b + i, n - i);
+}
+
+AVX2 static void scale_i32_avx2(int32_t* dst, const int32_t* a, int32_t k, size_t n)
+{
+    __m256i vk = _mm256_set1_epi32(k);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*)(a + i)), vk));
+    scale_i32_scalar(dst + i, a + i, k, n - i);
+}
+
+AVX2 static void add_i32_avx2(int32_t* dst, const int32_t* a, const int32_t* b, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_add_epi32(x, y));
+    }
+    add_i32_scalar(dst + i, a + i, b + i, n - i);
+}
+AVX2 static uint64_t sum_u8_avx2(const uint8_t* a, size_t n)
+{
+    __m256i s = _mm256_setzero_si256(), zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+        s = _mm256_add_epi64(s, _mm256_sad_epu8(_mm256_loadu_si256((const __m256i*)(a + i)), zero));
+    return hsum_i64_avx2(s) + sum_u8_scalar(a + i, n - i);
+}
+
+AVX2 static uint8_t min_u8_avx2(const uint8_t* a, size_t n)
+{
+    if (n < 32) return min_u8_scalar(a, n);
+    __m256i m = _mm256_loadu_si256((const __m256i*)a);
+    size_t i = 32;
+    for (; i + 32 <= n; i += 32)
+        m = _mm256_min_epu8(m, _mm256_loadu_si256((const __m256i*)(a + i)));
+    uint8_t lane[32];
+    _mm256_storeu_si256((__m256i*)lane, m);
+    uint8_t r = min_u8_scalar(lane, 32);
+    for (; i < n; i++) if (a[i] < r) r = a[i];
+    return r;
+}
+
+AVX2 static uint8_t max_u8_avx2(const uint8_t* a, size_t n)
+{
+    if (n < 32) return max_u8_scalar(a, n);
+    __m256i m = _mm256_loadu_si256((const __m256i*)a);
+    size_t i = 32;
+    for (; i + 32 <= n; i += 32)
+        m = _mm256_max_epu8(m, _mm256_loadu_si256((const __m256i*)(a + i)));
+    uint8_t lane[32];
+    _mm256_storeu_si256((__m256i*)lane, m);
+    uint8_t r = max_u8_scalar(lane, 32);
+    for (; i < n; i++) if (a[i] > r) r = a[i];
+    return r;
+}
+
+AVX2 static size_t count_u8_avx2(const uint8_t* a, uint8_t v, size_t n)
+{
+    __m256i vv = _mm256_set1_epi8((char)v), zero = _mm256_setzero_si256(), total = zero;
+    size_t i = 0;
+    while (i + 32 <= n)
+    {
+        __m256i c = zero;
+        for (int k = 0; k < 255 && i + 32 <= n; k++, i += 32)
+            c = _mm256_sub_epi8(c, _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(a + i)), vv));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(c, zero));
+    }
+    return hsum_i64_avx2(total) + count_u8_scalar(a + i, v, n - i);
+}
+
+AVX2 static size_t string_span_avx2(const char* s, size_t n)
+{
+    __m256i quote = _mm256_set1_epi8('"'), slash = _mm256_set1_epi8('\\'), low = _mm256_set1_epi8(0x1f);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + i));
+        __m256i hit = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(x, quote), _mm256_cmpeq_epi8(x, slash)),
+                                      _mm256_cmpeq_epi8(_mm256_min_epu8(x, low), x));
+        if (unsigned mask = _mm256_movemask_epi8(hit))
+            return i + __builtin_ctz(mask);
+    }
+    return i + string_span_sse2(s + i, n - i);
+}
+AVX2 static __m256i in_range_avx2(__m256i x, char lo, char count)
+{
+    __m256i t = _mm256_sub_epi8(x, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(count - 1)), t);
+}
+
+AVX2 static __m256i word_avx2(__m256i x)
+{
+    return _mm256_or_si256(_mm256_or_si256(in_range_avx2(_mm256_or_si256(x, _mm256_set1_epi8(0x20)), 'a', 26),
+                                           in_range_avx2(x, '0', 10)),
+                           _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_')));
+}
+
+AVX2 static size_t space_span_avx2(const char* s, size_t n, size_t* lines)
+{
+    __m256i blank = _mm256_set1_epi8(' '), newline = _mm256_set1_epi8('\n');
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + i));
+        unsigned in = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(x, blank), in_range_avx2(x, '\t', 5)));
+        unsigned nl = _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, newline));
+        if (unsigned out = ~in)
+        {
+            *lines += __builtin_popcount(nl & ((out & -out) - 1));
+            return i + __builtin_ctz(out);
+        }
+        *lines += __builtin_popcount(nl);
+    }
+    return i + space_span_sse2(s + i, n - i, lines);
+}
+
+AVX2 static size_t word_span_avx2(const char* s, size_t n)
+{
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        unsigned in = _mm256_movemask_epi8(word_avx2(_mm256_loadu_si256((const __m256i*)(s + i))));
+        if (unsigned out = ~in)
+            return i + __builtin_ctz(out);
+    }
+    return i + word_span_sse2(s + i, n - i);
+}
+
+AVX2 static size_t digit_span_avx2(const char* s, size_t n)
+{
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        unsigned in = _mm256_movemask_epi8(in_range_avx2(_mm256_loadu_si256((const __m256i*)(s + i)), '0', 10));
+        if (unsigned out = ~in)
+            return i + __builtin_ctz(out);
+    }
+    return i + digit_span_sse2(s + i, n - i);
+}
+
+AVX2 static size_t quote_span_avx2(const char* s, size_t n, char q)
+{
+    __m256i quote = _mm256_set1_epi8(q), slash = _mm256_set1_epi8('\\');
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + i));
+        if (unsigned mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(x, quote), _mm256_cmpeq_epi8(x, slash))))
+            return i + __builtin_ctz(mask);
+    }
+    return i + quote_span_sse2(s + i, n - i, q);
+}
+
+AVX2 static size_t line_span_avx2(const char* s, size_t n)
+{
+    __m256i lf = _mm256_set1_epi8('\n'), cr = _mm256_set1_epi8('\r');
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(s + i));
+        if (unsigned mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(x, lf), _mm256_cmpeq_epi8(x, cr))))
+            return i + __builtin_ctz(mask);
+    }
+    return i + line_span_sse2(s + i, n - i);
+}
+#undef AVX2
+/* ++ AVX2 ++ */
+#endif
+
+static KernelTable make_table(Level ISA)
+{
+    KernelTable T = {
+        Level::scalar,
+        sum_f64_scalar, min_f64_scalar, max_f64_scalar, dot_f64_scalar,
+        scale_f64_scalar, neg_f64_scalar, add_f64_scalar, sub_f64_scalar, mul_f64_scalar, div_f64_scalar,
+        sum_i32_scalar, min_i32_scalar, max_i32_scalar, dot_i32_scalar,
+        scale_i32_scalar, add_i32_scalar,
+        sum_u8_scalar, min_u8_scalar, max_u8_scalar, count_u8_scalar,
+        string_span_scalar,
+        space_span_scalar, word_span_scalar, digit_span_scalar, quote_span_scalar, line_span_scalar,
+    };
+#ifdef KERNEL_X86
+    if (ISA >= Level::sse2)
+    {
+        T.ISA = Level::sse2;
+        T.sum_f64 = sum_f64_sse2; T.min_f64 = min_f64_sse2; T.max_f64 = max_f64_sse2;
+        T.dot_f64 = dot_f64_sse2; T.scale_f64 = scale_f64_sse2;
+        T.neg_f64 = neg_f64_sse2; T.add_f64 = add_f64_sse2; T.sub_f64 = sub_f64_sse2;
+        T.mul_f64 = mul_f64_sse2; T.div_f64 = div_f64_sse2;
+        T.add_i32 = add_i32_sse2;
+        T.sum_u8 = sum_u8_sse2; T.min_u8 = min_u8_sse2; T.max_u8 = max_u8_sse2;
+        T.count_u8 = count_u8_sse2; T.string_span = string_span_sse2;
+        T.space_span = space_span_sse2; T.word_span = word_span_sse2; T.digit_span = digit_span_sse2;
+        T.quote_span = quote_span_sse2; T.line_span = line_span_sse2;
+    }
+    if (ISA >= Level::avx2)
+    {
+        T.ISA = Level::avx2;
+        T.sum_f64 = sum_f64_avx2; T.min_f64 = min_f64_avx2; T.max_f64 = max_f64_avx2;
+        T.dot_f64 = dot_f64_avx2; T.scale_f64 = scale_f64_avx2;
+        T.neg_f64 = neg_f64_avx2; T.add_f64 = add_f64_avx2; T.sub_f64 = sub_f64_avx2;
+        T.mul_f64 = mul_f64_avx2; T.div_f64 = div_f64_avx2;
+        T.sum_i32 = sum_i32_avx2; T.min_i32 = min_i32_avx2; T.max_i32 = max_i32_avx2;
+        T.dot_i32 = dot_i32_avx2; T.scale_i32 = scale_i32_avx2; T.add_i32 = add_i32_avx2;
+        T.sum_u8 = sum_u8_avx2; T.min_u8 = min_u8_avx2; T.max_u8 = max_u8_avx2;
+        T.count_u8 = count_u8_avx2; T.string_span = string_span_avx2;
+        T.space_span = space_span_avx2; T.word_span = word_span_avx2; T.digit_span = digit_span_avx2;
+        T.quote_span = quote_span_avx2; T.line_span = line_span_avx2;
+    }
+#endif
+    return T;
+}
+
+static Level detect_level()
+{
+    Level ISA = Level::scalar;
+#ifdef KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) ISA = Level::sse2;
+    if (__builtin_cpu_supports("avx2")) ISA = Level::avx2;
+#endif
+    // Only allow to go down
+    if (const char* Force = getenv("TINYJS_SIMD"))
+    {
+        Level Want = ISA;
+        if (!strcmp(Force, "scalar")) Want = Level::scalar;
+        else if (!strcmp(Force, "sse2")) Want = Level::sse2;
+        else if (!strcmp(Force, "avx2")) Want = Level::avx2;
+        if (Want < ISA) ISA = Want;
+    }
+    return ISA;
+}
+
+const KernelTable& Kernel::kernels()
+{
+    static const KernelTable Table = make_table(detect_level());
+    return Table;
+}
+
+std::string Kernel::level_name(Level ISA)
+{
+    switch (ISA)
+    {
+        case Level::avx2: return "avx2";
+        case Level::sse2: return "sse2";
+        default:          return "scalar";
+    }
+}
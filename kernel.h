@@ -0,0 +1,66 @@
+#ifndef TINYJS_KERNEL
+#define TINYJS_KERNEL
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Bulk numeric kernels for typed arrays, and the byte scanners of the JSON
+// parser and of the lexer.
+// Every kernel has a scalar version, x86 builds add SSE2 and AVX2 versions.
+// The table is chosen once at startup from the CPU features,
+// TINYJS_SIMD=scalar|sse2|avx2 forces a lower level.
+// Float sums are computed in several lanes, so the rounding may differ
+// from a left-to-right loop in the last bits. min and max give the same
+// result at every level: NaN if an element is NaN, -0 below +0.
+
+namespace Kernel
+{
+    enum class Level { scalar, sse2, avx2 };
+
+    struct KernelTable
+    {
+        Level ISA;
+
+        double  (*sum_f64)(const double* a, size_t n);
+        double  (*min_f64)(const double* a, size_t n);
+        double  (*max_f64)(const double* a, size_t n);
+        double  (*dot_f64)(const double* a, const double* b, size_t n);
+        void    (*scale_f64)(double* dst, const double* a, double k, size_t n);
+        void    (*neg_f64)(double* dst, const double* a, size_t n);       // sign flip
+        void    (*add_f64)(double* dst, const double* a, const double* b, size_t n);
+        void    (*sub_f64)(double* dst, const double* a, const double* b, size_t n);
+        void    (*mul_f64)(double* dst, const double* a, const double* b, size_t n);
+        void    (*div_f64)(double* dst, const double* a, const double* b, size_t n);
+
+        int64_t (*sum_i32)(const int32_t* a, size_t n);
+        int32_t (*min_i32)(const int32_t* a, size_t n);
+        int32_t (*max_i32)(const int32_t* a, size_t n);
+        int64_t (*dot_i32)(const int32_t* a, const int32_t* b, size_t n);
+        void    (*scale_i32)(int32_t* dst, const int32_t* a, int32_t k, size_t n);
+        void    (*add_i32)(int32_t* dst, const int32_t* a, const int32_t* b, size_t n);
+
+        uint64_t (*sum_u8)(const uint8_t* a, size_t n);
+        uint8_t  (*min_u8)(const uint8_t* a, size_t n);
+        uint8_t  (*max_u8)(const uint8_t* a, size_t n);
+        size_t   (*count_u8)(const uint8_t* a, uint8_t v, size_t n); // bytes equal to v
+
+        // JSON string scanner: length of the prefix of s free of '"', '\\'
+        // and control characters, n if there is none of them.
+        size_t   (*string_span)(const char* s, size_t n);
+
+        // Lexer scanners: length of the prefix of s in one class of characters
+        size_t   (*space_span)(const char* s, size_t n, size_t* lines); // isspace, its '\n' are added to *lines
+        size_t   (*word_span)(const char* s, size_t n);                 // [A-Za-z0-9_]
+        size_t   (*digit_span)(const char* s, size_t n);                // [0-9]
+        size_t   (*quote_span)(const char* s, size_t n, char q);        // free of q and '\\'
+        size_t   (*line_span)(const char* s, size_t n);                 // free of '\n' and '\r'
+    };
+
+    // Kernels for the running CPU, n must be > 0 for min/max.
+    const KernelTable& kernels();
+
+    std::string level_name(Level ISA);
+}
+
+#endif
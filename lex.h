@@ -5,6 +5,9 @@
 #include <cctype>
 #include <map>
 #include <iostream>
+#include <algorithm>
+#include <climits>
+#include "kernel.h"
 
 namespace Lexer
 {
@@ -21,11 +24,14 @@ namespace Lexer
         // primary
         tok_identifier,
         // value
-        tok_integer, tok_float, tok_string, tok_single_char, tok_op, 
+        tok_integer, tok_float, tok_string, tok_regex, tok_single_char, tok_op, 
         tok_return, tok_break, tok_continue,
 
         tok_variable_declare, // var let
         tok_if, tok_for, tok_while, tok_do_while,
+        tok_async, tok_await,
+        tok_null,
+        tok_import, tok_export,
     };
 
     static std::map<Type, std::string> TokenName {
@@ -38,6 +44,7 @@ namespace Lexer
         { Type::tok_integer          , "tok_integer"          },
         { Type::tok_float            , "tok_float"            },
         { Type::tok_string           , "tok_string"           },
+        { Type::tok_regex            , "tok_regex"            },
         { Type::tok_single_char      , "tok_single_char"      },
         { Type::tok_op               , "tok_op"               },
         { Type::tok_return           , "tok_return"           },
@@ -46,6 +53,11 @@ namespace Lexer
         { Type::tok_for              , "tok_for"              },
         { Type::tok_do_while         , "tok_do_while"         },
         { Type::tok_variable_declare , "tok_variable_declare" },
+        { Type::tok_async            , "tok_async"            },
+        { Type::tok_await            , "tok_await"            },
+        { Type::tok_null             , "tok_null"             },
+        { Type::tok_import           , "tok_import"           },
+        { Type::tok_export           , "tok_export"           },
     };
 
     static std::map<std::string, Type> KeywordToken {
@@ -59,6 +71,11 @@ namespace Lexer
         { "return"   , Type::tok_return           },
         { "break"    , Type::tok_break            },
         { "continue" , Type::tok_continue         },
+        { "async"    , Type::tok_async            },
+        { "await"    , Type::tok_await            },
+        { "null"     , Type::tok_null             },
+        { "import"   , Type::tok_import           },
+        { "export"   , Type::tok_export           },
     };
 
     class Token
@@ -73,6 +90,18 @@ namespace Lexer
         ~Token() = default;
     };
 
+    // What the input has read ahead into its buffer, the lexer scans runs of
+    // characters there in place and moves past them. Forming the members
+    // through a derived class is what lets them apply to any streambuf.
+    // Empty for an input without a buffer (stdin synced with stdio).
+    class WindowImpl : public std::streambuf
+    {
+    public:
+        static const char* begin(std::streambuf* S) { return (S->*&WindowImpl::gptr)(); }
+        static size_t size(std::streambuf* S) { return (S->*&WindowImpl::egptr)() - begin(S); }
+        static void skip(std::streambuf* S, size_t n) { (S->*&WindowImpl::gbump)((int)n); }
+    };
+
     class LexerImpl
     {
         using IntType = unsigned long long;
@@ -118,12 +147,33 @@ namespace Lexer
             {
                 StreamBackup = cin.rdbuf();
                 cin.rdbuf(sptr);
+                cin.clear(); // a previous input may have ended
             }
         }
         void recover_input() { cin.rdbuf(StreamBackup); }
 
         char get_next_char() { return LastChar; }
 
+        // Consumes the run Span measures at the read position, within the
+        // window, and adds it to CurStr if Keep. The scalar code goes on
+        // where the window ends.
+        template <typename Fn>
+        void take(Fn&& Span, bool Keep = true)
+        {
+            auto Buf = cin.rdbuf();
+            if (!Buf || !cin.good())
+                return;
+            const char* S = WindowImpl::begin(Buf);
+            if (!S)
+                return;
+            size_t n = Span(S, std::min<size_t>(WindowImpl::size(Buf), INT_MAX));
+            if (!n)
+                return;
+            if (Keep)
+                CurStr.append(S, n);
+            WindowImpl::skip(Buf, n);
+        }
+
         Token get_next_token()
         {
             // Skip space
@@ -131,6 +181,9 @@ namespace Lexer
             {
                 if (LastChar == '\n')
                     LineNumber++;
+                size_t Lines = 0;
+                take([&](const char* S, size_t n) { return Kernel::kernels().space_span(S, n, &Lines); }, false);
+                LineNumber += Lines;
                 LastChar = cin.get();
                 if (cin.eof()) // End of file
                     return CurToken = Token(Type::tok_eof, "");
@@ -141,8 +194,12 @@ namespace Lexer
             if (isalpha(LastChar) || LastChar == '_')
             {
                 CurStr = LastChar;
+                take(Kernel::kernels().word_span);
                 while (isalnum((LastChar = cin.get())) || LastChar == '_')
+                {
                     CurStr += LastChar;
+                    take(Kernel::kernels().word_span);
+                }
 
                 // Is keyword?
                 if (KeywordToken.find(CurStr) != KeywordToken.end())
@@ -156,15 +213,23 @@ namespace Lexer
             if (isdigit(LastChar))
             {
                 CurStr = LastChar;
+                take(Kernel::kernels().digit_span);
                 while (isdigit(LastChar = cin.get()))
+                {
                     CurStr += LastChar;
+                    take(Kernel::kernels().digit_span);
+                }
 
                 if (LastChar != '.')
                     return CurToken = Token(Type::tok_integer, CurStr);
 
                 CurStr += LastChar;
+                take(Kernel::kernels().digit_span);
                 while (isdigit((LastChar = cin.get())))
+                {
                     CurStr += LastChar;
+                    take(Kernel::kernels().digit_span);
+                }
 
                 return CurToken = Token(Type::tok_float, CurStr);
             }
@@ -175,14 +240,15 @@ namespace Lexer
             {
                 char end_char = LastChar;
                 CurStr = "";
-                while (true)
+                // An empty string ends at once, an unterminated one at the end of the text
+                while (cin.peek() != end_char && cin.peek() != EOF)
                 {
                     if (cin.peek() == '\\')
                         CurStr += get_special_char();
                     else
                         CurStr += cin.get();
-                    if (cin.peek() == end_char)
-                        break;
+                    // Up to the next quote or escape
+                    take([&](const char* S, size_t n) { return Kernel::kernels().quote_span(S, n, end_char); });
                 }
                 cin.get(); // eat end_char
                 LastChar = cin.get(); // pre-read a char
@@ -193,17 +259,52 @@ namespace Lexer
             // (//.*?\n)
             if (LastChar == '/' && cin.peek() == '/')
             {
+                take(Kernel::kernels().line_span, false);
                 while (cin.peek() != '\n' && cin.peek() != '\r')
+                {
                     cin.get();
+                    take(Kernel::kernels().line_span, false);
+                }
                 while (cin.peek() == '\n' || cin.peek() == '\r')
                 {
-                    LineNumber++;
-                    cin.get();
+                    if (cin.get() == '\n') // \r\n is one line
+                        LineNumber++;
                 }
                 LastChar = cin.get();
                 return get_next_token();
             }
 
+            // Regular expression, where a value is expected: after an operator,
+            // '(' or a keyword. After an operand '/' divides.
+            // (/(\\.|\[(\\.|[^\]])*\]|[^/\n])+/[a-z]*)
+            if (LastChar == '/' && !after_operand())
+            {
+                CurStr = LastChar;
+                bool InClass = false;
+                while (true)
+                {
+                    LastChar = cin.get();
+                    if (cin.eof() || LastChar == '\n') // unterminated, the parser reports it
+                        return CurToken = Token(Type::tok_regex, "");
+                    CurStr += LastChar;
+                    if (LastChar == '\\')
+                    {
+                        if (cin.peek() == '\n' || cin.peek() == EOF)
+                            continue;
+                        CurStr += cin.get();
+                    }
+                    else if (LastChar == '[')
+                        InClass = true;
+                    else if (LastChar == ']')
+                        InClass = false;
+                    else if (LastChar == '/' && !InClass)
+                        break;
+                }
+                while (isalpha(LastChar = cin.get())) // flags
+                    CurStr += LastChar;
+                return CurToken = Token(Type::tok_regex, CurStr);
+            }
+
             // Operator
             CurStr = LastChar;
             switch (LastChar)
@@ -234,6 +335,21 @@ namespace Lexer
             return CurToken;
         }
 
+        // The previous token ends an operand
+        bool after_operand()
+        {
+            switch (CurToken.tk_type)
+            {
+                case Type::tok_identifier: case Type::tok_integer: case Type::tok_float:
+                case Type::tok_string: case Type::tok_regex: case Type::tok_null:
+                    return true;
+                case Type::tok_single_char:
+                    return CurToken.tk_string == ")" || CurToken.tk_string == "]";
+                default:
+                    return false;
+            }
+        }
+
         void double_char_op(char c)
         {
             if (cin.peek() == c)
@@ -0,0 +1,410 @@
+#include "loop.h"
+#include "output.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace Loop;
+
+/* -- Fiber -- */
+namespace
+{
+    thread_local FiberImpl* Current = nullptr;
+
+    // 1 MiB unless TINYJS_FIBER_STACK gives the size in KiB, deep recursion
+    // in an async function stops with a RangeError first (stack_left).
+    // Reserved, not committed: pages are only touched as the stack grows.
+    // The lowest page is a guard, an overflow faults instead of corrupting.
+    const size_t GuardSize = 4096;
+    std::vector<void*> FreeStacks; // fibers run on one thread
+
+    size_t stack_size()
+    {
+        static const size_t Size = [] {
+            size_t KiB = 1024;
+            if (auto Env = getenv("TINYJS_FIBER_STACK"))
+                KiB = strtoul(Env, nullptr, 10);
+            KiB = std::max<size_t>(KiB, 256);
+            return (KiB + 3) / 4 * GuardSize;
+        }();
+        return Size;
+    }
+
+    void* alloc_stack()
+    {
+        if (!FreeStacks.empty())
+        {
+            auto S = FreeStacks.back();
+            FreeStacks.pop_back();
+            return S;
+        }
+        auto S = mmap(nullptr, stack_size() + GuardSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+        if (S == MAP_FAILED)
+            throw std::bad_alloc();
+        mprotect(S, GuardSize, PROT_NONE);
+        return S;
+    }
+
+    void free_stack(void* S)
+    {
+        if (FreeStacks.size() < 64)
+            FreeStacks.push_back(S);
+        else
+            munmap(S, stack_size() + GuardSize);
+    }
+}
+
+FiberImpl::FiberImpl(Body Fn) : Stack(alloc_stack()), Fn(std::move(Fn))
+{
+    getcontext(&Context);
+    Context.uc_stack.ss_sp = static_cast<char*>(Stack) + GuardSize;
+    Context.uc_stack.ss_size = stack_size();
+    Context.uc_link = nullptr;
+    makecontext(&Context, &FiberImpl::entry, 0);
+}
+
+FiberImpl::~FiberImpl()
+{ free_stack(Stack); }
+
+FiberImpl* FiberImpl::current()
+{ return Current; }
+
+const char* FiberImpl::stack_low() const
+{ return static_cast<char*>(Stack) + GuardSize; }
+
+// A thread asks for its bounds once
+size_t Loop::stack_left()
+{
+    thread_local const char* ThreadLow = nullptr;
+    auto Here = static_cast<const char*>(__builtin_frame_address(0));
+    const char* Low = Current ? Current->stack_low() : ThreadLow;
+    if (!Low)
+    {
+        pthread_attr_t Attr;
+        void* Addr = nullptr;
+        size_t Size = 0;
+        if (pthread_getattr_np(pthread_self(), &Attr) == 0)
+        {
+            pthread_attr_getstack(&Attr, &Addr, &Size);
+            pthread_attr_destroy(&Attr);
+        }
+        Low = ThreadLow = Addr ? static_cast<const char*>(Addr) : Here - (8 << 20);
+    }
+    return Here > Low ? Here - Low : 0;
+}
+
+void FiberImpl::entry()
+{
+    auto F = Current;
+    F->Fn();
+    F->Fn = nullptr; // the captures go now, not when the fiber is deleted
+    F->Done = true;
+    swapcontext(&F->Context, &F->Caller); // never comes back
+}
+
+bool FiberImpl::resume()
+{
+    Prev = Current;
+    Current = this;
+    swapcontext(&Caller, &Context);
+    Current = Prev;
+    return Done;
+}
+
+void FiberImpl::suspend()
+{ swapcontext(&Context, &Caller); }
+/* ++ Fiber ++ */
+
+LoopImpl& Loop::loop()
+{
+    static LoopImpl L;
+    return L;
+}
+
+LoopImpl::~LoopImpl()
+{
+    if (Reader.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> G(ReaderLock);
+            ReaderStop = true;
+        }
+        ReaderWake.notify_all();
+        Reader.join();
+    }
+    for (auto& R : PollReads)
+        close(R.first);
+    if (ReaderEvent >= 0)
+        close(ReaderEvent);
+    if (Epoll >= 0)
+        close(Epoll);
+}
+
+double LoopImpl::now()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+void LoopImpl::run(const std::function<bool()>& Until)
+{
+    while (true)
+    {
+        run_microtasks();
+        if ((Until && Until()) || !pending())
+            return;
+
+        // Cancelled timers leave their deadline behind
+        while (!Deadlines.empty() && !Timers.count(Deadlines.top().Id))
+            Deadlines.pop();
+
+        int Timeout = -1;
+        if (!Deadlines.empty())
+        {
+            double Ms = std::ceil(Deadlines.top().At - now());
+            Timeout = Ms <= 0 ? 0 : (int)std::min<double>(Ms, INT_MAX);
+        }
+        wait(Timeout);
+        run_timers();
+    }
+}
+
+void LoopImpl::run_microtasks()
+{
+    while (!Microtasks.empty())
+    {
+        auto Fn = std::move(Microtasks.front());
+        Microtasks.pop_front();
+        Fn();
+    }
+}
+
+/* -- Timer -- */
+uint64_t LoopImpl::add_timer(double Ms, double Interval, Callback Fn, bool Keep)
+{
+    auto Id = NextTimer++;
+    Timers[Id] = Timer{ Interval, std::move(Fn), Keep };
+    Unkept += !Keep;
+    Deadlines.push(Due{ now() + std::max(Ms, 0.0), NextSeq++, Id });
+    return Id;
+}
+
+bool LoopImpl::cancel_timer(uint64_t Id)
+{
+    auto It = Timers.find(Id);
+    if (It == Timers.end())
+        return false;
+    Unkept -= !It->second.Keep;
+    Timers.erase(It);
+    return true;
+}
+
+void LoopImpl::run_timers()
+{
+    double Now = now();
+    while (!Deadlines.empty() && Deadlines.top().At <= Now)
+    {
+        auto D = Deadlines.top();
+        Deadlines.pop();
+        auto It = Timers.find(D.Id);
+        if (It == Timers.end()) // cancelled
+            continue;
+
+        // An interval is rearmed first, the callback may clear it
+        Callback Fn;
+        if (It->second.Interval > 0)
+        {
+            Fn = It->second.Fn;
+            double Next = D.At + It->second.Interval;
+            Deadlines.push(Due{ Next > Now ? Next : Now + It->second.Interval, NextSeq++, D.Id });
+        }
+        else
+        {
+            Fn = std::move(It->second.Fn);
+            Unkept -= !It->second.Keep;
+            Timers.erase(It);
+        }
+        Fn();
+        run_microtasks();
+    }
+}
+/* ++ Timer ++ */
+
+/* -- Read -- */
+bool LoopImpl::ensure_epoll()
+{
+    if (Epoll >= 0)
+        return true;
+    Epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (Epoll < 0)
+        return false;
+    ReaderEvent = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event Ev{};
+    Ev.events = EPOLLIN;
+    Ev.data.fd = ReaderEvent;
+    epoll_ctl(Epoll, EPOLL_CTL_ADD, ReaderEvent, &Ev);
+    return true;
+}
+
+// Block until an fd is ready or TimeoutMs (-1: no timeout) has passed
+void LoopImpl::wait(int TimeoutMs)
+{
+    if (TimeoutMs)
+        Output::out().flush(); // show what was printed before going idle
+    if (Epoll < 0)
+    {
+        if (TimeoutMs > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(TimeoutMs));
+        return;
+    }
+
+    epoll_event Events[64];
+    int N = epoll_wait(Epoll, Events, 64, TimeoutMs);
+    for (int i = 0; i < N; i++)
+    {
+        if (Events[i].data.fd == ReaderEvent)
+            on_files_done();
+        else
+            on_readable(Events[i].data.fd);
+    }
+}
+
+int LoopImpl::read_file(const std::string& Path, ReadDone Done)
+{
+    if (!ensure_epoll())
+        return errno;
+    int Fd = open(Path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (Fd < 0)
+        return errno;
+
+    struct stat St;
+    if (fstat(Fd, &St) == 0 && !S_ISREG(St.st_mode))
+    {
+        epoll_event Ev{};
+        Ev.events = EPOLLIN;
+        Ev.data.fd = Fd;
+        if (epoll_ctl(Epoll, EPOLL_CTL_ADD, Fd, &Ev) == 0)
+        {
+            PollReads[Fd] = PollRead{ std::string(), std::move(Done) };
+            ActiveReads++;
+            return 0;
+        }
+    }
+
+    // A regular file or an fd epoll refuses, blocking reads on the helper
+    fcntl(Fd, F_SETFL, fcntl(Fd, F_GETFL) & ~O_NONBLOCK);
+    start_file_read(Fd, std::move(Done));
+    return 0;
+}
+
+void LoopImpl::on_readable(int Fd)
+{
+    auto It = PollReads.find(Fd);
+    if (It == PollReads.end())
+        return;
+
+    // A bounded amount per wakeup, a fast writer must not starve the timers
+    static char Buf[64 << 10];
+    for (int Round = 0; Round < 16; Round++)
+    {
+        ssize_t N = read(Fd, Buf, sizeof(Buf));
+        if (N > 0)
+        {
+            It->second.Data.append(Buf, N);
+            continue;
+        }
+        if (N < 0 && errno == EINTR)
+            continue;
+        if (N < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return;
+
+        // End of file or error
+        int Err = N < 0 ? errno : 0;
+        epoll_ctl(Epoll, EPOLL_CTL_DEL, Fd, nullptr);
+        close(Fd);
+        auto R = std::move(It->second);
+        PollReads.erase(It);
+        ActiveReads--;
+        R.Done(std::move(R.Data), Err);
+        return;
+    }
+}
+
+void LoopImpl::start_file_read(int Fd, ReadDone Done)
+{
+    std::unique_ptr<FileRead> Job(new FileRead);
+    Job->Fd = Fd;
+    Job->Done = std::move(Done);
+    ActiveReads++;
+    {
+        std::lock_guard<std::mutex> G(ReaderLock);
+        ReaderJobs.push_back(std::move(Job));
+    }
+    if (!Reader.joinable())
+        Reader = std::thread(&LoopImpl::reader_main, this);
+    ReaderWake.notify_one();
+}
+
+void LoopImpl::reader_main()
+{
+    std::vector<char> Buf(64 << 10);
+    std::unique_lock<std::mutex> G(ReaderLock);
+    while (true)
+    {
+        ReaderWake.wait(G, [this] { return ReaderStop || !ReaderJobs.empty(); });
+        if (ReaderStop)
+            return;
+        auto Job = std::move(ReaderJobs.front());
+        ReaderJobs.pop_front();
+        G.unlock();
+
+        while (true)
+        {
+            ssize_t N = read(Job->Fd, Buf.data(), Buf.size());
+            if (N > 0)
+                Job->Data.append(Buf.data(), N);
+            else if (N < 0 && errno == EINTR)
+                continue;
+            else
+            {
+                Job->Err = N < 0 ? errno : 0;
+                break;
+            }
+        }
+        close(Job->Fd);
+
+        G.lock();
+        ReaderDone.push_back(std::move(Job));
+        uint64_t One = 1;
+        (void)!write(ReaderEvent, &One, sizeof(One));
+    }
+}
+
+void LoopImpl::on_files_done()
+{
+    uint64_t Count;
+    (void)!read(ReaderEvent, &Count, sizeof(Count));
+
+    std::deque<std::unique_ptr<FileRead>> Done;
+    {
+        std::lock_guard<std::mutex> G(ReaderLock);
+        Done.swap(ReaderDone);
+    }
+    for (auto& Job : Done)
+    {
+        ActiveReads--;
+        Job->Done(std::move(Job->Data), Job->Err);
+    }
+}
+/* ++ Read ++ */
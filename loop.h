@@ -0,0 +1,170 @@
+#ifndef TINYJS_LOOP
+#define TINYJS_LOOP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <ucontext.h>
+
+// Single threaded event loop of the evaluator.
+//
+// One turn: run every microtask (promise reactions, resumed fibers), then
+// wait in epoll until the next timer is due or a read makes progress, then
+// run the due timers, each followed by the microtasks it queued.
+//
+// Reads: a pipe, FIFO, socket or terminal is read non-blocking as epoll
+//   reports data. A regular file can not be polled (epoll refuses it and it
+//   is always "readable"), it is read on a helper thread whose completions
+//   come back through an eventfd in the same epoll set.
+//
+// Fibers: an async function runs on its own stack (ucontext). 'await' on a
+//   pending promise suspends the fiber back to whoever resumed it, the
+//   promise resumes it from a microtask once settled. Fibers only live on
+//   the thread that runs the loop. A fiber whose stack can not be mapped
+//   throws std::bad_alloc from its constructor.
+//
+// stack_left() is what remains below the caller on the stack it runs on,
+//   a fiber's or its thread's, for recursion to stop before it overflows.
+
+namespace Loop
+{
+    class FiberImpl
+    {
+    public:
+        using Body = std::function<void()>;
+
+        explicit FiberImpl(Body Fn);
+        ~FiberImpl();
+
+        FiberImpl(const FiberImpl&) = delete;
+        const FiberImpl& operator =(const FiberImpl&) = delete;
+
+        // Run the body until it suspends or ends, true once it has ended
+        bool resume();
+        // From inside the body: go back to the caller of resume()
+        void suspend();
+        bool done() const { return Done; }
+
+        // The running fiber, nullptr on the main stack
+        static FiberImpl* current();
+        // Lowest usable address of its stack
+        const char* stack_low() const;
+
+    private:
+        ucontext_t Context;
+        ucontext_t Caller;
+        void* Stack;
+        Body Fn;
+        bool Done = false;
+        FiberImpl* Prev = nullptr;
+
+        static void entry();
+    };
+
+    class LoopImpl
+    {
+    public:
+        using Callback = std::function<void()>;
+        // Whole content of a read, Err is an errno value (0: success)
+        using ReadDone = std::function<void(std::string Data, int Err)>;
+
+        LoopImpl() = default;
+        ~LoopImpl();
+
+        LoopImpl(const LoopImpl&) = delete;
+        const LoopImpl& operator =(const LoopImpl&) = delete;
+
+        void queue_microtask(Callback Fn) { Microtasks.push_back(std::move(Fn)); }
+
+        // Call Fn after Ms milliseconds, then every Interval ms if Interval > 0.
+        // A timer not to Keep does not hold the loop open by itself.
+        // Returns the id for cancel_timer.
+        uint64_t add_timer(double Ms, double Interval, Callback Fn, bool Keep = true);
+        bool cancel_timer(uint64_t Id);
+
+        // Read all of Path without blocking the loop, Done runs on the loop.
+        // Returns the errno of open(), Done is not called then.
+        int read_file(const std::string& Path, ReadDone Done);
+
+        // Something is still to run or to wait for
+        bool pending() const { return !Microtasks.empty() || Timers.size() > Unkept || ActiveReads; }
+
+        // Run until Until() holds or nothing is pending
+        void run(const std::function<bool()>& Until = nullptr);
+
+    private:
+        std::deque<Callback> Microtasks;
+
+        /* Timers */
+        struct Timer
+        {
+            double Interval;
+            Callback Fn;
+            bool Keep;
+        };
+        struct Due
+        {
+            double At;
+            uint64_t Seq; // same deadline: first added runs first
+            uint64_t Id;
+            bool operator >(const Due& O) const { return At != O.At ? At > O.At : Seq > O.Seq; }
+        };
+        std::priority_queue<Due, std::vector<Due>, std::greater<Due>> Deadlines;
+        std::unordered_map<uint64_t, Timer> Timers;
+        uint64_t NextTimer = 1;
+        uint64_t NextSeq = 0;
+        size_t Unkept = 0;
+
+        /* Reads */
+        struct PollRead
+        {
+            std::string Data;
+            ReadDone Done;
+        };
+        std::unordered_map<int, PollRead> PollReads; // by fd
+        size_t ActiveReads = 0;
+        int Epoll = -1;
+
+        // Helper thread for files epoll can not watch
+        struct FileRead
+        {
+            int Fd;
+            std::string Data;
+            int Err = 0;
+            ReadDone Done;
+        };
+        std::thread Reader;
+        std::mutex ReaderLock;
+        std::condition_variable ReaderWake;
+        std::deque<std::unique_ptr<FileRead>> ReaderJobs, ReaderDone;
+        bool ReaderStop = false;
+        int ReaderEvent = -1; // eventfd, readable when ReaderDone is not empty
+
+        static double now();
+        void run_microtasks();
+        void run_timers();
+        void wait(int TimeoutMs);
+        bool ensure_epoll();
+        void on_readable(int Fd);
+        void on_files_done();
+        void reader_main();
+        void start_file_read(int Fd, ReadDone Done);
+    };
+
+    // The loop of the main evaluator
+    LoopImpl& loop();
+
+    // Bytes left on the running stack
+    size_t stack_left();
+}
+
+#endif
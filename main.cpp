@@ -2,6 +2,7 @@
 #include "eval.h"
 #include <string>
 #include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <ctime>
@@ -20,19 +21,22 @@ void test_lexer()
     }
 }
 
-void test_parser()
+// Path: the script, "test2" if none is given
+void test_parser(const char* Path)
 {
-    std::ifstream fin("test2");
+    std::ifstream fin(Path);
     Parser::ParserImpl t(fin.rdbuf());
     Eval::EvalImpl e(t.parser());
+    if (auto Ms = getenv("TINYJS_WATCH"))
+        e.watch(Path, atof(Ms));
     e.eval();
 }
 
-int main()
+int main(int argc, char** argv)
 {
     clock_t _start, _end;
     _start = clock();
-    test_parser();
+    test_parser(argc > 1 ? argv[1] : "test2");
     _end = clock();
     cout << "Time : " << double(_end - _start) / CLOCKS_PER_SEC << endl;
     return 0;
@@ -0,0 +1,322 @@
+#include "memo.h"
+#include "eval.h"
+#include <cstdio>
+#include <functional>
+#include <unordered_set>
+using namespace Eval;
+
+/* -- Table -- */
+Memo::Stats& Memo::stats()
+{
+    static Stats S;
+    return S;
+}
+
+std::string Memo::stats_string()
+{
+    auto& S = stats();
+    char Buf[160];
+    snprintf(Buf, sizeof(Buf), "[memo] hits: %llu, misses: %llu, evictions: %llu, bypassed: %llu",
+             S.Hits, S.Misses, S.Evictions, S.Bypassed);
+    return Buf;
+}
+
+Memo::TableImpl::TableImpl(size_t N)
+{
+    size_t Size = 1;
+    while (Size < N)
+        Size <<= 1;
+    Entries.resize(Size);
+    Mask = Size - 1;
+}
+
+bool Memo::TableImpl::make_key(const std::vector<Value>& Args, std::string& Key)
+{
+    Key.clear();
+    for (auto& A : Args)
+    {
+        if (!A)
+            return false;
+        switch (A->SubType)
+        {
+            case Type::integer_expr:
+            {
+                auto V = std::static_pointer_cast<IntegerValueExprAST>(A)->Val;
+                Key.push_back('i');
+                Key.append(reinterpret_cast<const char*>(&V), sizeof(V));
+                break;
+            }
+            case Type::float_expr:
+            {
+                auto V = std::static_pointer_cast<FloatValueExprAST>(A)->Val;
+                Key.push_back('f');
+                Key.append(reinterpret_cast<const char*>(&V), sizeof(V));
+                break;
+            }
+            case Type::string_expr:
+            {
+                auto& V = std::static_pointer_cast<StringValueExprAST>(A)->Val;
+                uint32_t Len = V.size();
+                Key.push_back('s');
+                Key.append(reinterpret_cast<const char*>(&Len), sizeof(Len));
+                Key.append(V);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+// Values are never changed in place, a cached one can be handed out again
+bool Memo::TableImpl::is_cacheable(const Value& Result)
+{
+    return Result && (isInt(Result) || isFloat(Result) || isString(Result));
+}
+
+Memo::Value Memo::TableImpl::find(const std::string& Key)
+{
+    auto Hash = std::hash<std::string>()(Key);
+    auto& E = Entries[Hash & Mask];
+    if (E.Result && E.Hash == Hash && E.Key == Key)
+    {
+        stats().Hits++;
+        return E.Result;
+    }
+    stats().Misses++;
+    return nullptr;
+}
+
+void Memo::TableImpl::insert(const std::string& Key, Value Result)
+{
+    auto Hash = std::hash<std::string>()(Key);
+    auto& E = Entries[Hash & Mask];
+    if (E.Result)
+        stats().Evictions++;
+    E.Hash = Hash;
+    E.Key = Key;
+    E.Result = Result;
+}
+
+void Memo::TableImpl::bypass()
+{ stats().Bypassed++; }
+
+void Memo::TableImpl::renew(unsigned V)
+{
+    if (Version == V)
+        return;
+    for (auto& E : Entries)
+        E = Entry();
+    Version = V;
+}
+/* ++ Table ++ */
+
+/* -- Purity -- */
+// A function is pure when a call only depends on its arguments and changes
+// nothing outside its own frame:
+//   - it reads and writes only parameters and `let` locals,
+//   - it calls only pure script functions and pure built in functions,
+//   - no `var`, no element assignment, no method call (push, pop),
+//     no function values (nested functions, calling an expression),
+//   - it is not async and does not await.
+// Callees are resolved when the analysis runs, the result is kept on the
+// function. A closure checks them again (is_pure of a closure): a name bound
+// to another function since has the analysis run again.
+namespace
+{
+    struct PurityCheck
+    {
+        EvalImpl& Eval;
+        std::shared_ptr<FunctionAST> Func;
+        std::unordered_set<std::string> Locals;
+
+        bool local(const std::string& Name) { return Locals.count(Name) != 0; }
+
+        void depend(const std::string& Name, const std::shared_ptr<FunctionAST>& G)
+        {
+            auto& Callees = Func->Callees;
+            for (auto& C : Callees)
+                if (C.first == Name && C.second.lock() == G)
+                    return;
+            Callees.push_back({ Name, G });
+        }
+
+        bool callee(const CallExprAST& C)
+        {
+            if (local(C.Callee))
+                return false;
+            if (C.Callee == Func->Proto->Name) // recursion
+            {
+                depend(C.Callee, Func);
+                return true;
+            }
+            auto F = Eval.find_name(C.Callee);
+            if (!F)
+            {
+                auto Native = C.Native ? C.Native : Eval.get_native(C.Callee);
+                return Native && Native->Pure;
+            }
+            if (!isClosure(F))
+                return false;
+            auto G = std::static_pointer_cast<ClosureValueExprAST>(F)->Func;
+            if (!Eval.is_pure(G))
+                return false;
+            depend(C.Callee, G);
+            for (auto& D : std::vector<std::pair<std::string, std::weak_ptr<FunctionAST>>>(G->Callees))
+                if (auto H = D.second.lock())
+                    depend(D.first, H);
+            return true;
+        }
+
+        bool check(const std::shared_ptr<ExprAST>& E)
+        {
+            bool Pure = true;
+            for_each_node(E, [&](const std::shared_ptr<ExprAST>& N) {
+                if (!Pure)
+                    return false;
+                switch (N->SubType)
+                {
+                    case Type::variable_expr:
+                    {
+                        auto V = std::static_pointer_cast<VariableExprAST>(N);
+                        Pure = V->DefineType == "let" || (V->DefineType.empty() && local(V->Name));
+                        return false;
+                    }
+                    case Type::binary_op_expr:
+                    {
+                        auto B = std::static_pointer_cast<BinaryOpExprAST>(N);
+                        if (B->Op == "=" && !isVariable(B->LHS))
+                            Pure = false;
+                        break;
+                    }
+                    case Type::call_expr:
+                        if (!callee(*std::static_pointer_cast<CallExprAST>(N)))
+                            Pure = false;
+                        break;
+                    case Type::function_expr: case Type::apply_expr: case Type::method_call_expr:
+                    case Type::await_expr:
+                        Pure = false;
+                        break;
+                    default:
+                        break;
+                }
+                return Pure;
+            });
+            return Pure;
+        }
+    };
+
+    // Parameters and every `let` of the body
+    void collect_locals(const std::shared_ptr<ExprAST>& E, std::unordered_set<std::string>& Locals)
+    {
+        for_each_node(E, [&](const std::shared_ptr<ExprAST>& N) {
+            if (N->SubType == Type::variable_expr)
+            {
+                auto V = std::static_pointer_cast<VariableExprAST>(N);
+                if (V->DefineType == "let")
+                    Locals.insert(V->Name);
+                return false;
+            }
+            return N->SubType != Type::function_expr;
+        });
+    }
+}
+
+bool EvalImpl::is_pure(std::shared_ptr<FunctionAST> F)
+{
+    if (F->Purity != FunctionAST::PurityState::unknown)
+        return F->Purity != FunctionAST::PurityState::impure;
+    if (F->IsAsync)
+    {
+        F->Purity = FunctionAST::PurityState::impure;
+        return false;
+    }
+
+    // Mutual recursion sees the function as pure until proven otherwise
+    F->Purity = FunctionAST::PurityState::checking;
+    F->Callees.clear();
+    PurityCheck Check{ *this, F, {} };
+    for (auto& P : F->Proto->Args)
+        Check.Locals.insert(get_name(P));
+    collect_locals(F->Body, Check.Locals);
+
+    bool Pure = true;
+    for (auto& P : F->Proto->Args)
+        if (isBinaryOp(P)) // default value
+            Pure = Pure && Check.check(ptr_to<BinaryOpExprAST>(P)->RHS);
+    Pure = Pure && Check.check(F->Body);
+
+    F->Purity = Pure ? FunctionAST::PurityState::pure : FunctionAST::PurityState::impure;
+    return Pure;
+}
+
+// is_pure of the function of C, analysed again if one of its callees is now
+// bound to another function
+bool EvalImpl::is_pure(const ClosureValueExprAST& C)
+{
+    auto& F = C.Func;
+    if (F->Purity != FunctionAST::PurityState::pure)
+        return is_pure(F);
+    bool Rebound = false;
+    for (auto& D : F->Callees)
+    {
+        if (C.SelfNamed && D.first == F->Proto->Name) // itself, always
+            continue;
+        auto V = callee_of(C, D.first);
+        if (!V || !isClosure(V) || ptr_to<ClosureValueExprAST>(V)->Func != D.second.lock())
+        {
+            Rebound = true;
+            break;
+        }
+    }
+    if (!Rebound)
+        return true;
+
+    // What they call may have changed too
+    auto Callees = std::move(F->Callees);
+    for (auto& D : Callees)
+        if (auto G = D.second.lock())
+        {
+            G->Purity = FunctionAST::PurityState::unknown;
+            G->PurityVersion++;
+        }
+    F->Purity = FunctionAST::PurityState::unknown;
+    F->PurityVersion++;
+    return is_pure(F);
+}
+
+// Name as the body of C finds it: an upvalue, else a global
+std::shared_ptr<ExprAST> EvalImpl::callee_of(const ClosureValueExprAST& C, const std::string& Name)
+{
+    for (auto& U : C.Upvalues)
+        if (U.first == Name)
+            return U.second->Val;
+    auto G = C.Globals.lock();
+    return (G ? G : Scope)->get(Name);
+}
+/* ++ Purity ++ */
+
+// memoize(f) / memoize(f, entries) => f with a result cache
+std::shared_ptr<ExprAST> EvalImpl::builtin_memoize(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isClosure(Args[0]))
+        eval_err("[memoize] TypeError: argument is not a function.");
+    auto F = ptr_to<ClosureValueExprAST>(Args[0]);
+    if (!is_pure(*F))
+        eval_err("[memoize] TypeError: '" + get_name(F) + "' is not pure, it can not be memoized.");
+
+    size_t Entries = Memo::TableImpl::DefaultEntries;
+    if (Args.size() > 1)
+    {
+        if (!isInt(Args[1]) || get_value<IntegerValueExprAST>(Args[1]) <= 0)
+            eval_err("[memoize] RangeError: table size must be a positive integer.");
+        Entries = get_value<IntegerValueExprAST>(Args[1]);
+    }
+
+    auto M = GC::make_traced<ClosureValueExprAST>(F->Func);
+    M->Upvalues = F->Upvalues;
+    M->Globals = F->Globals;
+    M->Memo = std::make_shared<Memo::TableImpl>(Entries);
+    return M;
+}
@@ -0,0 +1,64 @@
+#ifndef TINYJS_MEMO
+#define TINYJS_MEMO
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace AST { class ExprAST; }
+
+// Result cache of a memoized pure function.
+// Calls are keyed by the bytes of their primitive arguments. The table is
+// direct mapped with a fixed number of entries, a new result replaces
+// whatever lived in its slot.
+
+namespace Memo
+{
+    using Value = std::shared_ptr<AST::ExprAST>;
+
+    struct Stats
+    {
+        unsigned long long Hits = 0;
+        unsigned long long Misses = 0;
+        unsigned long long Evictions = 0;
+        unsigned long long Bypassed = 0; // non primitive argument or result
+    };
+
+    class TableImpl
+    {
+    private:
+        struct Entry
+        {
+            uint64_t Hash = 0;
+            std::string Key;
+            Value Result;
+        };
+        std::vector<Entry> Entries;
+        uint64_t Mask;
+        unsigned Version = 0; // FunctionAST::PurityVersion of the results
+
+    public:
+        static const size_t DefaultEntries = 1 << 12;
+
+        // Entries is rounded up to a power of two
+        explicit TableImpl(size_t Entries = DefaultEntries);
+
+        // Key of the arguments, false if one is not a number or string.
+        static bool make_key(const std::vector<Value>& Args, std::string& Key);
+        static bool is_cacheable(const Value& Result);
+
+        Value find(const std::string& Key);
+        void insert(const std::string& Key, Value Result);
+        void bypass();
+        // Drop every result of another analysis of the function
+        void renew(unsigned Version);
+    };
+
+    // Counters of every table
+    Stats& stats();
+    std::string stats_string();
+}
+
+#endif
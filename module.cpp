@@ -0,0 +1,219 @@
+#include "module.h"
+#include "eval.h"
+#include "parser.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <sys/stat.h>
+using namespace Eval;
+
+/* -- Cache -- */
+Module::CacheImpl& Module::cache()
+{
+    static CacheImpl C;
+    return C;
+}
+
+std::string Module::CacheImpl::resolve(const std::string& Spec, const std::string& Dir)
+{
+    std::vector<std::string> Candidates;
+    if (Spec[0] == '/')
+        Candidates.push_back(Spec);
+    else if (Spec.compare(0, 2, "./") == 0 || Spec.compare(0, 3, "../") == 0)
+        Candidates.push_back(Dir + "/" + Spec);
+    else
+    {
+        Candidates.push_back(Dir + "/" + Spec);
+        if (const char* Env = getenv("TINYJS_PATH"))
+        {
+            std::string Paths = Env;
+            for (size_t Begin = 0, End; Begin <= Paths.size(); Begin = End + 1)
+            {
+                End = Paths.find(':', Begin);
+                if (End == std::string::npos)
+                    End = Paths.size();
+                if (End > Begin)
+                    Candidates.push_back(Paths.substr(Begin, End - Begin) + "/" + Spec);
+            }
+        }
+    }
+
+    char Real[PATH_MAX];
+    struct stat St;
+    for (auto& C : Candidates)
+        for (auto& Name : { C, C + ".js" })
+            if (stat(Name.c_str(), &St) == 0 && S_ISREG(St.st_mode) && realpath(Name.c_str(), Real))
+                return Real;
+    return "";
+}
+
+std::shared_ptr<const Module::SourceImpl> Module::CacheImpl::load(const std::string& Path, const Preparer& Prepare, std::string& Err)
+{
+    std::ifstream In(Path, std::ios::binary);
+    if (!In)
+    {
+        Err = "can not read '" + Path + "': " + strerror(errno);
+        return nullptr;
+    }
+    std::string Text((std::istreambuf_iterator<char>(In)), std::istreambuf_iterator<char>());
+    uint64_t Hash = std::hash<std::string>()(Text);
+
+    // The lexer reads std::cin, one parse at a time
+    std::lock_guard<std::mutex> G(Lock);
+    auto It = Sources.find(Path);
+    if (It != Sources.end() && It->second->Hash == Hash)
+    {
+        Hits++;
+        return It->second;
+    }
+
+    auto S = std::make_shared<SourceImpl>();
+    S->Path = Path;
+    S->Hash = Hash;
+    {
+        std::stringbuf Buf(Text);
+        Parser::ParserImpl P(&Buf);
+        P.FileName = Path;
+        S->Body = P.parser();
+    }
+    for (auto& E : S->Body)
+    {
+        if (E->SubType != AST::Type::export_expr)
+            continue;
+        for (auto& N : std::static_pointer_cast<AST::ExportExprAST>(E)->Names)
+        {
+            for (auto& X : S->Exports)
+                if (X.first == N.second)
+                {
+                    Err = "'" + Path + "' exports '" + N.second + "' twice";
+                    return nullptr;
+                }
+            S->Exports.emplace_back(N.second, N.first);
+        }
+    }
+    Prepare(S->Body);
+    Parses++;
+    Sources[Path] = S;
+    return S;
+}
+
+std::string Module::CacheImpl::stats_string()
+{
+    std::lock_guard<std::mutex> G(Lock);
+    char Buf[160];
+    snprintf(Buf, sizeof(Buf), "[module] files: %zu, parses: %llu, cache hits: %llu", Sources.size(), Parses, Hits);
+    return Buf;
+}
+/* ++ Cache ++ */
+
+/* -- Import -- */
+// Fill what the evaluator would write on first use, the statements are
+// shared read only from here on. Purity stays lazy, it depends on what the
+// names are bound to when it is asked.
+void EvalImpl::prepare_module(const std::vector<std::shared_ptr<ExprAST>>& Body)
+{
+    resolve_built_in(Body);
+    for (auto& S : Body)
+        for_each_node(S, [&](const std::shared_ptr<ExprAST>& E) {
+            if (isFunction(E))
+                resolve_upvalues(ptr_to<FunctionAST>(E));
+            else if (isFor(E))
+                match_counting_for(ptr_to<ForExprAST>(E));
+            return true;
+        });
+}
+
+// The module Spec of the running file, run by this evaluator once
+EvalImpl::ModuleInstance& EvalImpl::load_module(const std::string& Spec)
+{
+    auto Path = Module::CacheImpl::resolve(Spec, ModuleDir);
+    if (Path.empty())
+        eval_err("[eval_import] Error: can not find module '" + Spec + "'.");
+    auto It = Modules.find(Path);
+    if (It != Modules.end())
+    {
+        if (It->second.Running)
+            eval_err("[eval_import] Error: '" + Spec + "' is imported while it runs (import cycle).");
+        return It->second;
+    }
+
+    std::string Err;
+    auto Source = Module::cache().load(Path, [this](const std::vector<std::shared_ptr<ExprAST>>& Body) { prepare_module(Body); }, Err);
+    if (!Source)
+        eval_err("[eval_import] Error: " + Err + ".");
+
+    auto& M = Modules[Path];
+    M.Source = Source;
+    M.Scope = std::make_shared<EnvImpl>("__module " + Path);
+
+    // Its own imports are taken from its directory
+    auto PrevScope = CurScope;
+    auto PrevDir = ModuleDir;
+    auto PrevLine = EvalLineNumber;
+    CurScope = M.Scope;
+    ModuleDir = Path.substr(0, std::max<size_t>(Path.rfind('/'), 1));
+    for (auto& E : Source->Body)
+    {
+        GC::heap().maybe_collect(); // safe point
+        EvalLineNumber = E->LineNumber;
+        eval_one(E);
+    }
+    CurScope = PrevScope;
+    ModuleDir = PrevDir;
+    EvalLineNumber = PrevLine;
+    M.Running = false;
+    return M;
+}
+
+// import binds the values the module exports in the importing scope
+std::shared_ptr<ExprAST> EvalImpl::eval_import_expr(std::shared_ptr<ImportExprAST> Import)
+{
+#ifdef elog
+    log("in eval_import_expr");
+#endif
+    if (!is_top_scope())
+        eval_err("[eval_import] SyntaxError: import is only allowed at the top level.");
+    auto& M = load_module(Import->Path);
+
+    auto exported = [&](const std::string& Name, const std::string& Local) {
+        auto V = M.Scope->get(Local);
+        if (V && isCell(V))
+            V = ptr_to<CellExprAST>(V)->Val;
+        if (!V)
+            eval_err("[eval_import] ReferenceError: '" + Name + "' exported by '" + Import->Path + "' is not defined.");
+        return V;
+    };
+    for (auto& N : Import->Names)
+    {
+        auto X = std::find_if(M.Source->Exports.begin(), M.Source->Exports.end(), [&](const std::pair<std::string, std::string>& E) { return E.first == N.first; });
+        if (X == M.Source->Exports.end())
+            eval_err("[eval_import] SyntaxError: '" + Import->Path + "' does not export '" + N.first + "'.");
+        CurScope->set(N.second, exported(X->first, X->second));
+    }
+    if (!Import->Namespace.empty())
+    {
+        auto Namespace = GC::make_traced<ObjectValueExprAST>();
+        for (auto& X : M.Source->Exports)
+            Namespace->set(X.first, exported(X.first, X.second));
+        CurScope->set(Import->Namespace, Namespace);
+    }
+    return Import;
+}
+
+// export only marks names for the importers, the declaration runs as usual
+std::shared_ptr<ExprAST> EvalImpl::eval_export_expr(std::shared_ptr<ExportExprAST> Export)
+{
+#ifdef elog
+    log("in eval_export_expr");
+#endif
+    if (!is_top_scope())
+        eval_err("[eval_export] SyntaxError: export is only allowed at the top level.");
+    return Export->Declaration ? eval_one(Export->Declaration) : Export;
+}
+/* ++ Import ++ */
@@ -0,0 +1,69 @@
+#ifndef TINYJS_MODULE
+#define TINYJS_MODULE
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ast.h"
+
+// Modules (import / export).
+//
+// A module is a file run once per evaluator, in a top scope of its own:
+// its functions see its globals, not the importer's. An import binds the
+// exported values it names as they are once the module has run.
+//
+// "./x.js" and "../x.js" are taken from the directory of the importing
+// file, the script's is the working directory. Other names are looked up
+// in that directory, then in every directory of TINYJS_PATH (':'
+// separated). ".js" may be left out.
+//
+// The parsed statements are kept for the whole process and shared by every
+// evaluator, one parse per file, made again only when the content hash
+// changes. A new parse is prepared before anyone runs it: calls bound to
+// built ins, free names of the functions, shapes of the loops. Those are
+// the caches an evaluator fills on first use, once prepared the statements
+// are only read and evaluators on other threads may share them.
+
+namespace Module
+{
+    using AST::Expr;
+
+    struct SourceImpl
+    {
+        std::string Path; // canonical
+        uint64_t Hash;    // of the content
+        std::vector<Expr> Body;
+        std::vector<std::pair<std::string, std::string>> Exports; // exported name, local name
+    };
+
+    class CacheImpl
+    {
+    private:
+        std::mutex Lock;
+        std::unordered_map<std::string, std::shared_ptr<const SourceImpl>> Sources; // by path
+        unsigned long long Hits = 0, Parses = 0;
+
+    public:
+        using Preparer = std::function<void(const std::vector<Expr>& Body)>;
+
+        // Canonical path of the module Spec imported from a file in Dir,
+        // empty if there is no such file.
+        static std::string resolve(const std::string& Spec, const std::string& Dir);
+
+        // The module at Path (canonical) as it is on disk now, Prepare runs
+        // once on a new parse. nullptr and Err set when it can not be read.
+        std::shared_ptr<const SourceImpl> load(const std::string& Path, const Preparer& Prepare, std::string& Err);
+
+        std::string stats_string();
+    };
+
+    // The process wide cache
+    CacheImpl& cache();
+}
+
+#endif
@@ -0,0 +1,732 @@
+#include "numeric.h"
+#include "ir.h"
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+using namespace Numeric;
+using namespace AST;
+
+namespace
+{
+    const uint32_t None = UINT32_MAX;
+    const int MaxDepth = 256; // of nested expressions, running one recurses as deep
+    const int MaxRounds = 8;  // to settle the kinds at the head of a loop
+
+    Kind join(Kind A, Kind B)
+    {
+        if (A == Kind::none) return B;
+        if (B == Kind::none) return A;
+        return A == B ? A : Kind::mixed;
+    }
+
+    // Kinds of the slots at a point of the body, Live if it can be reached
+    struct State
+    {
+        std::vector<Kind> Slots;
+        bool Live = true;
+        bool operator ==(const State& O) const { return Live == O.Live && Slots == O.Slots; }
+    };
+
+    void join_into(State& To, const State& From)
+    {
+        if (!From.Live)
+            return;
+        if (!To.Live)
+        {
+            To = From;
+            return;
+        }
+        if (To.Slots.size() < From.Slots.size())
+            To.Slots.resize(From.Slots.size(), Kind::none);
+        for (size_t i = 0; i < From.Slots.size(); i++)
+            To.Slots[i] = join(To.Slots[i], From.Slots[i]);
+    }
+
+    State dead()
+    {
+        State S;
+        S.Live = false;
+        return S;
+    }
+
+    struct Typed
+    {
+        uint32_t Node;
+        Kind K;
+    };
+
+    // The nodes a kernel body may have, whatever the kinds
+    bool numeric_shape(const FunctionAST& F)
+    {
+        bool Ok = true;
+        for_each_node(F.Body, [&](const Expr& E) {
+            switch (E->SubType)
+            {
+                case Type::integer_expr: case Type::float_expr: case Type::variable_expr:
+                case Type::unary_op_expr: case Type::binary_op_expr: case Type::block_expr:
+                case Type::if_else_expr: case Type::for_expr: case Type::while_expr: case Type::do_while_expr:
+                case Type::return_expr: case Type::break_expr: case Type::continue_expr:
+                    break;
+                default:
+                    Ok = false;
+            }
+            return Ok;
+        });
+        return Ok;
+    }
+
+    // Infers the kinds and emits the nodes in one walk of the body. A loop
+    // body is walked until the kinds at its head settle, the nodes of those
+    // rounds are dropped, then once more for good.
+    class CompilerImpl
+    {
+    public:
+        KernelImpl& K;
+        bool Failed = false;
+
+        explicit CompilerImpl(KernelImpl& K) : K(K) { }
+
+        void compile(const FunctionAST& F)
+        {
+            // Parameters, a name given twice is the last one
+            Scopes.emplace_back();
+            State S;
+            auto& Params = F.Proto->Args;
+            for (size_t i = 0; i < Params.size(); i++)
+            {
+                auto& P = Params[i];
+                auto V = isBinaryOp(P) ? std::static_pointer_cast<BinaryOpExprAST>(P)->LHS : P;
+                if (!isVariable(V))
+                    return fail();
+                Scopes.back().Names[std::static_pointer_cast<VariableExprAST>(V)->Name] = i;
+                S.Slots.push_back(K.Params[i]);
+            }
+            K.Slots = Params.size();
+
+            K.Body = block(F.Body, S);
+            // Falling off the end returns the last statement's value
+            if (S.Live || K.Result == Kind::none)
+                fail();
+        }
+
+    private:
+        struct Scope
+        {
+            std::unordered_map<std::string, uint32_t> Names;
+            std::unordered_set<std::string> Missed; // looked up here, found further out
+        };
+        struct Loop
+        {
+            State Breaks = dead(), Continues = dead();
+        };
+        std::vector<Scope> Scopes;
+        std::vector<Loop> Loops;
+        std::unordered_map<const ExprAST*, uint32_t> Declared; // slot of a `let`, the same every round
+        int Depth = 0;
+
+        void fail() { Failed = true; }
+
+        uint32_t emit(Op Code, uint32_t A = 0, uint32_t B = 0, uint32_t C = 0, uint32_t D = 0)
+        {
+            Node N;
+            N.Code = Code;
+            N.A = A; N.B = B; N.C = C; N.D = D;
+            K.Nodes.push_back(N);
+            return K.Nodes.size() - 1;
+        }
+
+        Typed constant(long long I)
+        {
+            auto N = emit(Op::constant);
+            K.Nodes[N].Imm.I = I;
+            return { N, Kind::integer };
+        }
+
+        Typed constant(double D)
+        {
+            auto N = emit(Op::constant);
+            K.Nodes[N].Imm.D = D;
+            return { N, Kind::real };
+        }
+
+        Typed to_real(Typed T)
+        {
+            if (T.K == Kind::real)
+                return T;
+            auto& N = K.Nodes[T.Node];
+            if (N.Code == Op::constant)
+            {
+                N.Imm.D = (double)N.Imm.I;
+                return { T.Node, Kind::real };
+            }
+            return { emit(Op::to_real, T.Node), Kind::real };
+        }
+
+        Typed to_integer(Typed T)
+        {
+            if (T.K == Kind::integer)
+                return T;
+            return { emit(Op::to_integer, T.Node), Kind::integer };
+        }
+
+        // An integer, zero for false
+        uint32_t condition(const Expr& E, State& S)
+        {
+            auto T = expression(E, S);
+            return T.K == Kind::real ? emit(Op::truth_d, T.Node) : T.Node;
+        }
+
+        uint32_t lookup(const std::string& Name)
+        {
+            for (auto It = Scopes.rbegin(); It != Scopes.rend(); It++)
+            {
+                auto Found = It->Names.find(Name);
+                if (Found != It->Names.end())
+                    return Found->second;
+                It->Missed.insert(Name);
+            }
+            fail(); // a global or a free name
+            return 0;
+        }
+
+        // A name used in this scope before its `let` may mean the outer one
+        // or, the next time round, this one
+        uint32_t declare(const ExprAST* Decl, const std::string& Name, State& S)
+        {
+            auto& Sc = Scopes.back();
+            auto Found = Sc.Names.find(Name);
+            if (Found != Sc.Names.end())
+                return Found->second;
+            if (Sc.Missed.count(Name))
+            {
+                fail();
+                return 0;
+            }
+            auto It = Declared.find(Decl);
+            uint32_t Slot = It != Declared.end() ? It->second : (Declared[Decl] = K.Slots++);
+            if (S.Slots.size() <= Slot)
+                S.Slots.resize(Slot + 1, Kind::none);
+            Sc.Names[Name] = Slot;
+            return Slot;
+        }
+
+        Typed expression(const Expr& E, State& S)
+        {
+            if (Failed || ++Depth > MaxDepth)
+            {
+                fail();
+                return { 0, Kind::integer };
+            }
+            auto T = expression_(E, S);
+            Depth--;
+            return T;
+        }
+
+        Typed expression_(const Expr& E, State& S)
+        {
+            switch (E->SubType)
+            {
+                case Type::integer_expr:
+                    return constant(std::static_pointer_cast<IntegerValueExprAST>(E)->Val);
+                case Type::float_expr:
+                    return constant(std::static_pointer_cast<FloatValueExprAST>(E)->Val);
+                case Type::variable_expr:
+                {
+                    auto V = std::static_pointer_cast<VariableExprAST>(E);
+                    if (!V->DefineType.empty())
+                        break;
+                    auto Slot = lookup(V->Name);
+                    if (Failed || Slot >= S.Slots.size() || (S.Slots[Slot] != Kind::integer && S.Slots[Slot] != Kind::real))
+                        break;
+                    return { emit(Op::load, Slot), S.Slots[Slot] };
+                }
+                case Type::unary_op_expr:
+                {
+                    auto U = std::static_pointer_cast<UnaryOpExprAST>(E);
+                    auto T = expression(U->Expression, S);
+                    // -x is x * -1, +x is x * 1
+                    if (U->Op == "-")
+                        return T.K == Kind::integer ? Typed{ emit(Op::mul_i, T.Node, constant(-1LL).Node), Kind::integer }
+                                                    : Typed{ emit(Op::mul_d, T.Node, constant(-1.0).Node), Kind::real };
+                    if (U->Op == "+")
+                        return T;
+                    if (U->Op == "~")
+                        return { emit(Op::bit_not, to_integer(T).Node), Kind::integer };
+                    if (U->Op == "!")
+                        return { emit(T.K == Kind::integer ? Op::not_i : Op::not_d, T.Node), Kind::integer };
+                    break;
+                }
+                case Type::binary_op_expr:
+                    return binary(std::static_pointer_cast<BinaryOpExprAST>(E), S);
+                default:
+                    break;
+            }
+            fail();
+            return { 0, Kind::integer };
+        }
+
+        // Mixed operands are taken as doubles, as _add and the others do
+        Typed binary(const std::shared_ptr<BinaryOpExprAST>& B, State& S)
+        {
+            auto& O = B->Op;
+            if (O == "=" || O == ",") // an assignment is a statement
+            {
+                fail();
+                return { 0, Kind::integer };
+            }
+            auto L = expression(B->LHS, S);
+            auto R = expression(B->RHS, S);
+            bool Int = L.K == Kind::integer && R.K == Kind::integer;
+            auto arith = [&](Op I, Op D) -> Typed {
+                if (Int)
+                    return { emit(I, L.Node, R.Node), Kind::integer };
+                return { emit(D, to_real(L).Node, to_real(R).Node), Kind::real };
+            };
+            auto compare = [&](Op I, Op D) -> Typed {
+                if (Int)
+                    return { emit(I, L.Node, R.Node), Kind::integer };
+                return { emit(D, to_real(L).Node, to_real(R).Node), Kind::integer };
+            };
+            auto bits = [&](Op Code) -> Typed {
+                return { emit(Code, to_integer(L).Node, to_integer(R).Node), Kind::integer };
+            };
+            // Both sides run, the value is one of them: it needs one kind
+            auto logic = [&](Op I, Op D) -> Typed {
+                if (L.K != R.K)
+                {
+                    fail();
+                    return L;
+                }
+                return { emit(L.K == Kind::integer ? I : D, L.Node, R.Node), L.K };
+            };
+
+            if (O == "+")  return arith(Op::add_i, Op::add_d);
+            if (O == "-")  return arith(Op::sub_i, Op::sub_d);
+            if (O == "*")  return arith(Op::mul_i, Op::mul_d);
+            if (O == "/")  return arith(Op::div_i, Op::div_d);
+            if (O == "%")  return arith(Op::mod_i, Op::mod_d);
+            if (O == "<")  return compare(Op::lt_i, Op::lt_d);
+            if (O == "<=") return compare(Op::le_i, Op::le_d);
+            if (O == ">")  return compare(Op::gt_i, Op::gt_d);
+            if (O == ">=") return compare(Op::ge_i, Op::ge_d);
+            if (O == "==") return compare(Op::eq_i, Op::eq_d);
+            if (O == "<<") return bits(Op::shl);
+            if (O == ">>") return bits(Op::shr);
+            if (O == "&")  return bits(Op::bit_and);
+            if (O == "|")  return bits(Op::bit_or);
+            if (O == "^")  return bits(Op::bit_xor);
+            if (O == "&&") return logic(Op::and_i, Op::and_d);
+            if (O == "||") return logic(Op::or_i, Op::or_d);
+            fail();
+            return L;
+        }
+
+        // Statements run in order until one leaves the block
+        uint32_t block(const std::shared_ptr<BlockExprAST>& Block, State& S)
+        {
+            std::vector<uint32_t> Statements;
+            for (auto& E : Block->Statement)
+            {
+                if (Failed || !S.Live)
+                    break;
+                Statements.push_back(statement(E, S));
+            }
+            auto Begin = K.Lists.size();
+            K.Lists.insert(K.Lists.end(), Statements.begin(), Statements.end());
+            return emit(Op::seq, Begin, Statements.size());
+        }
+
+        uint32_t statement(const Expr& E, State& S)
+        {
+            switch (E->SubType)
+            {
+                case Type::binary_op_expr:
+                {
+                    auto B = std::static_pointer_cast<BinaryOpExprAST>(E);
+                    if (B->Op != "=")
+                        break;
+                    if (!isVariable(B->LHS))
+                        return fail(), 0;
+                    auto V = std::static_pointer_cast<VariableExprAST>(B->LHS);
+                    if (V->DefineType == "var")
+                        return fail(), 0;
+                    // The value is made before the name is declared
+                    auto T = expression(B->RHS, S);
+                    auto Slot = V->DefineType == "let" ? declare(V.get(), V->Name, S) : lookup(V->Name);
+                    if (Failed)
+                        return 0;
+                    if (S.Slots.size() <= Slot)
+                        S.Slots.resize(Slot + 1, Kind::none);
+                    S.Slots[Slot] = T.K;
+                    return emit(Op::store, Slot, T.Node);
+                }
+                case Type::if_else_expr:
+                    return if_else(std::static_pointer_cast<IfExprAST>(E), S);
+                case Type::for_expr:
+                    return for_loop(std::static_pointer_cast<ForExprAST>(E), S);
+                case Type::while_expr:
+                {
+                    auto W = std::static_pointer_cast<WhileExprAST>(E);
+                    return loop(S, Op::while_loop, None, [&](State& In, uint32_t& Cond, uint32_t& Body, uint32_t&) {
+                        Cond = condition(W->Cond, In);
+                        Body = W->Block ? block(W->Block, In) : None;
+                    });
+                }
+                case Type::do_while_expr:
+                {
+                    auto W = std::static_pointer_cast<DoWhileExprAST>(E);
+                    if (!W->Block)
+                        return fail(), 0;
+                    return loop(S, Op::do_while_loop, None, [&](State& In, uint32_t& Cond, uint32_t& Body, uint32_t&) {
+                        Body = block(W->Block, In);
+                        // continue goes on to the condition
+                        join_into(In, Loops.back().Continues);
+                        Loops.back().Continues = dead();
+                        Cond = In.Live ? condition(W->Cond, In) : None;
+                    });
+                }
+                case Type::return_expr:
+                {
+                    auto R = std::static_pointer_cast<ReturnExprAST>(E);
+                    if (!R->RetValue)
+                        return fail(), 0;
+                    auto T = expression(R->RetValue, S);
+                    K.Result = join(K.Result, T.K);
+                    if (K.Result == Kind::mixed)
+                        fail();
+                    S.Live = false;
+                    return emit(Op::ret, T.Node);
+                }
+                case Type::break_expr: case Type::continue_expr:
+                {
+                    if (Loops.empty())
+                        return fail(), 0;
+                    bool Break = E->SubType == Type::break_expr;
+                    join_into(Break ? Loops.back().Breaks : Loops.back().Continues, S);
+                    S.Live = false;
+                    return emit(Break ? Op::brk : Op::cont);
+                }
+                case Type::variable_expr: case Type::function_expr:
+                    return fail(), 0;
+                default:
+                    break;
+            }
+            return emit(Op::eval, expression(E, S).Node);
+        }
+
+        uint32_t if_else(const std::shared_ptr<IfExprAST>& If, State& S)
+        {
+            if (!If->IfBlock)
+                return fail(), 0;
+            // The branches run in a scope of their own, one or the other
+            Scopes.emplace_back();
+            auto Cond = condition(If->Cond, S);
+            Scopes.pop_back();
+
+            State Then = S, Else = S;
+            Scopes.emplace_back();
+            auto A = block(If->IfBlock, Then);
+            Scopes.pop_back();
+            uint32_t B = None;
+            if (If->ElseIf)
+            {
+                Scopes.emplace_back();
+                B = if_else(std::static_pointer_cast<IfExprAST>(If->ElseIf), Else);
+                Scopes.pop_back();
+            }
+            else if (If->ElseBlock)
+            {
+                Scopes.emplace_back();
+                B = block(If->ElseBlock, Else);
+                Scopes.pop_back();
+            }
+            S = dead();
+            join_into(S, Then);
+            join_into(S, Else);
+            return emit(Op::if_else, Cond, A, B);
+        }
+
+        uint32_t for_loop(const std::shared_ptr<ForExprAST>& For, State& S)
+        {
+            for (auto& C : For->Cond)
+                if (!C)
+                    return fail(), 0;
+            // The counter lives in the scope of the loop
+            Scopes.emplace_back();
+            auto Init = statement(For->Cond[0], S);
+            uint32_t N;
+            if (!For->Block || For->Block->Statement.empty()) // only the init runs
+            {
+                N = emit(Op::seq, K.Lists.size(), 1);
+                K.Lists.push_back(Init);
+            }
+            else
+                N = loop(S, Op::for_loop, Init, [&](State& In, uint32_t& Cond, uint32_t& Body, uint32_t& Step) {
+                    Cond = condition(For->Cond[1], In);
+                    Body = block(For->Block, In);
+                    // continue still runs the step
+                    join_into(In, Loops.back().Continues);
+                    Loops.back().Continues = dead();
+                    Step = In.Live ? statement(For->Cond[2], In) : None;
+                }, false);
+            Scopes.pop_back();
+            return N;
+        }
+
+        // Round: walks the loop from its head state, fills the operands and
+        // leaves the state at the end of a turn. The head is the entry joined
+        // with the end of every turn; the exit is the head (the condition is
+        // false) joined with the breaks.
+        template <typename Fn>
+        uint32_t loop(State& S, Op Code, uint32_t Init, Fn&& Round, bool OwnScope = true)
+        {
+            if (OwnScope)
+                Scopes.emplace_back();
+            State Head = S;
+            uint32_t Cond = None, Body = None, Step = None;
+            for (int i = 0; ; i++)
+            {
+                if (Failed || i == MaxRounds)
+                    return fail(), 0;
+                auto Nodes = K.Nodes.size(), Lists = K.Lists.size();
+                auto Names = Scopes.back();
+                Loops.emplace_back();
+                State In = Head;
+                Round(In, Cond, Body, Step);
+                State Next = S;
+                join_into(Next, In);
+                Loops.pop_back();
+                Scopes.back() = Names;
+                K.Nodes.resize(Nodes);
+                K.Lists.resize(Lists);
+                if (Next == Head)
+                    break;
+                Head = Next;
+            }
+
+            // For good
+            Loops.emplace_back();
+            State In = Head;
+            Round(In, Cond, Body, Step);
+            State Exit = Head;
+            if (Code == Op::do_while_loop) // the condition runs after the body
+                Exit = In;
+            join_into(Exit, Loops.back().Breaks);
+            Loops.pop_back();
+            if (OwnScope)
+                Scopes.pop_back();
+            S = Exit;
+            return emit(Code, Init, Cond, Body, Step);
+        }
+    };
+
+    // Runs the nodes of one kernel on one frame
+    struct RunnerImpl
+    {
+        enum class Flow { normal, brk, cont, ret };
+
+        const KernelImpl& K;
+        Value* Frame;
+        Value Ret = { 0 };
+
+        Value eval(uint32_t i)
+        {
+            const Node& N = K.Nodes[i];
+            Value V;
+            switch (N.Code)
+            {
+                case Op::constant:   return N.Imm;
+                case Op::load:       return Frame[N.A];
+                case Op::to_real:    V.D = (double)eval(N.A).I; return V;
+                case Op::to_integer: V.I = (long long)eval(N.A).D; return V;
+
+                case Op::add_i: V.I = eval(N.A).I + eval(N.B).I; return V;
+                case Op::sub_i: V.I = eval(N.A).I - eval(N.B).I; return V;
+                case Op::mul_i: V.I = eval(N.A).I * eval(N.B).I; return V;
+                case Op::div_i: { auto L = eval(N.A).I; V.I = divide(L, eval(N.B).I); return V; }
+                case Op::mod_i: { auto L = eval(N.A).I; V.I = modulo(L, eval(N.B).I); return V; }
+                case Op::add_d: V.D = eval(N.A).D + eval(N.B).D; return V;
+                case Op::sub_d: V.D = eval(N.A).D - eval(N.B).D; return V;
+                case Op::mul_d: V.D = eval(N.A).D * eval(N.B).D; return V;
+                case Op::div_d: V.D = eval(N.A).D / eval(N.B).D; return V;
+                case Op::mod_d: { auto L = eval(N.A).D; V.D = fmod(L, eval(N.B).D); return V; }
+
+                case Op::lt_i: V.I = eval(N.A).I <  eval(N.B).I; return V;
+                case Op::le_i: V.I = eval(N.A).I <= eval(N.B).I; return V;
+                case Op::gt_i: V.I = eval(N.A).I >  eval(N.B).I; return V;
+                case Op::ge_i: V.I = eval(N.A).I >= eval(N.B).I; return V;
+                case Op::eq_i: V.I = eval(N.A).I == eval(N.B).I; return V;
+                case Op::lt_d: V.I = eval(N.A).D <  eval(N.B).D; return V;
+                case Op::le_d: V.I = eval(N.A).D <= eval(N.B).D; return V;
+                case Op::gt_d: V.I = eval(N.A).D >  eval(N.B).D; return V;
+                case Op::ge_d: V.I = eval(N.A).D >= eval(N.B).D; return V;
+                case Op::eq_d: V.I = eval(N.A).D == eval(N.B).D; return V;
+
+                case Op::shl:     { auto L = eval(N.A).I; V.I = L << eval(N.B).I; return V; }
+                case Op::shr:     { auto L = eval(N.A).I; V.I = L >> eval(N.B).I; return V; }
+                case Op::bit_and: V.I = eval(N.A).I & eval(N.B).I; return V;
+                case Op::bit_or:  V.I = eval(N.A).I | eval(N.B).I; return V;
+                case Op::bit_xor: V.I = eval(N.A).I ^ eval(N.B).I; return V;
+                case Op::bit_not: V.I = ~eval(N.A).I; return V;
+
+                case Op::not_i:   V.I = !eval(N.A).I; return V;
+                case Op::not_d:   V.I = !eval(N.A).D; return V;
+                case Op::truth_d: V.I = eval(N.A).D ? 1 : 0; return V;
+                // && and || evaluate both sides
+                case Op::and_i: { auto L = eval(N.A), R = eval(N.B); return L.I ? R : L; }
+                case Op::and_d: { auto L = eval(N.A), R = eval(N.B); return L.D ? R : L; }
+                case Op::or_i:  { auto L = eval(N.A), R = eval(N.B); return L.I ? L : R; }
+                case Op::or_d:  { auto L = eval(N.A), R = eval(N.B); return L.D ? L : R; }
+                default:
+                    return N.Imm;
+            }
+        }
+
+        Flow exec(uint32_t i)
+        {
+            if (i == None)
+                return Flow::normal;
+            const Node& N = K.Nodes[i];
+            switch (N.Code)
+            {
+                case Op::seq:
+                    for (uint32_t j = 0; j < N.B; j++)
+                    {
+                        auto F = exec(K.Lists[N.A + j]);
+                        if (F != Flow::normal)
+                            return F;
+                    }
+                    return Flow::normal;
+                case Op::store:
+                    Frame[N.A] = eval(N.B);
+                    return Flow::normal;
+                case Op::eval:
+                    eval(N.A);
+                    return Flow::normal;
+                case Op::if_else:
+                    return eval(N.A).I ? exec(N.B) : exec(N.C);
+                case Op::while_loop:
+                    while (eval(N.B).I)
+                    {
+                        auto F = exec(N.C);
+                        if (F == Flow::brk)
+                            break;
+                        if (F == Flow::ret)
+                            return F;
+                    }
+                    return Flow::normal;
+                case Op::do_while_loop:
+                    do {
+                        auto F = exec(N.C);
+                        if (F == Flow::brk)
+                            break;
+                        if (F == Flow::ret)
+                            return F;
+                    } while (N.B != None && eval(N.B).I);
+                    return Flow::normal;
+                case Op::for_loop:
+                    exec(N.A);
+                    while (eval(N.B).I)
+                    {
+                        auto F = exec(N.C);
+                        if (F == Flow::brk)
+                            break;
+                        if (F == Flow::ret)
+                            return F;
+                        exec(N.D);
+                    }
+                    return Flow::normal;
+                case Op::ret:
+                    Ret = eval(N.A);
+                    return Flow::ret;
+                case Op::brk:
+                    return Flow::brk;
+                case Op::cont:
+                    return Flow::cont;
+                default:
+                    eval(i);
+                    return Flow::normal;
+            }
+        }
+    };
+}
+
+Expr KernelImpl::call(const std::vector<Expr>& Args) const
+{
+    // The frame is on the stack unless the kernel has many locals
+    Value Small[32];
+    std::unique_ptr<Value[]> Large;
+    Value* Frame = Small;
+    if (Slots > 32)
+    {
+        Large.reset(new Value[Slots]);
+        Frame = Large.get();
+    }
+    for (size_t i = 0; i < Params.size(); i++)
+    {
+        if (Params[i] == Kind::integer)
+            Frame[i].I = std::static_pointer_cast<IntegerValueExprAST>(Args[i])->Val;
+        else
+            Frame[i].D = std::static_pointer_cast<FloatValueExprAST>(Args[i])->Val;
+    }
+
+    Value Ret;
+    try
+    {
+        if (Program)
+            Ret = Program->run(Frame, Params.size());
+        else
+        {
+            RunnerImpl R{ *this, Frame };
+            R.exec(Body);
+            Ret = R.Ret;
+        }
+    }
+    catch (const DivideByZero&)
+    {
+        return nullptr;
+    }
+    if (Result == Kind::integer)
+        return GC::make_value<IntegerValueExprAST>(Ret.I);
+    return GC::make_value<FloatValueExprAST>(Ret.D);
+}
+
+const KernelImpl* Numeric::kernel_for(FunctionAST& F, const std::vector<Expr>& Args, bool Compile)
+{
+    using State = FunctionAST::KernelState;
+    if (F.Kernel == State::never || Args.size() != F.Proto->Args.size() || Args.size() > 32)
+        return nullptr;
+
+    // One bit per argument above a leading one: 1 for a float
+    uint64_t Key = 1;
+    for (auto& A : Args)
+    {
+        if (!A || (!isInt(A) && !isFloat(A)))
+            return nullptr;
+        Key = Key << 1 | isFloat(A);
+    }
+    auto It = F.Kernels.find(Key);
+    if (It != F.Kernels.end())
+        return It->second.get();
+    if (!Compile)
+        return nullptr;
+
+    if (F.Kernel == State::unknown)
+    {
+        F.Kernel = numeric_shape(F) ? State::possible : State::never;
+        if (F.Kernel == State::never)
+            return nullptr;
+    }
+    auto K = std::make_shared<KernelImpl>();
+    for (auto& A : Args)
+        K->Params.push_back(isFloat(A) ? Kind::real : Kind::integer);
+    CompilerImpl C(*K);
+    C.compile(F);
+    if (C.Failed)
+        K = nullptr;
+    else
+        K->Program = IR::compile(*K, F.Proto->Name);
+    F.Kernels[Key] = K;
+    return K.get();
+}
@@ -0,0 +1,100 @@
+#ifndef TINYJS_NUMERIC
+#define TINYJS_NUMERIC
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "ast.h"
+
+// Numeric kernels: functions run on raw machine numbers.
+//
+// A function whose body only computes with numbers, in its parameters and
+// `let` locals, is compiled on its first call for the kinds of its
+// arguments (every one an integer or a float). Types are inferred along the
+// control flow: a local may change kind from one statement to the next,
+// where paths meet (after an if, at the head of a loop) it must have one
+// kind on all of them. Every local then gets a slot of a frame on the C++
+// stack holding a long long or a double, the operations are chosen for the
+// kinds once. A call allocates nothing but its result.
+//
+// Anything else in the body makes it a regular function: calls, names of
+// other scopes, strings, arrays, a path that ends without a return, a
+// return of another kind. TINYJS_NO_KERNELS turns kernels off.
+//
+// The nodes are then optimized in SSA form (ir.h) and run as linear code.
+
+namespace IR { class ProgramImpl; }
+
+namespace Numeric
+{
+    enum class Kind : uint8_t { none, integer, real, mixed };
+
+    union Value
+    {
+        long long I;
+        double D;
+    };
+
+    enum class Op : uint8_t
+    {
+        /* Expressions */
+        constant, load, to_real, to_integer,
+        add_i, sub_i, mul_i, div_i, mod_i, add_d, sub_d, mul_d, div_d, mod_d,
+        lt_i, le_i, gt_i, ge_i, eq_i, lt_d, le_d, gt_d, ge_d, eq_d,
+        shl, shr, bit_and, bit_or, bit_xor, bit_not,
+        not_i, not_d, and_i, and_d, or_i, or_d, truth_d,
+        /* Statements */
+        seq, store, eval, if_else, while_loop, do_while_loop, for_loop, ret, brk, cont,
+        /* Linear code of the SSA form (ir.h) */
+        phi, copy, jump, jump_unless,
+    };
+
+    // An integer divided by zero is a float (as 1/1.0), which a kernel does
+    // not hold: the call leaves the kernel and runs as a regular function.
+    // The body only changed its own frame, running it again is safe.
+    struct DivideByZero {};
+
+    // Integer / and %, the quotient of LLONG_MIN by -1 wraps around
+    inline long long divide(long long L, long long R)
+    {
+        if (R == 0)
+            throw DivideByZero();
+        return R == -1 ? (long long)(0ULL - (unsigned long long)L) : L / R;
+    }
+    inline long long modulo(long long L, long long R)
+    {
+        if (R == 0)
+            throw DivideByZero();
+        return R == -1 ? 0 : L % R;
+    }
+
+    // Operands are nodes, a slot or a range of Lists, as the operation needs
+    struct Node
+    {
+        Op Code;
+        uint32_t A = 0, B = 0, C = 0, D = 0;
+        Value Imm = { 0 };
+    };
+
+    class KernelImpl
+    {
+    public:
+        std::vector<Node> Nodes;
+        std::vector<uint32_t> Lists; // statements of the seq nodes
+        std::vector<Kind> Params;
+        uint32_t Slots = 0;
+        uint32_t Body = 0;
+        Kind Result = Kind::none;
+        std::shared_ptr<const IR::ProgramImpl> Program; // runs in place of the nodes
+
+        // Args are of the kinds it was compiled for. nullptr if the call
+        // divided an integer by zero, it is to run as a regular function.
+        AST::Expr call(const std::vector<AST::Expr>& Args) const;
+    };
+
+    // The kernel of F for the kinds of Args, kept in F. nullptr if F can not
+    // run as one, or it is not compiled yet and Compile is false.
+    const KernelImpl* kernel_for(AST::FunctionAST& F, const std::vector<AST::Expr>& Args, bool Compile);
+}
+
+#endif
@@ -0,0 +1,179 @@
+#include "output.h"
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <unistd.h>
+using namespace Output;
+
+namespace
+{
+    // A crash keeps what was printed before it: the buffer goes out, then
+    // the signal is raised again with its default action. The handler runs
+    // on a stack of its own, a stack overflow leaves none.
+    void on_crash(int Sig)
+    {
+        out().flush();
+        signal(Sig, SIG_DFL);
+        raise(Sig);
+    }
+
+    void flush_on_crash()
+    {
+        static char AltStack[64 << 10];
+        stack_t St = {};
+        St.ss_sp = AltStack;
+        St.ss_size = sizeof(AltStack);
+        sigaltstack(&St, nullptr);
+
+        struct sigaction Act = {};
+        Act.sa_handler = on_crash;
+        Act.sa_flags = SA_ONSTACK | SA_RESETHAND;
+        sigemptyset(&Act.sa_mask);
+        for (int Sig : { SIGFPE, SIGSEGV, SIGBUS, SIGABRT, SIGILL })
+            sigaction(Sig, &Act, nullptr);
+    }
+}
+
+WriterImpl& Output::out()
+{
+    static WriterImpl Out(STDOUT_FILENO);
+    static bool Guarded = (flush_on_crash(), true);
+    (void)Guarded;
+    return Out;
+}
+
+WriterImpl::WriterImpl(int Fd, size_t Capacity) : Buf(new char[Capacity]), Capacity(Capacity)
+{ redirect(Fd); }
+
+WriterImpl::WriterImpl(std::string& Sink, size_t Capacity) : Buf(new char[Capacity]), Capacity(Capacity)
+{ redirect(Sink); }
+
+void WriterImpl::redirect(int Fd)
+{
+    flush();
+    this->Fd = Fd;
+    Sink = nullptr;
+    LineBuffered = isatty(Fd);
+}
+
+void WriterImpl::redirect(std::string& Sink)
+{
+    flush();
+    Fd = -1;
+    this->Sink = &Sink;
+    LineBuffered = false;
+}
+
+void WriterImpl::flush()
+{
+    if (!Len)
+        return;
+    if (Sink)
+        Sink->append(Buf.get(), Len);
+    else
+    {
+        const char* P = Buf.get();
+        size_t N = Len;
+        while (N)
+        {
+            auto W = ::write(Fd, P, N);
+            if (W < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                break; // nowhere to report it, drop the rest
+            }
+            P += W;
+            N -= W;
+        }
+    }
+    Len = 0;
+}
+
+// Does not fit in the buffer
+void WriterImpl::write_slow(const char* S, size_t N)
+{
+    flush();
+    if (N < Capacity)
+    {
+        memcpy(Buf.get(), S, N);
+        Len = N;
+        return;
+    }
+
+    // Larger than the whole buffer, skip it
+    if (Sink)
+    {
+        Sink->append(S, N);
+        return;
+    }
+    while (N)
+    {
+        auto W = ::write(Fd, S, N);
+        if (W < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+        S += W;
+        N -= W;
+    }
+}
+
+/* -- Number -- */
+namespace
+{
+    const char DigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+}
+
+void WriterImpl::write_int(long long V)
+{
+    char Tmp[24];
+    char* End = Tmp + sizeof(Tmp);
+    char* P = End;
+    // Negate as unsigned, LLONG_MIN has no positive counterpart
+    unsigned long long U = V < 0 ? 0ULL - (unsigned long long)V : V;
+    while (U >= 100)
+    {
+        auto D = (U % 100) * 2;
+        U /= 100;
+        *--P = DigitPairs[D + 1];
+        *--P = DigitPairs[D];
+    }
+    if (U >= 10)
+    {
+        *--P = DigitPairs[U * 2 + 1];
+        *--P = DigitPairs[U * 2];
+    }
+    else
+        *--P = char('0' + U);
+    if (V < 0)
+        *--P = '-';
+    write(P, End - P);
+}
+
+void WriterImpl::write_double(double V)
+{
+    // %g with 6 digits prints an integral value below 1e6 as an integer
+    if (V == std::floor(V) && std::fabs(V) < 1e6 && !(V == 0 && std::signbit(V)))
+    {
+        write_int((long long)V);
+        return;
+    }
+    char Tmp[32];
+    int N = snprintf(Tmp, sizeof(Tmp), "%g", V);
+    write(Tmp, N);
+}
+/* ++ Number ++ */
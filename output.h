@@ -0,0 +1,84 @@
+#ifndef TINYJS_OUTPUT
+#define TINYJS_OUTPUT
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+// Buffered script output.
+// print writes into one large buffer, it goes out when full, on flush(),
+// before an error message, at exit and on a crash (a fatal signal). A
+// terminal gets every line at once.
+// The target is a file descriptor or, for embedding, a std::string.
+
+namespace Output
+{
+    class WriterImpl
+    {
+    private:
+        std::unique_ptr<char[]> Buf;
+        size_t Capacity;
+        size_t Len = 0;
+        int Fd = -1;
+        std::string* Sink = nullptr;
+        bool LineBuffered = false;
+
+        void write_slow(const char* S, size_t N);
+
+    public:
+        static const size_t DefaultCapacity = 64 << 10;
+
+        // Write to a file descriptor
+        explicit WriterImpl(int Fd, size_t Capacity = DefaultCapacity);
+        // Append to Sink
+        explicit WriterImpl(std::string& Sink, size_t Capacity = DefaultCapacity);
+        ~WriterImpl() { flush(); }
+
+        WriterImpl(const WriterImpl&) = delete;
+        const WriterImpl& operator =(const WriterImpl&) = delete;
+
+        // Change the target, what is buffered goes to the old one first.
+        void redirect(int Fd);
+        void redirect(std::string& Sink);
+
+        void flush();
+
+        void write(const char* S, size_t N)
+        {
+            if (N <= Capacity - Len)
+            {
+                memcpy(Buf.get() + Len, S, N);
+                Len += N;
+            }
+            else
+                write_slow(S, N);
+        }
+        void write(const std::string& S) { write(S.data(), S.size()); }
+        void write(const char* S) { write(S, strlen(S)); }
+
+        void put(char C)
+        {
+            if (Len == Capacity)
+                flush();
+            Buf[Len++] = C;
+        }
+
+        // End of a printed line
+        void newline()
+        {
+            put('\n');
+            if (LineBuffered)
+                flush();
+        }
+
+        void write_int(long long V);
+        // Same text as std::ostream << double with the default precision
+        void write_double(double V);
+    };
+
+    // Standard output of the script
+    WriterImpl& out();
+}
+
+#endif
@@ -0,0 +1,148 @@
+#include "eval.h"
+#include "pool.h"
+#include <algorithm>
+using namespace Eval;
+
+// The function must be pure (memo.cpp), it then only reads the globals and
+// its own frame, so every worker can call it with its own evaluator.
+std::shared_ptr<ClosureValueExprAST> EvalImpl::to_parallel_function(std::shared_ptr<ExprAST> V, const std::string& Where)
+{
+    if (!isClosure(V))
+        eval_err("[" + Where + "] TypeError: " + V->get_ast_name() + " is not a function.");
+    auto F = ptr_to<ClosureValueExprAST>(V);
+    if (!is_pure(*F))
+        eval_err("[" + Where + "] TypeError: '" + get_name(F) + "' is not pure, it can not run in parallel.");
+    std::vector<FunctionAST*> Seen;
+    prepare_parallel(F, Seen);
+    return F;
+}
+
+// Fill the caches the evaluator writes on first use (counting loops) for F
+// and every function it calls, workers must only read the AST.
+void EvalImpl::prepare_parallel(std::shared_ptr<ClosureValueExprAST> F, std::vector<FunctionAST*>& Seen)
+{
+    if (std::find(Seen.begin(), Seen.end(), F->Func.get()) != Seen.end())
+        return;
+    Seen.push_back(F->Func.get());
+
+    auto walk = [&](const std::shared_ptr<ExprAST>& E) {
+        if (isFor(E))
+            match_counting_for(ptr_to<ForExprAST>(E));
+        if (isCall(E))
+        {
+            auto C = callee_of(*F, ptr_to<CallExprAST>(E)->Callee);
+            if (C && isClosure(C))
+                prepare_parallel(ptr_to<ClosureValueExprAST>(C), Seen);
+        }
+        return true;
+    };
+    for_each_node(F->Func->Proto, walk);
+    for_each_node(F->Func->Body, walk);
+}
+
+// Split [0, N) in chunks and run Body on the pool, every worker with its own
+// evaluator. No collection runs meanwhile, the workers hold plain references.
+void EvalImpl::run_parallel(size_t N, const std::function<void(EvalImpl& Worker, size_t Begin, size_t End)>& Body)
+{
+    auto& P = Pool::pool();
+    std::vector<std::unique_ptr<EvalImpl>> Workers;
+    for (size_t i = 0; i < P.size(); i++)
+        Workers.emplace_back(new EvalImpl(Scope));
+
+    // Several chunks per worker leave something to steal
+    size_t Chunk = std::max<size_t>(1, N / (P.size() * 8));
+    size_t Tasks = (N + Chunk - 1) / Chunk;
+
+    GC::heap().disable();
+    P.run(Tasks, [&](size_t Task, size_t Worker) {
+        auto& W = *Workers[Worker];
+        W.EvalLineNumber = EvalLineNumber;
+        Body(W, Task * Chunk, std::min(N, (Task + 1) * Chunk));
+    });
+    GC::heap().enable();
+}
+
+// Result of a parallel call, `return;` and no value are errors
+static bool is_result(const std::shared_ptr<ExprAST>& V)
+{
+    if (!V)
+        return false;
+    switch (V->SubType)
+    {
+        case Type::integer_expr: case Type::float_expr: case Type::string_expr:
+        case Type::array_value: case Type::typed_array_value: case Type::object_value:
+        case Type::null_value:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// parallel_for(start, end, fn) => [fn(start), fn(start + 1), ..., fn(end - 1)]
+std::shared_ptr<ExprAST> EvalImpl::builtin_parallel_for(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isInt(Args[0]) || !isInt(Args[1]))
+        eval_err("[parallel_for] TypeError: range bounds must be integers.");
+    auto Start = get_value<IntegerValueExprAST>(Args[0]);
+    auto End = get_value<IntegerValueExprAST>(Args[1]);
+    auto F = to_parallel_function(Args[2], "parallel_for");
+
+    size_t N = End > Start ? End - Start : 0;
+    std::vector<std::shared_ptr<ExprAST>> Results(N);
+    run_parallel(N, [&](EvalImpl& W, size_t Begin, size_t Stop) {
+        for (size_t i = Begin; i < Stop; i++)
+            Results[i] = W.call_function(F, { GC::make_value<IntegerValueExprAST>(Start + i) });
+    });
+
+    auto Arr = GC::make_traced<ArrayValueExprAST>();
+    Arr->reserve(N);
+    for (auto& R : Results)
+    {
+        if (!is_result(R))
+            eval_err("[parallel_for] TypeError: '" + get_name(F) + "' must return a value.");
+        Arr->push(R);
+    }
+    return Arr;
+}
+
+// parallel_reduce(start, end, fn, combine, init)
+//   => combine(init, combine(fn(start), ... combine(..., fn(end - 1))))
+// Every chunk is folded on its own, the chunk results are combined in
+// order. combine must be associative, the grouping depends on the chunks.
+std::shared_ptr<ExprAST> EvalImpl::builtin_parallel_reduce(std::vector<std::shared_ptr<ExprAST>>& Args)
+{
+    if (!isInt(Args[0]) || !isInt(Args[1]))
+        eval_err("[parallel_reduce] TypeError: range bounds must be integers.");
+    auto Start = get_value<IntegerValueExprAST>(Args[0]);
+    auto End = get_value<IntegerValueExprAST>(Args[1]);
+    auto F = to_parallel_function(Args[2], "parallel_reduce");
+    auto Combine = to_parallel_function(Args[3], "parallel_reduce");
+
+    size_t N = End > Start ? End - Start : 0;
+    auto& P = Pool::pool();
+    size_t Chunks = std::min(N, P.size() * 8);
+    std::vector<std::shared_ptr<ExprAST>> Partial(Chunks);
+    run_parallel(Chunks, [&](EvalImpl& W, size_t Begin, size_t Stop) {
+        for (size_t c = Begin; c < Stop; c++)
+        {
+            std::shared_ptr<ExprAST> Acc;
+            for (size_t i = N * c / Chunks; i < N * (c + 1) / Chunks; i++)
+            {
+                auto V = W.call_function(F, { GC::make_value<IntegerValueExprAST>(Start + i) });
+                Acc = Acc ? W.call_function(Combine, { Acc, V }) : V;
+                if (!is_result(Acc))
+                    W.eval_err("[parallel_reduce] TypeError: '" + W.get_name(Acc == V ? F : Combine) + "' must return a value.");
+            }
+            Partial[c] = Acc;
+        }
+    });
+
+    auto Acc = Args[4];
+    for (auto& V : Partial)
+    {
+        Acc = call_function(Combine, { Acc, V });
+        if (!is_result(Acc))
+            eval_err("[parallel_reduce] TypeError: '" + get_name(Combine) + "' must return a value.");
+    }
+    return Acc;
+}
@@ -17,10 +17,18 @@ std::shared_ptr<ExprAST> ParserImpl::parser_experssion()
 }
 
 // primary
-//   ::= identifierexpr
-//   ::= parenexpr
+//   ::= identifierexpr postfix
+//   ::= parenexpr postfix
+//   ::= arrayexpr postfix
+//   ::= stringexpr postfix
+//   ::= functionexpr postfix
+//   ::= asyncexpr postfix
+//   ::= objectexpr postfix
+//   ::= regexexpr postfix
+//   ::= 'null'
 //   ::= numberexpr
 //   ::= unaryexpr
+//   ::= awaitexpr
 std::shared_ptr<ExprAST> ParserImpl::parser_primary()
 {
 #ifdef LOG
@@ -28,9 +36,22 @@ std::shared_ptr<ExprAST> ParserImpl::parser_primary()
 #endif
     switch (CurToken.tk_type)
     {
-        case Lexer::Type::tok_identifier: return parser_identifier();
-        case Lexer::Type::tok_integer: case Lexer::Type::tok_float: case Lexer::Type::tok_string:
+        case Lexer::Type::tok_identifier: return parser_postfix(parser_identifier());
+        case Lexer::Type::tok_integer: case Lexer::Type::tok_float:
             return parser_value();
+        case Lexer::Type::tok_string:
+            return parser_postfix(parser_value());
+        case Lexer::Type::tok_regex:
+            return parser_postfix(parser_regex());
+        case Lexer::Type::tok_function:
+            return parser_postfix(parser_function());
+        case Lexer::Type::tok_async:
+            return parser_postfix(parser_async());
+        case Lexer::Type::tok_await:
+            return parser_await();
+        case Lexer::Type::tok_null:
+            get_next_token(); // eat 'null'
+            return null_value();
 
         case Lexer::Type::tok_op:
         case Lexer::Type::tok_single_char:
@@ -40,7 +61,11 @@ std::shared_ptr<ExprAST> ParserImpl::parser_primary()
                 case '-': case '+': case '!': case '~':
                     return parser_unaryOpExpr();
                 case '(':
-                    return parser_parenExpr();
+                    return parser_postfix(parser_parenExpr());
+                case '[':
+                    return parser_postfix(parser_array());
+                case '{':
+                    return parser_postfix(parser_object());
                 default:
                     break;
             }
@@ -53,53 +78,127 @@ std::shared_ptr<ExprAST> ParserImpl::parser_primary()
 }
 
 // unaryexpr
-//   ::= '+' expression
-//   ::= '-' expression
-//   ::= '!' expression
-//   ::= '~' expression
+//   ::= ('+' | '-' | '!' | '~')+ primary
+// The operators are collected first, a long run of them takes no stack.
 std::shared_ptr<ExprAST> ParserImpl::parser_unaryOpExpr()
 {
 #ifdef LOG
     log("in parser_unaryOpExpr");
 #endif
-    auto Op = CurToken.tk_string;
-    get_next_token(); // eat Op
+    std::vector<std::string> Ops;
+    while ((CurToken.tk_type == Lexer::Type::tok_op || CurToken.tk_type == Lexer::Type::tok_single_char) &&
+           strchr("-+!~", CurToken.tk_string[0]))
+    {
+        Ops.push_back(CurToken.tk_string);
+        get_next_token(); // eat Op
+    }
     auto E = parser_primary();
-    return std::make_shared<UnaryOpExprAST>(Op, E);
+    for (auto Op = Ops.rbegin(); Op != Ops.rend(); Op++)
+        E = std::make_shared<UnaryOpExprAST>(*Op, E);
+    return E;
 }
 
 // binoprhs
-//   ::= ('+' primary)*
+//   ::= (binop primary)*
+// Operator precedence on explicit stacks: an operator first folds the
+// operators before it that bind at least as tight, so equal precedence
+// groups to the left. A chain of any length parses in constant stack.
+// Operators below expr_prec end the expression.
 std::shared_ptr<ExprAST> ParserImpl::parser_binaryOpExpr(int expr_prec, std::shared_ptr<ExprAST> LHS)
 {
 #ifdef LOG
     log("in parser_binaryOpExpr");
 #endif
+    std::vector<std::shared_ptr<ExprAST>> Operands{ LHS };
+    std::vector<std::pair<std::string, int>> Ops;
+    auto reduce = [&]() {
+        auto RHS = std::move(Operands.back());
+        Operands.pop_back();
+        Operands.back() = std::make_shared<BinaryOpExprAST>(Ops.back().first, Operands.back(), RHS);
+        Ops.pop_back();
+    };
 
     while (true)
     {
         int tok_prec = get_tok_prec(CurToken.tk_string);
         if (expr_prec > tok_prec)
-            return LHS;
+            break;
+        while (!Ops.empty() && Ops.back().second >= tok_prec)
+            reduce();
 
-        auto bin_op = CurToken.tk_string;
+        Ops.emplace_back(CurToken.tk_string, tok_prec);
         get_next_token(); // eat BinOp
 
         auto RHS = parser_primary();
         if (!RHS)
             return nullptr;
+        Operands.push_back(RHS);
+    }
+    while (!Ops.empty())
+        reduce();
+    return Operands.back();
+}
+
+// postfix
+//   ::= ('[' expression ']' | '.' identifier | '.' identifier '(' expression* ')' | '(' expression* ')')*
+std::shared_ptr<ExprAST> ParserImpl::parser_postfix(std::shared_ptr<ExprAST> Object)
+{
+#ifdef LOG
+    log("in parser_postfix");
+#endif
+    while (true)
+    {
+        if (CurToken.tk_string == "[")
+        {
+            get_next_token(); // eat '['
+            auto Index = parser_experssion();
+            if (CurToken.tk_string != "]")
+                parser_err("[parser_postfix] Expected ']'!");
+            get_next_token(); // eat ']'
+            Object = std::make_shared<IndexExprAST>(Object, Index);
+            continue;
+        }
 
-        int next_prec = get_tok_prec(CurToken.tk_string);
-        if (tok_prec < next_prec)
+        if (CurToken.tk_string == ".")
         {
-            RHS = parser_binaryOpExpr(tok_prec + 1, RHS);
-            if (!RHS)
-                return nullptr;
+            get_next_token(); // eat '.'
+            if (CurToken.tk_type != Lexer::Type::tok_identifier)
+                parser_err("[parser_postfix] Expected property name after '.'!");
+            auto Name = CurToken.tk_string;
+            get_next_token(); // eat property name
+            if (CurToken.tk_string == "(")
+            {
+                auto Args = parser_parameter_list("(", ")", "parser_postfix", ",");
+                Object = std::make_shared<MethodCallExprAST>(Object, Name, Args);
+            }
+            else
+                Object = std::make_shared<MemberExprAST>(Object, Name);
+            continue;
         }
-        LHS = std::make_shared<BinaryOpExprAST>(bin_op, LHS, RHS);
+
+        // Call the value of an expression
+        if (CurToken.tk_string == "(")
+        {
+            auto Args = parser_parameter_list("(", ")", "parser_postfix", ",");
+            Object = std::make_shared<ApplyExprAST>(Object, Args);
+            continue;
+        }
+
+        return Object;
     }
 }
 
+// arrayexpr
+//   ::= '[' expression, ... ']'
+std::shared_ptr<ExprAST> ParserImpl::parser_array()
+{
+#ifdef LOG
+    log("in parser_array");
+#endif
+    auto Elements = parser_parameter_list("[", "]", "parser_array", ",");
+    return std::make_shared<ArrayExprAST>(Elements);
+}
+
 // value_expr
 //  ::= double
 //  ::= long long
@@ -145,6 +244,22 @@ std::shared_ptr<ExprAST> ParserImpl::parser_value()
     return nullptr;
 }
 
+// regexexpr
+//   ::= '/' pattern '/' flags
+// The pattern is compiled when it is first evaluated.
+std::shared_ptr<ExprAST> ParserImpl::parser_regex()
+{
+#ifdef LOG
+    log("in parser_regex");
+#endif
+    auto Literal = CurToken.tk_string;
+    if (Literal.empty())
+        parser_err("[parser_regex] Invalid regular expression: missing /");
+    get_next_token(); // eat regex
+    auto End = Literal.rfind('/');
+    return std::make_shared<RegexExprAST>(Literal.substr(1, End - 1), Literal.substr(End + 1));
+}
+
 // identifierexpr
 //   ::= identifier
 //   ::= identifier '(' expression* ')'
@@ -196,9 +311,46 @@ std::shared_ptr<ExprAST> ParserImpl::parser_variable_define()
 
 // objectexpr
 //   ::= '{' key:value, key:value, ... '}'
+// key ::= identifier | string
+// Only in an expression, a '{' starting a statement is a block.
 std::shared_ptr<ExprAST> ParserImpl::parser_object()
 {
-    return nullptr;
+#ifdef LOG
+    log("in parser_object");
+#endif
+    bool has_comma_op = get_tok_prec(",") != -1;
+    del_op(",");
+    get_next_token(); // eat '{'
+
+    std::vector<std::pair<std::string, std::shared_ptr<ExprAST>>> Props;
+    while (CurToken.tk_string != "}")
+    {
+        // Any identifier is a key, keywords too: { if: 1, null: 2 }
+        if (CurToken.tk_type == Lexer::Type::tok_integer || CurToken.tk_type == Lexer::Type::tok_float
+            || CurToken.tk_type == Lexer::Type::tok_single_char || CurToken.tk_type == Lexer::Type::tok_op
+            || CurToken.tk_type == Lexer::Type::tok_eof)
+            parser_err("[parser_object] Expected a property name!");
+        auto Key = CurToken.tk_string;
+        get_next_token(); // eat key
+        if (CurToken.tk_string != ":")
+            parser_err("[parser_object] Expected ':' after property name!");
+        get_next_token(); // eat ':'
+
+        auto V = parser_experssion();
+        if (!V)
+            parser_err("[parser_object] Expected a property value!");
+        Props.emplace_back(Key, V);
+
+        if (CurToken.tk_string == "}")
+            break;
+        if (CurToken.tk_string != ",")
+            parser_err("[parser_object] Expected ',' or '}'!");
+        get_next_token(); // eat ','
+    }
+    get_next_token(); // eat '}'
+    if (has_comma_op)
+        set_op(",", 1);
+    return std::make_shared<ObjectExprAST>(Props);
 }
 
 // parenexpr ::= '(' expression ')'
@@ -239,19 +391,48 @@ std::shared_ptr<PrototypeAST> ParserImpl::parser_prototype()
     return std::make_shared<PrototypeAST>(FnName, Args);
 }
 
-// functionexpr ::= 'function' identifier parenexpr
+// functionexpr ::= 'function' identifier? parenexpr blockexpr
 std::shared_ptr<FunctionAST> ParserImpl::parser_function()
 {
 #ifdef LOG
     log("in parser_function");
 #endif
+    auto Line = LineNumber;
     get_next_token(); // eat 'funtion'
     auto Proto = parser_prototype();
     if (!Proto)
         return nullptr;
 
     auto Body = parser_block("function");
-    return std::make_shared<FunctionAST>(Proto, Body);
+    auto F = std::make_shared<FunctionAST>(Proto, Body);
+    F->File = FileName;
+    F->Line = Line;
+    return F;
+}
+
+// asyncexpr ::= 'async' functionexpr
+std::shared_ptr<FunctionAST> ParserImpl::parser_async()
+{
+#ifdef LOG
+    log("in parser_async");
+#endif
+    get_next_token(); // eat 'async'
+    if (CurToken.tk_type != Lexer::Type::tok_function)
+        parser_err("[parser_async] Expected 'function' after 'async'.");
+    auto F = parser_function();
+    F->IsAsync = true;
+    return F;
+}
+
+// awaitexpr ::= 'await' primary
+std::shared_ptr<ExprAST> ParserImpl::parser_await()
+{
+#ifdef LOG
+    log("in parser_await");
+#endif
+    get_next_token(); // eat 'await'
+    auto E = parser_primary();
+    return std::make_shared<AwaitExprAST>(E);
 }
 
 // returnexpr ::= 'return' expression?
@@ -268,7 +449,7 @@ std::shared_ptr<ExprAST> ParserImpl::parser_return()
 }
 
 // breakexpr ::= 'break'
-inline std::shared_ptr<ExprAST> ParserImpl::parser_break()
+std::shared_ptr<ExprAST> ParserImpl::parser_break()
 {
 #ifdef LOG
     log("in parser_break");
@@ -278,7 +459,7 @@ inline std::shared_ptr<ExprAST> ParserImpl::parser_break()
 }
 
 // continuexpr ::= 'continue'
-inline std::shared_ptr<ExprAST> ParserImpl::parser_continue()
+std::shared_ptr<ExprAST> ParserImpl::parser_continue()
 {
 #ifdef LOG
     log("in parser_continue");
@@ -365,6 +546,9 @@ std::shared_ptr<ExprAST> ParserImpl::parser_do_while()
     return std::make_shared<DoWhileExprAST>(Block, Cond);
 }
 
+// forexpr
+//   ::= 'for' '(' expression ';' expression ';' expression ')' blockexpr
+//   ::= 'for' '(' variablexpr 'of' expression ')' blockexpr
 std::shared_ptr<ExprAST> ParserImpl::parser_for()
 {
 #ifdef LOG
@@ -373,7 +557,12 @@ std::shared_ptr<ExprAST> ParserImpl::parser_for()
     get_next_token(); // eat 'for'
     get_next_token(); // eat '('
     std::vector<std::shared_ptr<ExprAST>> Cond;
-    Cond.push_back(parser_variable_define());
+    set_op("of", 20); // 'of' is only an operator in the head of 'for'
+    auto Init = parser_variable_define();
+    del_op("of");
+    if (isBinaryOp(Init) && std::static_pointer_cast<BinaryOpExprAST>(Init)->Op == "of")
+        return parser_for_of(Init);
+    Cond.push_back(Init);
     get_next_token(); // eat ';'
     Cond.push_back(parser_experssion());
     get_next_token(); // eat ';'
@@ -392,6 +581,30 @@ std::shared_ptr<ExprAST> ParserImpl::parser_for()
     return std::make_shared<ForExprAST>(Cond, parser_block("for"));
 }
 
+// forofexpr
+//   ::= 'for' '(' variablexpr 'of' expression ')' blockexpr
+// Cond is the parsed `x of iterable`, the current token is ')'.
+std::shared_ptr<ExprAST> ParserImpl::parser_for_of(std::shared_ptr<ExprAST> Cond)
+{
+#ifdef LOG
+    log("in parser_for_of");
+#endif
+    auto Of = std::static_pointer_cast<BinaryOpExprAST>(Cond);
+    if (!isVariable(Of->LHS))
+        parser_err("[parser_for_of] Expected a variable before 'of'.");
+    if (CurToken.tk_string != ")")
+        parser_err("[parser_for_of] Expected ')'!");
+    get_next_token(); // eat ')'
+
+    auto Var = std::static_pointer_cast<VariableExprAST>(Of->LHS);
+    if (CurToken.tk_string == ";")
+    {
+        get_next_token(); // eat ';'
+        return std::make_shared<ForOfExprAST>(Var, Of->RHS, std::make_shared<BlockExprAST>());
+    }
+    return std::make_shared<ForOfExprAST>(Var, Of->RHS, parser_block("for"));
+}
+
 // paramexpr
 //  ::= '(' expression, ... ')'
 std::vector<std::shared_ptr<ExprAST>> ParserImpl::parser_parameter_list(const std::string& _start, const std::string& _end, const std::string& err_func_name, const std::string& separater)
@@ -399,7 +612,9 @@ std::vector<std::shared_ptr<ExprAST>> ParserImpl::parser_parameter_list(const st
 #ifdef LOG
     log("in parser_parameter_list");
 #endif
-    del_op(","); // remove ',' from operator
+    // remove ',' from operator, nested lists must not put it back early
+    bool has_comma_op = get_tok_prec(",") != -1;
+    del_op(",");
     if (CurToken.tk_string != _start)
         parser_err("[" + err_func_name + "] Expected '" + _start + "'.");
     get_next_token(); // eat _start
@@ -423,7 +638,8 @@ std::vector<std::shared_ptr<ExprAST>> ParserImpl::parser_parameter_list(const st
         }
     }
     get_next_token(); // eat _end
-    set_op(",", 1);
+    if (has_comma_op)
+        set_op(",", 1);
     return Params;
 }
 
@@ -457,3 +673,130 @@ std::shared_ptr<BlockExprAST> ParserImpl::parser_block(const std::string& err_bl
     get_next_token(); // eat "}"
     return std::make_shared<BlockExprAST>(Statement);
 }
+
+// namelist ::= '{' identifier ('as' identifier)? (',' identifier ('as' identifier)?)* '}'
+// Pairs of the name and the name it goes by, the same without 'as'.
+std::vector<std::pair<std::string, std::string>> ParserImpl::parser_name_list(const std::string& err_func_name)
+{
+#ifdef LOG
+    log("in parser_name_list");
+#endif
+    get_next_token(); // eat '{'
+    std::vector<std::pair<std::string, std::string>> Names;
+    while (CurToken.tk_string != "}")
+    {
+        if (CurToken.tk_type != Lexer::Type::tok_identifier)
+            parser_err("[" + err_func_name + "] Expected a name.");
+        auto Name = CurToken.tk_string;
+        get_next_token(); // eat name
+        auto As = Name;
+        if (CurToken.tk_string == "as")
+        {
+            get_next_token(); // eat 'as'
+            if (CurToken.tk_type != Lexer::Type::tok_identifier)
+                parser_err("[" + err_func_name + "] Expected a name after 'as'.");
+            As = CurToken.tk_string;
+            get_next_token(); // eat name
+        }
+        Names.emplace_back(Name, As);
+        if (CurToken.tk_string == ",")
+            get_next_token(); // eat ','
+        else if (CurToken.tk_string != "}")
+            parser_err("[" + err_func_name + "] Expected ',' or '}'.");
+    }
+    get_next_token(); // eat '}'
+    return Names;
+}
+
+// importexpr
+//   ::= 'import' namelist 'from' string
+//   ::= 'import' '*' 'as' identifier 'from' string
+//   ::= 'import' string
+std::shared_ptr<ExprAST> ParserImpl::parser_import()
+{
+#ifdef LOG
+    log("in parser_import");
+#endif
+    get_next_token(); // eat 'import'
+    std::vector<std::pair<std::string, std::string>> Names;
+    std::string Namespace;
+    bool Bare = CurToken.tk_type == Lexer::Type::tok_string;
+    if (CurToken.tk_string == "*")
+    {
+        get_next_token(); // eat '*'
+        if (CurToken.tk_string != "as")
+            parser_err("[parser_import] Expected 'as' after '*'.");
+        get_next_token(); // eat 'as'
+        if (CurToken.tk_type != Lexer::Type::tok_identifier)
+            parser_err("[parser_import] Expected a name after 'as'.");
+        Namespace = CurToken.tk_string;
+        get_next_token(); // eat name
+    }
+    else if (CurToken.tk_string == "{")
+        Names = parser_name_list("parser_import");
+    else if (!Bare)
+        parser_err("[parser_import] Expected '{', '*' or the path of a module.");
+
+    if (!Bare)
+    {
+        if (CurToken.tk_string != "from")
+            parser_err("[parser_import] Expected 'from'.");
+        get_next_token(); // eat 'from'
+    }
+    if (CurToken.tk_type != Lexer::Type::tok_string)
+        parser_err("[parser_import] Expected the path of a module.");
+
+    auto Import = std::make_shared<ImportExprAST>(CurToken.tk_string);
+    get_next_token(); // eat path
+    Import->Names = std::move(Names);
+    Import->Namespace = Namespace;
+    return Import;
+}
+
+// exportexpr
+//   ::= 'export' functionexpr
+//   ::= 'export' asyncexpr
+//   ::= 'export' ('let' | 'var') identifier ('=' expression)?
+//   ::= 'export' namelist
+std::shared_ptr<ExprAST> ParserImpl::parser_export()
+{
+#ifdef LOG
+    log("in parser_export");
+#endif
+    get_next_token(); // eat 'export'
+    if (CurToken.tk_string == "{")
+    {
+        auto Export = std::make_shared<ExportExprAST>(nullptr);
+        Export->Names = parser_name_list("parser_export");
+        return Export;
+    }
+
+    std::shared_ptr<ExprAST> Declaration;
+    std::string Name;
+    switch (CurToken.tk_type)
+    {
+        case Lexer::Type::tok_function: case Lexer::Type::tok_async:
+        {
+            auto F = CurToken.tk_type == Lexer::Type::tok_async ? parser_async() : parser_function();
+            Name = F->Proto->Name;
+            Declaration = F;
+            break;
+        }
+        case Lexer::Type::tok_variable_declare:
+        {
+            Declaration = parser_variable_define();
+            auto V = isBinaryOp(Declaration) ? std::static_pointer_cast<BinaryOpExprAST>(Declaration)->LHS : Declaration;
+            if (isVariable(V))
+                Name = std::static_pointer_cast<VariableExprAST>(V)->Name;
+            break;
+        }
+        default:
+            break;
+    }
+    if (Name.empty())
+        parser_err("[parser_export] Expected a named function, a variable or '{'.");
+
+    auto Export = std::make_shared<ExportExprAST>(Declaration);
+    Export->Names.emplace_back(Name, Name);
+    return Export;
+}
@@ -4,10 +4,12 @@
 #include "lex.h"
 #include "ast.h"
 #include "log.h"
+#include "output.h"
 #include <unordered_map>
 #include <memory>
 #include <cstdlib>
 #include <iostream>
+#include <stdexcept>
 
 // #define LOG
 
@@ -16,6 +18,12 @@ namespace Parser
     using namespace Lexer;
     using namespace AST;
 
+    // What parser_err reports, thrown instead of exiting when Recover is set
+    struct ParseError : std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
     class ParserImpl : public Lexer::LexerImpl
     {
     private:
@@ -28,6 +36,9 @@ namespace Parser
         std::vector<std::shared_ptr<ExprAST>> parser_parameter_list(const std::string& _start, const std::string& _end, const std::string& err_func_name, const std::string& separater);
 
     public:
+        std::string FileName; // named in errors, empty for the script
+        bool Recover = false; // errors throw ParseError, the caller goes on (reload)
+
         ParserImpl() : ParserImpl(nullptr) { }
         ParserImpl(std::streambuf* sptr) : LexerImpl(sptr) { parser_init(); }
         ~ParserImpl() = default;
@@ -46,9 +57,14 @@ namespace Parser
         std::shared_ptr<ExprAST> parser_primary();
         std::shared_ptr<ExprAST> parser_value();
         std::shared_ptr<ExprAST> parser_object();
+        std::shared_ptr<ExprAST> parser_array();
+        std::shared_ptr<ExprAST> parser_regex();
+        std::shared_ptr<ExprAST> parser_postfix(std::shared_ptr<ExprAST> Object);
         std::shared_ptr<ExprAST> parser_identifier(const std::string& DefineType = "");
         std::shared_ptr<ExprAST> parser_parenExpr();
         std::shared_ptr<FunctionAST> parser_function();
+        std::shared_ptr<FunctionAST> parser_async();
+        std::shared_ptr<ExprAST> parser_await();
         std::shared_ptr<PrototypeAST> parser_prototype();
         std::shared_ptr<ExprAST> parser_return();
         std::shared_ptr<ExprAST> parser_break();
@@ -58,7 +74,11 @@ namespace Parser
         std::shared_ptr<ExprAST> parser_while();
         std::shared_ptr<ExprAST> parser_do_while();
         std::shared_ptr<ExprAST> parser_for();
+        std::shared_ptr<ExprAST> parser_for_of(std::shared_ptr<ExprAST> Cond);
         std::shared_ptr<BlockExprAST> parser_block(const std::string& err_block_name = "__anony");
+        std::vector<std::pair<std::string, std::string>> parser_name_list(const std::string& err_func_name);
+        std::shared_ptr<ExprAST> parser_import();
+        std::shared_ptr<ExprAST> parser_export();
 
         void set_op(const std::string& Op, int Level)
         { BinOpPrecedence[Op] = Level; }
@@ -125,6 +145,7 @@ namespace Parser
             switch (CurToken.tk_type)
             {
                 case Lexer::Type::tok_function: ret = parser_function(); break;
+                case Lexer::Type::tok_async:    ret = parser_async();    break;
                 case Lexer::Type::tok_if:       ret = parser_if();       break;
                 case Lexer::Type::tok_while:    ret = parser_while();    break;
                 case Lexer::Type::tok_for:      ret = parser_for();      break;
@@ -133,6 +154,8 @@ namespace Parser
                 case Lexer::Type::tok_return:   ret = parser_return();   break;
                 case Lexer::Type::tok_break:    ret = parser_break();    break;
                 case Lexer::Type::tok_continue: ret = parser_continue(); break;
+                case Lexer::Type::tok_import:   ret = parser_import();   break;
+                case Lexer::Type::tok_export:   ret = parser_export();   break;
                 case Lexer::Type::tok_eof:      return nullptr;
                 default:
                 {
@@ -150,8 +173,14 @@ namespace Parser
 
         void parser_err(const std::string& loginfo)
         {
+            if (Recover)
+                throw ParseError(loginfo + " (in line: " + std::to_string(LineNumber) + ", in token: '" + CurToken.tk_string + "')");
+            Output::out().flush(); // keep the order of output and error
             std::cerr << loginfo;
-            std::cerr << "\n[PARSER_ERROR] in line: " << LineNumber << ", ";
+            std::cerr << "\n[PARSER_ERROR] ";
+            if (!FileName.empty())
+                std::cerr << "in " << FileName << ", ";
+            std::cerr << "in line: " << LineNumber << ", ";
             std::cerr << "in token: ";
             print_token(CurToken);
             std::cerr << std::endl;
@@ -0,0 +1,183 @@
+#include "perf.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <elf.h>
+#include <fcntl.h>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    enum class Mode { off, map, jitdump };
+
+#if defined(__x86_64__)
+    // push %rbp; mov %rsp,%rbp; call *%rsi; pop %rbp; ret
+    const unsigned char Code[] = { 0x55, 0x48, 0x89, 0xe5, 0xff, 0xd6, 0x5d, 0xc3 };
+    const uint32_t Machine = EM_X86_64;
+    const bool Supported = true;
+#else
+    const unsigned char Code[] = { 0 };
+    const uint32_t Machine = 0;
+    const bool Supported = false;
+#endif
+    const size_t Slot = 16;         // a trampoline, int3 after the code
+    const size_t Arena = 64 * 1024; // mapped at once, filled with copies
+
+    // tools/perf/Documentation/jitdump-specification.txt
+    struct DumpHeader
+    {
+        uint32_t Magic, Version, TotalSize, ElfMach, Pad1, Pid;
+        uint64_t Timestamp, Flags;
+    };
+    struct RecordHeader
+    {
+        uint32_t Id, TotalSize;
+        uint64_t Timestamp;
+    };
+    const uint32_t JitCodeLoad = 0, JitCodeDebugInfo = 2;
+
+    // perf record -k 1 samples with this clock
+    uint64_t timestamp()
+    {
+        struct timespec T;
+        clock_gettime(CLOCK_MONOTONIC, &T);
+        return (uint64_t)T.tv_sec * 1000000000 + T.tv_nsec;
+    }
+
+    Mode mode()
+    {
+        static const Mode M = [] {
+            const char* Env = getenv("TINYJS_PERF");
+            if (!Env || !*Env || !Supported)
+                return Mode::off;
+            return strcmp(Env, "jitdump") == 0 ? Mode::jitdump : Mode::map;
+        }();
+        return M;
+    }
+
+    class WriterImpl
+    {
+    private:
+        std::mutex Lock;
+        unsigned char *Free = nullptr, *End = nullptr; // of the current arena
+        FILE* Map = nullptr;
+        FILE* Dump = nullptr;
+        uint64_t Index = 0;
+
+        // The copies are written before the arena turns executable, nothing
+        // is written to it afterwards
+        bool new_arena()
+        {
+            void* P = mmap(nullptr, Arena, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (P == MAP_FAILED)
+                return false;
+            auto A = static_cast<unsigned char*>(P);
+            memset(A, 0xcc, Arena);
+            for (size_t i = 0; i + Slot <= Arena; i += Slot)
+                memcpy(A + i, Code, sizeof(Code));
+            if (mprotect(A, Arena, PROT_READ | PROT_EXEC) != 0)
+            {
+                munmap(A, Arena);
+                return false;
+            }
+            Free = A;
+            End = A + Arena;
+            return true;
+        }
+
+        void open_files()
+        {
+            char Path[64];
+            snprintf(Path, sizeof(Path), "/tmp/perf-%d.map", (int)getpid());
+            if (!(Map = fopen(Path, "w")))
+                fprintf(stderr, "[perf] can not write %s\n", Path);
+            if (mode() != Mode::jitdump)
+                return;
+
+            snprintf(Path, sizeof(Path), "/tmp/jit-%d.dump", (int)getpid());
+            int Fd = ::open(Path, O_CREAT | O_TRUNC | O_RDWR, 0666);
+            if (Fd < 0 || !(Dump = fdopen(Fd, "w+")))
+            {
+                fprintf(stderr, "[perf] can not write %s\n", Path);
+                return;
+            }
+            DumpHeader H = { 0x4A695444, 1, sizeof(DumpHeader), Machine, 0, (uint32_t)getpid(), timestamp(), 0 };
+            fwrite(&H, sizeof(H), 1, Dump);
+            fflush(Dump);
+            // perf record finds the dump by this executable mapping of it
+            if (mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, Fd, 0) == MAP_FAILED)
+                fprintf(stderr, "[perf] can not map %s, perf will not find it\n", Path);
+        }
+
+        void write_dump(uint64_t Addr, const std::string& Symbol, const std::string& File, unsigned long long Line)
+        {
+            // The lines of a code range come before its load
+            uint64_t Info[2] = { Addr, 1 };
+            uint32_t Entry[2] = { (uint32_t)Line, 0 }; // line, discriminator
+            RecordHeader D = { JitCodeDebugInfo, (uint32_t)(sizeof(D) + sizeof(Info) + sizeof(Addr) + sizeof(Entry) + File.size() + 1), timestamp() };
+            fwrite(&D, sizeof(D), 1, Dump);
+            fwrite(Info, sizeof(Info), 1, Dump);
+            fwrite(&Addr, sizeof(Addr), 1, Dump);
+            fwrite(Entry, sizeof(Entry), 1, Dump);
+            fwrite(File.c_str(), File.size() + 1, 1, Dump);
+
+            uint32_t Ids[2] = { (uint32_t)getpid(), (uint32_t)syscall(SYS_gettid) };
+            uint64_t Load[4] = { Addr, Addr, sizeof(Code), Index++ }; // vma, code address, size, index
+            RecordHeader L = { JitCodeLoad, (uint32_t)(sizeof(L) + sizeof(Ids) + sizeof(Load) + Symbol.size() + 1 + sizeof(Code)), timestamp() };
+            fwrite(&L, sizeof(L), 1, Dump);
+            fwrite(Ids, sizeof(Ids), 1, Dump);
+            fwrite(Load, sizeof(Load), 1, Dump);
+            fwrite(Symbol.c_str(), Symbol.size() + 1, 1, Dump);
+            fwrite(Code, sizeof(Code), 1, Dump);
+            fflush(Dump);
+        }
+
+    public:
+        Perf::Entry make(const std::string& Name, const std::string& File, unsigned long long Line)
+        {
+            std::lock_guard<std::mutex> G(Lock);
+            if (Free == End)
+            {
+                if (!Map && !Dump)
+                    open_files();
+                if (!new_arena())
+                    return nullptr;
+            }
+            auto Addr = Free;
+            Free += Slot;
+
+            std::string Where = (File.empty() ? "script" : File) + ":" + std::to_string(Line);
+            std::string Symbol = "js:" + (Name.empty() ? std::string("(anonymous)") : Name) + " " + Where;
+            // Written at once, perf may read while the script runs
+            if (Map)
+            {
+                fprintf(Map, "%llx %zx %s\n", (unsigned long long)(uintptr_t)Addr, sizeof(Code), Symbol.c_str());
+                fflush(Map);
+            }
+            if (Dump)
+                write_dump((uintptr_t)Addr, Symbol, File.empty() ? "script" : File, Line);
+            return reinterpret_cast<Perf::Entry>(Addr);
+        }
+    };
+
+    WriterImpl& writer()
+    {
+        static WriterImpl W;
+        return W;
+    }
+}
+
+bool Perf::enabled()
+{
+    return mode() != Mode::off;
+}
+
+Perf::Entry Perf::make_entry(const std::string& Name, const std::string& File, unsigned long long Line)
+{
+    return enabled() ? writer().make(Name, File, Line) : nullptr;
+}
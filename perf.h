@@ -0,0 +1,36 @@
+#ifndef TINYJS_PERF
+#define TINYJS_PERF
+
+#include <string>
+
+// Script level symbols for Linux perf (TINYJS_PERF=map or TINYJS_PERF=jitdump).
+//
+// Scripts are not compiled, a sample lands in the eval_* functions whatever
+// script function runs. To tell them apart every script function gets a
+// trampoline on its first call: a few bytes of machine code, a copy of its
+// own, that call the body. It sits in the call chain between the frames of
+// the interpreter, at an address named after the function:
+//
+//   map      /tmp/perf-<pid>.map, "<addr> <size> js:<name> <file>:<line>",
+//            perf report reads it as is.
+//   jitdump  the map too, and /tmp/jit-<pid>.dump: a code load and a line
+//            record per trampoline. perf record -k 1, then perf inject --jit
+//            before perf report.
+//
+// The chains come from frame pointers, the trampolines keep one: build with
+// -fno-omit-frame-pointer and record with -g. x86-64 only, elsewhere the
+// variable is ignored.
+
+namespace Perf
+{
+    // Calls Fn(Arg)
+    using Entry = void (*)(void* Arg, void (*Fn)(void* Arg));
+
+    bool enabled();
+
+    // A new trampoline, written to the map (and the dump) as the function
+    // Name of File ("script" if empty) at Line. nullptr if not enabled.
+    Entry make_entry(const std::string& Name, const std::string& File, unsigned long long Line);
+}
+
+#endif
@@ -0,0 +1,143 @@
+#include "pool.h"
+#include <cstdlib>
+using namespace Pool;
+
+namespace
+{
+    thread_local bool InWorker = false;
+}
+
+PoolImpl& Pool::pool()
+{
+    static PoolImpl P([] {
+        size_t N = std::thread::hardware_concurrency();
+        if (auto Env = getenv("TINYJS_THREADS"))
+            N = strtoul(Env, nullptr, 10);
+        return N ? N : 1;
+    }());
+    return P;
+}
+
+PoolImpl::PoolImpl(size_t N) : Remaining(0)
+{
+    if (!N) N = 1;
+    for (size_t i = 0; i < N; i++)
+        Queues.emplace_back(new Queue);
+    for (size_t i = 1; i < N; i++)
+        Threads.emplace_back(&PoolImpl::worker_main, this, i);
+}
+
+PoolImpl::~PoolImpl()
+{
+    {
+        std::lock_guard<std::mutex> G(Lock);
+        Stop = true;
+    }
+    Wake.notify_all();
+    for (auto& T : Threads)
+        T.join();
+}
+
+void PoolImpl::run(size_t N, const Task& Fn)
+{
+    if (!N)
+        return;
+    if (InWorker || Queues.size() == 1 || N == 1)
+    {
+        for (size_t i = 0; i < N; i++)
+            Fn(i, 0);
+        return;
+    }
+
+    // Contiguous shares keep neighbouring tasks on one worker
+    size_t Workers = Queues.size();
+    for (size_t w = 0; w < Workers; w++)
+    {
+        std::lock_guard<std::mutex> G(Queues[w]->Lock);
+        for (size_t i = N * w / Workers; i < N * (w + 1) / Workers; i++)
+            Queues[w]->Items.push_back(i);
+    }
+
+    {
+        std::lock_guard<std::mutex> G(Lock);
+        Remaining = N;
+        Job = &Fn;
+        Generation++;
+    }
+    Wake.notify_all();
+
+    InWorker = true;
+    work(0);
+    InWorker = false;
+
+    // No worker may still hold Job once we return
+    std::unique_lock<std::mutex> G(Lock);
+    Done.wait(G, [this] { return Remaining == 0 && Active == 0; });
+    Job = nullptr;
+}
+
+bool PoolImpl::pop(size_t Worker, size_t& Index)
+{
+    {
+        auto& Own = *Queues[Worker];
+        std::lock_guard<std::mutex> G(Own.Lock);
+        if (!Own.Items.empty())
+        {
+            Index = Own.Items.back();
+            Own.Items.pop_back();
+            return true;
+        }
+    }
+
+    // Steal the oldest task of another worker
+    for (size_t k = 1; k < Queues.size(); k++)
+    {
+        auto& Victim = *Queues[(Worker + k) % Queues.size()];
+        std::lock_guard<std::mutex> G(Victim.Lock);
+        if (!Victim.Items.empty())
+        {
+            Index = Victim.Items.front();
+            Victim.Items.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void PoolImpl::work(size_t Worker)
+{
+    size_t Index;
+    while (pop(Worker, Index))
+    {
+        (*Job)(Index, Worker);
+        if (--Remaining == 0)
+        {
+            std::lock_guard<std::mutex> G(Lock);
+            Done.notify_all();
+        }
+    }
+}
+
+void PoolImpl::worker_main(size_t Worker)
+{
+    InWorker = true;
+    unsigned long long Seen = 0;
+    std::unique_lock<std::mutex> G(Lock);
+    while (true)
+    {
+        Wake.wait(G, [&] { return Stop || Generation != Seen; });
+        if (Stop)
+            return;
+        Seen = Generation;
+        if (!Job) // finished before we woke up
+            continue;
+
+        Active++;
+        G.unlock();
+        work(Worker);
+        G.lock();
+        Active--;
+        if (!Active)
+            Done.notify_all();
+    }
+}
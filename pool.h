@@ -0,0 +1,65 @@
+#ifndef TINYJS_POOL
+#define TINYJS_POOL
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Work stealing thread pool for the parallel builtins.
+// run() hands every worker a contiguous share of the task indices. A worker
+// takes its own tasks from the back of its queue and, once empty, steals
+// from the front of the others. The calling thread is worker 0.
+
+namespace Pool
+{
+    class PoolImpl
+    {
+    public:
+        using Task = std::function<void(size_t Index, size_t Worker)>;
+
+        // Threads is the number of workers including the caller
+        explicit PoolImpl(size_t Threads);
+        ~PoolImpl();
+
+        PoolImpl(const PoolImpl&) = delete;
+        const PoolImpl& operator =(const PoolImpl&) = delete;
+
+        size_t size() const { return Queues.size(); }
+
+        // Run Fn(i, worker) for every i in [0, N), returns when all are done.
+        // Called from a worker it runs everything on that thread.
+        void run(size_t N, const Task& Fn);
+
+    private:
+        struct Queue
+        {
+            std::mutex Lock;
+            std::deque<size_t> Items;
+        };
+        std::vector<std::unique_ptr<Queue>> Queues;
+        std::vector<std::thread> Threads;
+
+        std::mutex Lock;
+        std::condition_variable Wake, Done;
+        const Task* Job = nullptr;
+        unsigned long long Generation = 0;
+        size_t Active = 0;
+        std::atomic<size_t> Remaining;
+        bool Stop = false;
+
+        bool pop(size_t Worker, size_t& Index);
+        void work(size_t Worker);
+        void worker_main(size_t Worker);
+    };
+
+    // Shared pool, TINYJS_THREADS sets its size (default: hardware threads)
+    PoolImpl& pool();
+}
+
+#endif
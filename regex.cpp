@@ -0,0 +1,772 @@
+#include "regex.h"
+#include <algorithm>
+#include <cstring>
+using namespace Regex;
+
+/* -- Pattern -- */
+namespace
+{
+    struct Node
+    {
+        enum class Kind { empty, set, cat, alt, repeat, begin, end };
+        Kind K;
+        int Set = -1;
+        int Min = 0, Max = -1; // repeat, Max -1 has no bound
+        std::vector<std::unique_ptr<Node>> Kids;
+
+        explicit Node(Kind K) : K(K) { }
+    };
+    using NodePtr = std::unique_ptr<Node>;
+
+    const int MaxNesting = 200;
+    const int MaxRepeat = 1000;
+    const size_t MaxInsts = 1 << 16;
+
+    // pattern     ::= alternative ('|' alternative)*
+    // alternative ::= (atom quantifier*)*
+    // quantifier  ::= '*' | '+' | '?' | '{' n '}' | '{' n ',' '}' | '{' n ',' m '}'
+    // atom        ::= '(' ('?:')? pattern ')' | '[' class ']' | '.' | '^' | '$' | '\' escape | byte
+    class PatternParser
+    {
+    public:
+        std::string Err;
+
+        PatternParser(const std::string& Src, bool IgnoreCase, std::vector<ByteSet>& Sets)
+            : Src(Src), IgnoreCase(IgnoreCase), Sets(Sets) { }
+
+        bool parse(NodePtr& Out)
+        {
+            if (!alternation(Out))
+                return false;
+            if (P < Src.size()) // only a ')' stops the top level early
+                return fail("Unmatched ')'");
+            return true;
+        }
+
+    private:
+        const std::string& Src;
+        size_t P = 0;
+        int Depth = 0;
+        bool IgnoreCase;
+        std::vector<ByteSet>& Sets;
+
+        bool fail(const std::string& What)
+        {
+            if (Err.empty())
+                Err = What;
+            return false;
+        }
+        bool at(char C) const { return P < Src.size() && Src[P] == C; }
+
+        int add_set(ByteSet S)
+        {
+            if (IgnoreCase)
+                for (int C = 'a'; C <= 'z'; C++)
+                    if (S[C] || S[C - 32])
+                        S[C] = S[C - 32] = true;
+            Sets.push_back(S);
+            return Sets.size() - 1;
+        }
+        NodePtr make_set(const ByteSet& S)
+        {
+            NodePtr N(new Node(Node::Kind::set));
+            N->Set = add_set(S);
+            return N;
+        }
+
+        bool alternation(NodePtr& Out)
+        {
+            NodePtr First;
+            if (!sequence(First))
+                return false;
+            if (!at('|'))
+            {
+                Out = std::move(First);
+                return true;
+            }
+            Out.reset(new Node(Node::Kind::alt));
+            Out->Kids.push_back(std::move(First));
+            while (at('|'))
+            {
+                P++; // eat '|'
+                NodePtr Next;
+                if (!sequence(Next))
+                    return false;
+                Out->Kids.push_back(std::move(Next));
+            }
+            return true;
+        }
+
+        bool sequence(NodePtr& Out)
+        {
+            Out.reset(new Node(Node::Kind::cat));
+            while (P < Src.size() && Src[P] != '|' && Src[P] != ')')
+            {
+                NodePtr A;
+                if (!quantified(A))
+                    return false;
+                Out->Kids.push_back(std::move(A));
+            }
+            if (Out->Kids.empty())
+                Out.reset(new Node(Node::Kind::empty));
+            else if (Out->Kids.size() == 1)
+                Out = std::move(Out->Kids[0]);
+            return true;
+        }
+
+        // {n}, {n,} or {n,m} at P, anything else is a literal '{'
+        bool bounds(int& Min, int& Max)
+        {
+            size_t Q = P + 1;
+            auto number = [&](int& N) {
+                size_t From = Q;
+                long long V = 0;
+                while (Q < Src.size() && isdigit((unsigned char)Src[Q]))
+                    V = std::min<long long>(V * 10 + (Src[Q++] - '0'), MaxRepeat + 1);
+                N = V;
+                return Q > From;
+            };
+            if (!number(Min))
+                return false;
+            Max = Min;
+            if (Q < Src.size() && Src[Q] == ',')
+            {
+                Q++;
+                if (!number(Max))
+                    Max = -1;
+            }
+            if (Q >= Src.size() || Src[Q] != '}')
+                return false;
+            P = Q + 1;
+            return true;
+        }
+
+        bool quantified(NodePtr& Out)
+        {
+            if (!atom(Out))
+                return false;
+            while (P < Src.size())
+            {
+                int Min, Max;
+                char C = Src[P];
+                if (C == '*')      { Min = 0; Max = -1; P++; }
+                else if (C == '+') { Min = 1; Max = -1; P++; }
+                else if (C == '?') { Min = 0; Max = 1;  P++; }
+                else if (C == '{' && bounds(Min, Max))
+                {
+                    if (Min > MaxRepeat || Max > MaxRepeat)
+                        return fail("repeat count is too large");
+                    if (Max >= 0 && Max < Min)
+                        return fail("numbers out of order in {} quantifier");
+                }
+                else
+                    break;
+                if (at('?'))
+                    return fail("lazy quantifiers are not supported");
+
+                NodePtr R(new Node(Node::Kind::repeat));
+                R->Min = Min;
+                R->Max = Max;
+                R->Kids.push_back(std::move(Out));
+                Out = std::move(R);
+            }
+            return true;
+        }
+
+        bool atom(NodePtr& Out)
+        {
+            char C = Src[P++];
+            switch (C)
+            {
+                case '*': case '+': case '?':
+                    return fail("Nothing to repeat");
+                case '^':
+                    Out.reset(new Node(Node::Kind::begin));
+                    return true;
+                case '$':
+                    Out.reset(new Node(Node::Kind::end));
+                    return true;
+                case '.':
+                {
+                    ByteSet S;
+                    S.set();
+                    S['\n'] = S['\r'] = false;
+                    Out = make_set(S);
+                    return true;
+                }
+                case '[':
+                {
+                    ByteSet S;
+                    if (!byte_class(S))
+                        return false;
+                    Out = make_set(S);
+                    return true;
+                }
+                case '(':
+                {
+                    if (at('?'))
+                    {
+                        if (Src.compare(P, 2, "?:") == 0)
+                            P += 2;
+                        else if (Src.compare(P, 2, "?=") == 0 || Src.compare(P, 2, "?!") == 0 ||
+                                 Src.compare(P, 3, "?<=") == 0 || Src.compare(P, 3, "?<!") == 0)
+                            return fail("lookaround is not supported");
+                        else if (Src.compare(P, 2, "?<") == 0 && Src.find('>', P) != std::string::npos)
+                            P = Src.find('>', P) + 1; // named, groups do not capture anyway
+                        else
+                            return fail("Invalid group");
+                    }
+                    if (++Depth > MaxNesting)
+                        return fail("groups are nested too deeply");
+                    if (!alternation(Out))
+                        return false;
+                    Depth--;
+                    if (!at(')'))
+                        return fail("Unterminated group");
+                    P++; // eat ')'
+                    return true;
+                }
+                case '\\':
+                {
+                    ByteSet S;
+                    if (!escape(S, false))
+                        return false;
+                    Out = make_set(S);
+                    return true;
+                }
+                default:
+                {
+                    ByteSet S;
+                    S[(unsigned char)C] = true;
+                    Out = make_set(S);
+                    return true;
+                }
+            }
+        }
+
+        // After '\', inside a class \b is a backspace
+        bool escape(ByteSet& S, bool InClass)
+        {
+            if (P >= Src.size())
+                return fail("\\ at end of pattern");
+            char C = Src[P++];
+            switch (C)
+            {
+                case 'd': case 'D':
+                    for (int B = '0'; B <= '9'; B++) S[B] = true;
+                    break;
+                case 'w': case 'W':
+                    for (int B = 0; B < 256; B++) S[B] = isalnum(B) || B == '_';
+                    break;
+                case 's': case 'S':
+                    for (char B : std::string(" \t\n\v\f\r")) S[(unsigned char)B] = true;
+                    break;
+                case 'n': S['\n'] = true; return true;
+                case 't': S['\t'] = true; return true;
+                case 'r': S['\r'] = true; return true;
+                case 'f': S['\f'] = true; return true;
+                case 'v': S['\v'] = true; return true;
+                case '0': S[0] = true; return true;
+                case 'x':
+                {
+                    auto hex = [](char H) { return isdigit((unsigned char)H) ? H - '0' : (tolower(H) - 'a' + 10); };
+                    if (P + 2 > Src.size() || !isxdigit((unsigned char)Src[P]) || !isxdigit((unsigned char)Src[P + 1]))
+                        return fail("Invalid escape \\x");
+                    S[hex(Src[P]) * 16 + hex(Src[P + 1])] = true;
+                    P += 2;
+                    return true;
+                }
+                case 'b':
+                    if (InClass)
+                    {
+                        S['\b'] = true;
+                        return true;
+                    }
+                    return fail("\\b is not supported");
+                case 'B':
+                    return fail("\\B is not supported");
+                case 'u':
+                    return fail("\\u is not supported, text is matched as bytes");
+                default:
+                    if (C >= '1' && C <= '9')
+                        return fail("back references are not supported");
+                    S[(unsigned char)C] = true;
+                    return true;
+            }
+            if (isupper((unsigned char)C)) // \D \W \S
+                S.flip();
+            return true;
+        }
+
+        // After '['
+        bool byte_class(ByteSet& S)
+        {
+            bool Negate = at('^');
+            if (Negate)
+                P++;
+            bool First = true;
+            while (P < Src.size() && (Src[P] != ']' || First))
+            {
+                First = false;
+                ByteSet Item;
+                int Lo;
+                if (!class_atom(Item, Lo))
+                    return false;
+                // a-z, a range needs a single byte on both sides
+                if (Lo >= 0 && P + 1 < Src.size() && Src[P] == '-' && Src[P + 1] != ']')
+                {
+                    P++; // eat '-'
+                    ByteSet HiItem;
+                    int Hi;
+                    if (!class_atom(HiItem, Hi))
+                        return false;
+                    if (Hi < 0)
+                        return fail("Invalid character class");
+                    if (Hi < Lo)
+                        return fail("Range out of order in character class");
+                    for (int B = Lo; B <= Hi; B++)
+                        Item[B] = true;
+                }
+                S |= Item;
+            }
+            if (!at(']'))
+                return fail("Unterminated character class");
+            P++; // eat ']'
+            if (Negate)
+                S.flip();
+            return true;
+        }
+
+        // One member of a class, Byte is -1 when it is a set (\d)
+        bool class_atom(ByteSet& S, int& Byte)
+        {
+            char C = Src[P++];
+            if (C != '\\')
+            {
+                S[(unsigned char)C] = true;
+                Byte = (unsigned char)C;
+                return true;
+            }
+            if (!escape(S, true))
+                return false;
+            Byte = -1;
+            if (S.count() == 1)
+                for (int B = 0; B < 256; B++)
+                    if (S[B])
+                        Byte = B;
+            return true;
+        }
+    };
+}
+/* ++ Pattern ++ */
+
+/* -- Program -- */
+namespace
+{
+    // Thompson construction, back to front: each node is compiled with the
+    // instruction that follows it already known. The backward program reads
+    // a sequence from its end and swaps `^` and `$`.
+    class Compiler
+    {
+    public:
+        bool TooLarge = false;
+
+        Compiler(ProgramImpl& Prog, bool Backward) : Prog(Prog), Backward(Backward) { }
+
+        int emit(ProgramImpl::Op Code, int Out, int Out1 = -1, int Set = -1)
+        {
+            if (Prog.Insts.size() >= MaxInsts)
+            {
+                TooLarge = true;
+                return Out;
+            }
+            ProgramImpl::Inst I;
+            I.Code = Code;
+            I.Out = Out;
+            I.Out1 = Out1;
+            I.Set = Set;
+            Prog.Insts.push_back(I);
+            return Prog.Insts.size() - 1;
+        }
+
+        int compile(const Node& N, int Next)
+        {
+            using Op = ProgramImpl::Op;
+            if (TooLarge)
+                return Next;
+            switch (N.K)
+            {
+                case Node::Kind::empty:
+                    return Next;
+                case Node::Kind::set:
+                    return emit(Op::byte, Next, -1, N.Set);
+                case Node::Kind::begin:
+                    return emit(Backward ? Op::end : Op::begin, Next);
+                case Node::Kind::end:
+                    return emit(Backward ? Op::begin : Op::end, Next);
+                case Node::Kind::cat:
+                    if (Backward)
+                        for (auto& K : N.Kids)
+                            Next = compile(*K, Next);
+                    else
+                        for (auto K = N.Kids.rbegin(); K != N.Kids.rend(); K++)
+                            Next = compile(**K, Next);
+                    return Next;
+                case Node::Kind::alt:
+                {
+                    int Start = compile(*N.Kids.back(), Next);
+                    for (size_t i = N.Kids.size() - 1; i-- > 0;)
+                        Start = emit(Op::split, compile(*N.Kids[i], Next), Start);
+                    return Start;
+                }
+                case Node::Kind::repeat:
+                {
+                    auto& Kid = *N.Kids[0];
+                    int Start;
+                    if (N.Max < 0)
+                    {
+                        // x*: a split that loops through x back to itself
+                        int Loop = emit(Op::split, -1, Next);
+                        if (TooLarge)
+                            return Next;
+                        int Body = compile(Kid, Loop);
+                        Prog.Insts[Loop].Out = Body;
+                        Start = Loop;
+                    }
+                    else
+                    {
+                        // x{0,k} as (x(x(x)?)?)?
+                        Start = Next;
+                        for (int i = N.Min; i < N.Max; i++)
+                            Start = emit(Op::split, compile(Kid, Start), Next);
+                    }
+                    for (int i = 0; i < N.Min; i++)
+                        Start = compile(Kid, Start);
+                    return Start;
+                }
+            }
+            return Next;
+        }
+
+    private:
+        ProgramImpl& Prog;
+        bool Backward;
+    };
+
+    bool build(ProgramImpl& Prog, const Node& Root, const std::vector<ByteSet>& Sets, bool Backward)
+    {
+        using Op = ProgramImpl::Op;
+        Prog.Sets = Sets;
+        Prog.Sets.emplace_back().set();
+        Compiler C(Prog, Backward);
+        int Match = C.emit(Op::match, -1);
+        Prog.Anchored = C.compile(Root, Match);
+        // Search skips any bytes first
+        Prog.Search = C.emit(Op::split, -1, Prog.Anchored);
+        int Skip = C.emit(Op::byte, Prog.Search, -1, Prog.Sets.size() - 1);
+        if (C.TooLarge)
+            return false;
+        Prog.Insts[Prog.Search].Out = Skip;
+        Prog.make_classes();
+        return true;
+    }
+}
+
+// Split the bytes by every set in turn: two bytes stay in one class only
+// while no set holds one of them without the other
+void ProgramImpl::make_classes()
+{
+    memset(Class, 0, sizeof(Class));
+    NumClasses = 1;
+    uint8_t Next[256];
+    for (auto& S : Sets)
+    {
+        std::vector<int> Map(NumClasses * 2, -1);
+        int N = 0;
+        for (int B = 0; B < 256; B++)
+        {
+            int& C = Map[Class[B] * 2 + S[B]];
+            if (C < 0)
+                C = N++;
+            Next[B] = C;
+        }
+        memcpy(Class, Next, sizeof(Class));
+        NumClasses = N;
+    }
+}
+/* ++ Program ++ */
+
+/* -- DFA -- */
+size_t DFAImpl::SetHash::operator()(const std::vector<int>& V) const
+{
+    size_t H = V.size();
+    for (int I : V)
+        H = (H ^ (size_t)I) * 0x100000001b3ULL;
+    return H;
+}
+
+DFAImpl::DFAImpl(const ProgramImpl& Prog) : Prog(Prog), Mark(Prog.Insts.size(), 0)
+{
+    reset();
+}
+
+void DFAImpl::reset()
+{
+    Resets++;
+    States.clear();
+    Ids.clear();
+    // Dead state: no instruction left, every byte leads back to it
+    States.emplace_back();
+    Ids.emplace(std::vector<int>(), Dead);
+    Trans.assign(Prog.NumClasses, Dead);
+    Matches.assign(Prog.NumClasses, 0);
+    memset(Starts, -1, sizeof(Starts));
+}
+
+void DFAImpl::closure(const std::vector<int>& Roots, bool AtBegin, bool AtEnd, std::vector<int>& Out)
+{
+    using Op = ProgramImpl::Op;
+    if (++Generation == 0)
+    {
+        std::fill(Mark.begin(), Mark.end(), 0);
+        Generation = 1;
+    }
+    Out.clear();
+    Stack.assign(Roots.begin(), Roots.end());
+    while (!Stack.empty())
+    {
+        int I = Stack.back();
+        Stack.pop_back();
+        if (Mark[I] == Generation)
+            continue;
+        Mark[I] = Generation;
+        auto& Inst = Prog.Insts[I];
+        switch (Inst.Code)
+        {
+            case Op::byte: case Op::match:
+                Out.push_back(I);
+                break;
+            case Op::split:
+                Stack.push_back(Inst.Out1);
+                Stack.push_back(Inst.Out);
+                break;
+            case Op::begin: // never holds again once a byte is read
+                if (AtBegin)
+                    Stack.push_back(Inst.Out);
+                break;
+            case Op::end: // kept until the text is known to end
+                if (AtEnd)
+                    Stack.push_back(Inst.Out);
+                else
+                    Out.push_back(I);
+                break;
+        }
+    }
+    std::sort(Out.begin(), Out.end());
+}
+
+// A full cache is dropped, the states the caller holds are gone with it
+int DFAImpl::add(std::vector<int>& Set)
+{
+    auto It = Ids.find(Set);
+    if (It != Ids.end())
+        return It->second;
+    if (States.size() >= MaxStates)
+        reset();
+
+    State S;
+    for (int I : Set)
+        if (Prog.Insts[I].Code == ProgramImpl::Op::match)
+            S.Match = true;
+    int Row = Trans.size();
+    Ids.emplace(Set, Row);
+    S.Insts = std::move(Set);
+    Trans.resize(Row + Prog.NumClasses, -1);
+    Matches.resize(Row + Prog.NumClasses, 0);
+    Matches[Row] = S.Match;
+    States.push_back(std::move(S));
+    return Row;
+}
+
+int DFAImpl::start(bool Search, bool AtBegin)
+{
+    if (Starts[Search][AtBegin] >= 0)
+        return Starts[Search][AtBegin];
+    Roots.assign(1, Search ? Prog.Search : Prog.Anchored);
+    closure(Roots, AtBegin, false, Set);
+    int S = add(Set);
+    Starts[Search][AtBegin] = S;
+    return S;
+}
+
+int DFAImpl::step(int S, uint8_t B)
+{
+    Roots.clear();
+    for (int I : States[S / Prog.NumClasses].Insts)
+    {
+        auto& Inst = Prog.Insts[I];
+        if (Inst.Code == ProgramImpl::Op::byte && Prog.Sets[Inst.Set][B])
+            Roots.push_back(Inst.Out);
+    }
+    closure(Roots, false, false, Set);
+    auto Before = Resets;
+    int T = add(Set);
+    if (Resets == Before)
+        Trans[S + Prog.Class[B]] = Matches[T] ? -2 - T : T;
+    return T;
+}
+
+bool DFAImpl::run(int& S, const uint8_t*& P, const uint8_t* End)
+{
+    int Cur = S;
+    while (true)
+    {
+        if (Matches[Cur])
+        {
+            S = Cur;
+            return true;
+        }
+        // The table moves when a state is added, read it again after step
+        const int* T = Trans.data();
+        const uint8_t* C = Prog.Class;
+        while (P != End)
+        {
+            int Next = T[Cur + C[*P]];
+            if (Next < 0) // to a matching or an unknown state
+                break;
+            Cur = Next;
+            P++;
+        }
+        if (P == End)
+        {
+            S = Cur;
+            return false;
+        }
+        int Next = T[Cur + C[*P]];
+        Cur = Next < -1 ? -2 - Next : step(Cur, *P);
+        P++;
+    }
+}
+
+bool DFAImpl::is_match_at_end(int S)
+{
+    auto& St = States[S / Prog.NumClasses];
+    if (St.MatchAtEnd < 0)
+    {
+        bool Match = St.Match;
+        Roots.clear();
+        for (int I : St.Insts)
+            if (Prog.Insts[I].Code == ProgramImpl::Op::end)
+                Roots.push_back(I);
+        if (!Match && !Roots.empty())
+        {
+            closure(Roots, false, true, Set);
+            for (int I : Set)
+                Match = Match || Prog.Insts[I].Code == ProgramImpl::Op::match;
+        }
+        St.MatchAtEnd = Match;
+    }
+    return St.MatchAtEnd;
+}
+/* ++ DFA ++ */
+
+/* -- Matcher -- */
+std::unique_ptr<MatcherImpl> MatcherImpl::compile(const std::string& Source, const std::string& Flags, std::string& Err)
+{
+    std::unique_ptr<MatcherImpl> M(new MatcherImpl());
+    M->Source = Source;
+    M->Flags = Flags;
+    bool IgnoreCase = false;
+    for (size_t i = 0; i < Flags.size(); i++)
+    {
+        bool& F = Flags[i] == 'g' ? M->Global : IgnoreCase;
+        if ((Flags[i] != 'g' && Flags[i] != 'i') || F)
+        {
+            Err = "Invalid flags supplied to RegExp constructor '" + Flags + "'";
+            return nullptr;
+        }
+        F = true;
+    }
+
+    std::vector<ByteSet> Sets;
+    PatternParser Parser(Source, IgnoreCase, Sets);
+    NodePtr Root;
+    if (!Parser.parse(Root))
+    {
+        Err = "Invalid regular expression: /" + Source + "/: " + Parser.Err;
+        return nullptr;
+    }
+    if (!build(M->Forward, *Root, Sets, false) || !build(M->Backward, *Root, Sets, true))
+    {
+        Err = "Invalid regular expression: /" + Source + "/: pattern is too large";
+        return nullptr;
+    }
+    M->ForwardDFA.reset(new DFAImpl(M->Forward));
+    M->BackwardDFA.reset(new DFAImpl(M->Backward));
+    return M;
+}
+
+bool MatcherImpl::test(std::string_view Text)
+{
+    auto& D = *ForwardDFA;
+    int S = D.start(true, true);
+    auto P = reinterpret_cast<const uint8_t*>(Text.data());
+    return D.run(S, P, P + Text.size()) || D.is_match_at_end(S);
+}
+
+// End of the longest match from Begin, where a match is known to start
+size_t MatcherImpl::longest(std::string_view Text, size_t Begin)
+{
+    auto& D = *ForwardDFA;
+    int S = D.start(false, Begin == 0);
+    size_t Last = Begin;
+    for (size_t i = Begin; ; i++)
+    {
+        if (D.is_match(S))
+            Last = i;
+        if (i == Text.size())
+        {
+            if (D.is_match_at_end(S))
+                Last = i;
+            break;
+        }
+        S = D.next(S, Text[i]);
+        if (S == DFAImpl::Dead)
+            break;
+    }
+    return Last;
+}
+
+void MatcherImpl::find(std::string_view Text, size_t Limit, std::vector<std::pair<size_t, size_t>>& Out)
+{
+    Out.clear();
+    if (!Limit || !test(Text)) // most texts do not match, one forward scan tells
+        return;
+
+    // Starts[i] is 1 when a match begins at i: the backward program,
+    // read from the end, is in a match state right after Text[i]
+    size_t N = Text.size();
+    Starts.assign(N + 1, 0);
+    auto& D = *BackwardDFA;
+    int S = D.start(true, true);
+    for (size_t i = N; i > 0; i--)
+    {
+        if (D.is_match(S))
+            Starts[i] = 1;
+        S = D.next(S, Text[i - 1]);
+    }
+    Starts[0] = D.is_match_at_end(S);
+
+    size_t Pos = 0;
+    while (Pos <= N && Out.size() < Limit)
+    {
+        auto Hit = static_cast<const uint8_t*>(memchr(Starts.data() + Pos, 1, N + 1 - Pos));
+        if (!Hit)
+            break;
+        size_t Begin = Hit - Starts.data();
+        size_t End = longest(Text, Begin);
+        Out.emplace_back(Begin, End);
+        Pos = End > Begin ? End : End + 1;
+    }
+}
+/* ++ Matcher ++ */
@@ -0,0 +1,148 @@
+#ifndef TINYJS_REGEX
+#define TINYJS_REGEX
+
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Regular expressions (/pattern/flags, RegExp, test, match, replace).
+//
+// A pattern is parsed once and compiled to two byte NFAs, one reading
+// forward and one reading the pattern backward. Neither is run directly:
+// a DFA is built from it lazily, a state (a set of NFA states) and its
+// transitions are made the first time a scan reaches them and then kept.
+// Every byte costs one table load however the pattern is written, there
+// is no backtracking, a match is linear in the text.
+//
+// A match is the leftmost one, and of those the longest: a backward scan
+// marks where a match can begin, a forward scan from the first mark finds
+// where the longest one ends. Groups only group, there are no captures,
+// no back references and no lookaround, those need more than a DFA.
+// Lazy quantifiers are refused rather than matched greedily.
+//
+// Flags: g (every match), i (ASCII case insensitive). Text is bytes, `.`
+// is any byte but "\n" and "\r".
+
+namespace Regex
+{
+    using ByteSet = std::bitset<256>;
+
+    // Byte NFA, the states are the instructions
+    struct ProgramImpl
+    {
+        enum class Op : uint8_t { byte, split, begin, end, match };
+        struct Inst
+        {
+            Op Code;
+            int Out = -1, Out1 = -1; // split follows both
+            int Set = -1; // byte: index into Sets
+        };
+
+        std::vector<Inst> Insts;
+        std::vector<ByteSet> Sets;
+        int Anchored = -1; // the pattern at the first byte
+        int Search = -1;   // the pattern after any bytes
+
+        // Bytes no instruction tells apart share a class, a DFA state has
+        // one transition per class
+        uint8_t Class[256];
+        int NumClasses = 0;
+        void make_classes();
+    };
+
+    class DFAImpl
+    {
+    public:
+        static constexpr int Dead = 0;
+        // Past this many states the cache is dropped and built again
+        static constexpr size_t MaxStates = 4096;
+
+        explicit DFAImpl(const ProgramImpl& Prog);
+
+        DFAImpl(const DFAImpl&) = delete;
+        const DFAImpl& operator =(const DFAImpl&) = delete;
+
+        // A state is named by the offset of its row in the transition
+        // table, a transition is then one load.
+        // Search starts in a state that may still skip bytes.
+        // AtBegin is true where `^` holds (the first byte of the text).
+        int start(bool Search, bool AtBegin);
+        int next(int S, uint8_t B)
+        {
+            int T = Trans[S + Prog.Class[B]];
+            return T >= 0 ? T : T < -1 ? -2 - T : step(S, B);
+        }
+        bool is_match(int S) const { return Matches[S]; }
+        // Read from P while no state matches. True with S the matching
+        // state and P where it holds, false with P at End.
+        bool run(int& S, const uint8_t*& P, const uint8_t* End);
+        // The text ends here, `$` holds
+        bool is_match_at_end(int S);
+
+    private:
+        struct State
+        {
+            std::vector<int> Insts; // byte, end and match instructions, sorted
+            bool Match = false;
+            int8_t MatchAtEnd = -1; // unknown until asked
+        };
+        struct SetHash
+        {
+            size_t operator()(const std::vector<int>& V) const;
+        };
+
+        const ProgramImpl& Prog;
+        std::vector<State> States;
+        std::unordered_map<std::vector<int>, int, SetHash> Ids;
+        // States * NumClasses: the row of the next state, -2 - row when it
+        // matches (the scan loop then stops on one sign test), -1 unknown
+        std::vector<int> Trans;
+        std::vector<uint8_t> Matches; // State::Match at the row of the state, for the scan loop
+        int Starts[2][2];
+        size_t Resets = 0;
+
+        // Closure scratch, Mark[i] == Generation when i is in the set
+        std::vector<unsigned> Mark;
+        unsigned Generation = 0;
+        std::vector<int> Stack, Roots, Set;
+
+        int step(int S, uint8_t B);
+        int add(std::vector<int>& Set);
+        void reset();
+        void closure(const std::vector<int>& Roots, bool AtBegin, bool AtEnd, std::vector<int>& Out);
+    };
+
+    class MatcherImpl
+    {
+    public:
+        std::string Source, Flags;
+        bool Global = false;
+
+        // nullptr and Err set when Source or Flags are not valid
+        static std::unique_ptr<MatcherImpl> compile(const std::string& Source, const std::string& Flags, std::string& Err);
+
+        MatcherImpl(const MatcherImpl&) = delete;
+        const MatcherImpl& operator =(const MatcherImpl&) = delete;
+
+        // Some match anywhere in Text, stops at the first byte that ends one
+        bool test(std::string_view Text);
+        // Up to Limit matches as [begin, end) pairs, left to right, none
+        // overlapping. An empty match moves the next search one byte on.
+        void find(std::string_view Text, size_t Limit, std::vector<std::pair<size_t, size_t>>& Out);
+
+    private:
+        ProgramImpl Forward, Backward;
+        std::unique_ptr<DFAImpl> ForwardDFA, BackwardDFA;
+        std::vector<uint8_t> Starts; // scratch of find
+
+        MatcherImpl() = default;
+        size_t longest(std::string_view Text, size_t Begin);
+    };
+}
+
+#endif
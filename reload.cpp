@@ -0,0 +1,253 @@
+#include "reload.h"
+#include "eval.h"
+#include "parser.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <unordered_map>
+using namespace Eval;
+
+/* -- Split -- */
+std::vector<Reload::Piece> Reload::split(const std::string& Text)
+{
+    std::vector<Piece> Pieces;
+    size_t Cursor = 0;             // end of the last piece
+    unsigned long long Line = 1;   // at Cursor
+    auto add = [&](const std::string& Name, size_t End) {
+        Pieces.push_back({ Name, Text.substr(Cursor, End - Cursor), Line });
+        Line += std::count(Text.begin() + Cursor, Text.begin() + End, '\n');
+        Cursor = End;
+    };
+
+    std::stringbuf Buf(Text);
+    Lexer::LexerImpl L(&Buf);
+    auto& Tok = L.CurToken;
+    // The lexer has read one character past the token, unless the text ended
+    auto token_end = [&]() -> size_t {
+        return std::cin.eof() ? Text.size() : (size_t)Buf.pubseekoff(0, std::ios::cur, std::ios::in) - 1;
+    };
+    auto is_char = [&](const char* Chars) {
+        return Tok.tk_type == Lexer::Type::tok_single_char && strchr(Chars, Tok.tk_string[0]);
+    };
+
+    // A declaration is 'async'? 'function' name at depth 0, where the last
+    // token can end a statement (an operator before it makes an expression)
+    enum class Stage { code, async, function, body } At = Stage::code;
+    int Depth = 0;
+    bool StatementEnd = true;
+    bool Code = false; // a token since Cursor that is not part of a declaration
+    size_t Start = 0;
+    std::string Name;
+    // Right at the end of the text the lexer keeps returning the last
+    // character, the token read when the end is reached is the last one
+    bool Ended = false;
+    for (L.get_next_token(); Tok.tk_type != Lexer::Type::tok_eof && !Ended; L.get_next_token())
+    {
+        Ended = std::cin.eof();
+        size_t End = token_end();
+        switch (At)
+        {
+            case Stage::code:
+                if (Depth == 0 && StatementEnd && (Tok.tk_type == Lexer::Type::tok_async || Tok.tk_type == Lexer::Type::tok_function))
+                {
+                    Start = End - Tok.tk_string.size();
+                    At = Tok.tk_type == Lexer::Type::tok_async ? Stage::async : Stage::function;
+                    continue;
+                }
+                break;
+            case Stage::async:
+                if (Tok.tk_type == Lexer::Type::tok_function)
+                {
+                    At = Stage::function;
+                    continue;
+                }
+                At = Stage::code;
+                break;
+            case Stage::function:
+                if (Tok.tk_type == Lexer::Type::tok_identifier)
+                {
+                    Name = Tok.tk_string;
+                    At = Stage::body;
+                    continue;
+                }
+                At = Stage::code;
+                break;
+            case Stage::body:
+                if (is_char("{(["))
+                    Depth++;
+                else if (is_char("})]") && --Depth == 0 && Tok.tk_string == "}")
+                {
+                    if (Code)
+                        add("", Start);
+                    add(Name, End);
+                    At = Stage::code;
+                    StatementEnd = true;
+                    Code = false;
+                }
+                continue;
+        }
+
+        Code = true;
+        if (is_char("{(["))
+            Depth++;
+        else if (is_char("})]"))
+            Depth--;
+        switch (Tok.tk_type)
+        {
+            case Lexer::Type::tok_identifier:
+                StatementEnd = Tok.tk_string != "else";
+                break;
+            case Lexer::Type::tok_integer: case Lexer::Type::tok_float: case Lexer::Type::tok_string:
+            case Lexer::Type::tok_regex: case Lexer::Type::tok_null:
+                StatementEnd = true;
+                break;
+            default:
+                StatementEnd = is_char(";}]");
+                break;
+        }
+    }
+    if (Cursor < Text.size())
+        add("", Text.size());
+    return Pieces;
+}
+/* ++ Split ++ */
+
+/* -- Watch -- */
+bool Reload::WatchImpl::changed()
+{
+    struct stat St;
+    if (stat(Path.c_str(), &St) != 0) // being replaced
+        return false;
+    bool Changed = Size >= 0 && (St.st_size != Size || St.st_mtim.tv_sec != MTime.tv_sec || St.st_mtim.tv_nsec != MTime.tv_nsec);
+    MTime = St.st_mtim;
+    Size = St.st_size;
+    return Changed;
+}
+
+static bool read_text(const std::string& Path, std::string& Text)
+{
+    std::ifstream In(Path, std::ios::binary);
+    if (!In)
+        return false;
+    Text.assign(std::istreambuf_iterator<char>(In), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// Check Path every IntervalMs on the event loop, reload it when it changes.
+// Only what is still pending can call a reloaded function: the watch does
+// not hold the loop open by itself.
+void EvalImpl::watch(const std::string& Path, double IntervalMs)
+{
+    Watch.reset(new Reload::WatchImpl(Path, IntervalMs > 0 ? IntervalMs : 200));
+    std::string Text;
+    if (read_text(Path, Text))
+        Watch->Pieces = Reload::split(Text);
+    Watch->changed();
+    Loop::loop().add_timer(Watch->IntervalMs, Watch->IntervalMs, [this] {
+        if (Watch->changed())
+            reload();
+    }, false);
+}
+
+void EvalImpl::reload()
+{
+    auto Begin = std::chrono::steady_clock::now();
+    std::string Text;
+    if (!read_text(Watch->Path, Text))
+        return;
+    auto Pieces = Reload::split(Text);
+
+    std::unordered_map<std::string, const std::string*> Old;
+    std::string OldCode, NewCode; // between the declarations, blanks left out
+    auto code = [](std::string& Out, const std::string& In) {
+        std::copy_if(In.begin(), In.end(), std::back_inserter(Out), [](char c) { return !isspace((unsigned char)c); });
+    };
+    for (auto& P : Watch->Pieces)
+    {
+        if (P.Name.empty())
+            code(OldCode, P.Text);
+        else
+            Old[P.Name] = &P.Text;
+    }
+
+    // Parse what changed, alone. A piece that does not parse to a single
+    // function leaves the old definition in place, its old text is kept so
+    // it is parsed again on the next change.
+    std::vector<std::shared_ptr<FunctionAST>> Changed;
+    size_t Failed = 0;
+    for (auto& P : Pieces)
+    {
+        if (P.Name.empty())
+        {
+            code(NewCode, P.Text);
+            continue;
+        }
+        auto It = Old.find(P.Name);
+        if (It != Old.end() && *It->second == P.Text)
+            continue;
+        std::stringbuf Buf(P.Text);
+        Parser::ParserImpl Parser(&Buf);
+        Parser.FileName = Watch->Path;
+        Parser.LineNumber = P.Line;
+        Parser.Recover = true;
+        std::string Err;
+        try
+        {
+            auto Statements = Parser.parser();
+            if (Statements.size() == 1 && isFunction(Statements[0]) && get_name(Statements[0]) == P.Name)
+            {
+                Changed.push_back(ptr_to<FunctionAST>(Statements[0]));
+                continue;
+            }
+            Err = "not a single function declaration";
+        }
+        catch (const Parser::ParseError& E)
+        {
+            Err = E.what();
+        }
+        Output::out().flush();
+        fprintf(stderr, "[reload] %s: %s: %s, %s\n", Watch->Path.c_str(), P.Name.c_str(), Err.c_str(),
+                It != Old.end() ? "the old definition stays" : "not defined");
+        P.Text = It != Old.end() ? *It->second : "";
+        Failed++;
+    }
+
+    // The new function takes the place of the old one in the program, the
+    // calls of every function are bound again: a new one may shadow a built in
+    for (auto& F : Changed)
+    {
+        auto It = std::find_if(Expression.begin(), Expression.end(), [&](const std::shared_ptr<ExprAST>& E) {
+            return isFunction(E) && get_name(E) == F->Proto->Name;
+        });
+        if (It != Expression.end())
+            *It = F;
+        else
+            Expression.push_back(F);
+    }
+    resolve_built_in(Expression);
+
+    auto SavedScope = CurScope;
+    CurScope = Scope;
+    for (auto& F : Changed)
+        eval_function_expr(F);
+    CurScope = SavedScope;
+    Watch->Pieces = std::move(Pieces);
+
+    double Ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Begin).count();
+    std::string Names;
+    for (auto& F : Changed)
+        Names += (Names.empty() ? "" : ", ") + F->Proto->Name;
+    Output::out().flush(); // keep the order of output and reports
+    fprintf(stderr, "[reload] %s: %zu function(s) reloaded%s%s%s", Watch->Path.c_str(), Changed.size(),
+            Names.empty() ? "" : " (", Names.c_str(), Names.empty() ? "" : ")");
+    if (Failed)
+        fprintf(stderr, ", %zu failed", Failed);
+    fprintf(stderr, " in %.3f ms\n", Ms);
+    if (OldCode != NewCode)
+        fprintf(stderr, "[reload] %s: code outside the functions changed, it does not run again\n", Watch->Path.c_str());
+}
+/* ++ Watch ++ */
@@ -0,0 +1,54 @@
+#ifndef TINYJS_RELOAD
+#define TINYJS_RELOAD
+
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+// Hot reload of the script (TINYJS_WATCH=<ms>).
+//
+// The file is checked every <ms> milliseconds (200 if not given) and the
+// process keeps running meanwhile. A new version is compared with the one
+// running at top level declaration granularity: the text is split, with
+// the lexer only, into function declarations and the code between them.
+// A declaration whose text changed, or a new one, is parsed alone and
+// bound in the global scope, in place of the function of that name. The
+// rest is not parsed and nothing runs again: globals keep their values,
+// timers keep running.
+//
+// Changed code between declarations is reported and left as it ran. A
+// removed function stays bound. Values made from an old function (a
+// closure held in a variable, a memoized copy) keep the old code.
+
+namespace Reload
+{
+    // A function declaration (Name) or the code between two (no Name)
+    struct Piece
+    {
+        std::string Name;
+        std::string Text;
+        unsigned long long Line; // of the first byte of Text
+    };
+
+    // Pieces of Text, in order, their texts add up to Text
+    std::vector<Piece> split(const std::string& Text);
+
+    class WatchImpl
+    {
+    public:
+        std::string Path;
+        double IntervalMs;
+        std::vector<Piece> Pieces; // of the version running now
+
+        WatchImpl(const std::string& Path, double IntervalMs) : Path(Path), IntervalMs(IntervalMs) { }
+
+        // The file was written since the last call (the first one only records it)
+        bool changed();
+
+    private:
+        struct timespec MTime = {};
+        off_t Size = -1;
+    };
+}
+
+#endif
@@ -0,0 +1,44 @@
+// Arrays: literals, push/pop, growth, packed kinds, for-of
+let a = [1, 2, 3];
+print(a);
+print(a.length);
+a.push(4, 5);
+print(a[4]);
+let s = 0;
+for (let x of a) { s = s + x; }
+print(s);
+a[1] = 2.5;
+print(a);
+let b = [1.5, 2.5];
+b.push(3.5);
+print(b);
+let c = [];
+c.push("x");
+print(c);
+print(c.pop());
+print(c.length);
+let m = [[1,2],[3,4]];
+print(m[1][0]);
+function f(arr, n) { for (let i = 0; i < arr.length; i = i + 1) { if (arr[i] == n) return i; } return -1; }
+print(f([5,6,7], 7));
+print(f([5,6,7], 9));
+function g() { for (let y of [1,2,3]) { if (y == 2) { let z = y * 10; return z; } } }
+print(g());
+let q = [1, 2];
+q[q.length] = 3;
+print(q);
+print("abc"[1]);
+print("abc".length);
+for (x of [7, 8]) print(x);
+let mixed = [1, 2.5, "s", [1]];
+print(mixed);
+mixed[0] = "t";
+print(mixed.length, mixed[0]);
+let grow = [];
+for (let i = 0; i < 1000; i = i + 1) { grow.push(i * 2); }
+print(grow.length, grow[999]);
+// Deep recursion stops with an error instead of overflowing the stack
+function rec(n) { if (n == 0) return 0; return rec(n - 1) + 1; }
+print(rec(500));
+print(rec(10000000));
+print("not reached");
@@ -0,0 +1,34 @@
+// Event loop: timers, promises, async functions and await
+print("start");
+setTimeout(function (x) { print("timeout " + x); }, 250, "a");
+let n = 0;
+let id = setInterval(function () { n = n + 1; print("tick " + n); if (n == 3) clearInterval(id); }, 50);
+async function work(name, ms) {
+    print(name + " begin");
+    let v = await sleep(ms);
+    print(name + " after " + v);
+    return name + "!";
+}
+let p = work("w1", 125);
+let q = work("w2", 25);
+print(p);
+q.then(function (r) { print("then " + r); return 7; }).then(function (x) { print(x * 2); });
+async function outer() {
+    let a = await work("inner", 1);
+    let b = await 5;
+    return a + b;
+}
+outer().then(function (r) { print("outer " + r); });
+let r = await p;
+print("top-level " + r);
+print(p);
+function fib(n) { if (n < 2) return n; return fib(n - 1) + fib(n - 2); }
+async function deep(n) { await sleep(1); return fib(n); }
+print(await deep(15));
+// Many pending calls, each on its own fiber
+let k = 0;
+async function wait(i) { await sleep(5); k = k + 1; }
+for (let i = 0; i < 500; i = i + 1) { wait(i); }
+await sleep(60);
+print("waited " + k);
+print("end");
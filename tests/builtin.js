@@ -0,0 +1,10 @@
+// Built in calls: a script function of the same name takes over
+print(max(Int32Array([3, 9, 2])));
+print(sum(Float64Array([1.5, 2.5])));
+print(text(Uint8Array([104, 105])));
+function max(a) { return 99; }
+print(max(1));
+print(max(Int32Array([3, 9, 2])));
+function twice(f, x) { return f(f(x)); }
+function inc(x) { return x + 1; }
+print(twice(inc, 5));
@@ -0,0 +1,39 @@
+// Call sites: a cached callee is dropped when the name is bound to another
+// function, default and repeated parameters, one site calling many functions
+function f(x) { return x + 1; }
+function g(y) { return f(y) * 2; }
+print(g(1));
+function f(x) { return x + 100; }
+print(g(1));
+function h(a, b = 5, c = a + 2) { return a + b + c; }
+print(h(1));
+print(h(1, 2));
+print(h(1, 2, 3));
+function dup(a, a) { return a; }
+print(dup(1, 2));
+function mk(n) { let k = n; function inner(z) { return z + k; } return inner; }
+let q = mk(10);
+print(q(5));
+function outer(f) { return f(3); }
+print(outer(q));
+function rec(n) { if (n < 2) { return n; } return rec(n - 1) + rec(n - 2); }
+print(rec(15));
+let i = 0;
+while (i < 3) { function w(x) { return x * i; } print(w(2)); i = i + 1; }
+function s(p) { p = p + 1; let t = p * 2; return t; }
+print(s(4));
+function cnt() { let a = [1, 2, 3]; let t = 0; for (let e of a) { t = t + e; } return t; }
+print(cnt());
+print(cnt());
+let fs = [function (x) { return x + 1; }, function (x) { return x * 10; }, rec];
+let t = 0;
+for (let j = 0; j < 9; j = j + 1) { t = t + fs[j % 3](j); }
+print(t);
+let op = f;
+print(op(1));
+op = g;
+print(op(1));
+function len(a) { return 99; }
+print(len([1, 2]));
+function use() { return undefinedFunction(1); }
+use();
@@ -0,0 +1,77 @@
+// Closures: upvalue capture, shared cells, local functions
+function counter(start)
+{
+    let n = start;
+    return function () { n = n + 1; return n; };
+}
+let c1 = counter(10);
+let c2 = counter(100);
+print(c1());
+print(c1());
+print(c2());
+print(c1);
+
+function adder(k) { return function (x) { return x + k; }; }
+let add5 = adder(5);
+print(add5(1));
+print(adder(2)(3));
+print((function (x) { return x * x; })(7));
+
+function apply(f, v) { return f(v); }
+print(apply(add5, 10));
+
+let fs = [];
+for (let i = 0; i < 3; i = i + 1)
+{
+    let j = i;
+    fs.push(function () { return j; });
+}
+print(fs[0]() + "," + fs[1]() + "," + fs[2]());
+
+function outer()
+{
+    function fact(n) { if (n <= 1) return 1; return n * fact(n - 1); }
+    return fact;
+}
+print(outer()(10));
+
+function mk()
+{
+    let x = 1;
+    let get = function () { return x; };
+    let set = function (v) { x = v; };
+    return [get, set];
+}
+let p = mk();
+p[1](42);
+print(p[0]());
+
+let big = 0;
+function dyn() { return big; }
+function caller() { let big = 5; return dyn(); }
+print(caller());
+
+let t = Float64Array([1, 2, 3]);
+let s = 2;
+print(map(t, function (x) { return x * s; }));
+print(map(t, function (x) { return x * 3; }));
+// Local functions may call siblings declared after them
+function siblings(){ function a(n){ if(n==0) return 0; return b(n-1);} function b(n){return a(n);} return a(3);}
+print(siblings());
+function even(n) { function ev(k) { if (k == 0) return 1; return od(k - 1); } function od(k) { if (k == 0) return 0; return ev(k - 1); } return ev(n) * 10 + od(n); }
+print(even(7)); print(even(10));
+function cap() { let x = 1; function f() { return x + g(); } function g() { return x * 10; } x = 2; return f(); }
+print(cap());
+function shadowp(f) { let r = f; function f() { return 5; } return f(); }
+print(shadowp(3));
+function tally() { let n = 0; function inc() { n = n + 1; return get(); } function get() { return n; } inc(); inc(); return inc(); }
+print(tally());
+// A named function value sees its own name, only inside itself
+let fact = function f(n) { if (n < 2) { return 1; } return n * f(n - 1); };
+print(fact(5));
+let f = 7;
+let fib = function f(n) { if (n < 2) { return n; } return f(n - 1) + f(n - 2); };
+print(fib(15)); print(f);
+let hid = function g(g) { return g * 2; };
+print(hid(21));
+print(apply(function sq(x) { if (x > 3) { return sq(x - 1); } return x * x; }, 5));
@@ -0,0 +1,46 @@
+// Compiled closures: operators, assignments, loops and calls run as pre-bound
+// closures give what the tree walker gives, the error included
+let a = 3;
+let b = 4.5;
+let s = "ab";
+print(a + b * 2 - a % 2);
+print(-a + +b - - - a);
+print(!a); print(~a);
+print(s + a + b);
+c = 0, b;
+print(c);
+x = 5;
+var y = x << 2 >> 1;
+print(y);
+print(a < b && b > a || 0);
+print(a == 3); print(a <= 3); print(a >= 4);
+let arr = [1, 2, 3];
+arr[1] = a * 10;
+print(arr[1] + arr[0]);
+function f(n) { return n * n + a; }
+print(f(a) + f(2) * -f(1));
+let i = 0;
+let t = 0;
+while (i < 10) { t = t + i * (i - 1) / 2; i = i + 1; }
+print(t);
+let o = {k: 1};
+o.k = o.k + 41;
+print(o.k);
+print(1 - (2 - (3 - (4 - 5))));
+function id(v) { return v; }
+print(id(0) && id(1));
+print(id(2) || id(3));
+print(a != 3); print(s != "ab"); print(s != "ba");
+let sum = 0;
+for (let k = 0; k < 20; k = k + 1) { if (k % 2) { continue; } if (k > 12) { break; } sum = sum + k; }
+print(sum);
+let n = 0;
+do { n = n + 3; } while (n < 10);
+print(n);
+let total = 0;
+for (let e of [4, 5, 6]) { total = total + e; }
+print(total);
+let nested = [[1, 2], [3, [4, 5]]];
+nested[1][1][0] = nested[0][1] * 100;
+print(nested);
+print(zz + 1);
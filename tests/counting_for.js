@@ -0,0 +1,39 @@
+// Counting for loops, on a native counter when the loop allows it
+let s = 0;
+for (let i = 0; i < 10; i = i + 1) { if (i == 3) { continue; } s = s + i; }
+print(s);
+let arr = [];
+for (let i = 10; i > 0; i = i - 3) { arr.push(i); let k = i; arr.push(k); }
+print(arr);
+let n = 5;
+let c = 0;
+for (let i = 0; i < n; i = 1 + i) { n = n - 1; c = c + 1; }
+print(c);
+function f() { for (let i = 0; i <= 100; i = i + 1) { if (i * i > 50) return i; } return -1; }
+print(f());
+for (let i = 0; i < 2.5; i = i + 1) { print(i); }
+let fs = [];
+for (let i = 0; i < 3; i = i + 1) { fs.push(function () { return i; }); }
+print(fs[0]());
+t = 0;
+for (let i = 0; i < 1000; i = i + 1) { for (let j = 0; j < 1000; j = j + 1) { t = t + 1; } }
+print(t);
+let a = [1,2,3,4];
+let z = 0;
+for (let i = 0; i != a.length; i = i + 1) { z = z + a[i]; if (i == 2) break; }
+print(z);
+t = 0;
+for (let i = 0; i < 1000; i = i + 1) { for (let j = 0; j < 1000; j = j + 1) { t = t + j; } }
+print(t);
+let jj = 0;
+while (jj != 3) { jj = jj + 1; }
+print(jj);
+s = 0;
+for (let i = 0; i != 10; i = i + 1) { s = s + i; }
+print(s);
+t = 0;
+for (let i = 0; i != 10; i = i + 2) { if (i != 4) { t = t + i; } }
+print(t);
+function ne(a, b) { return a != b; }
+print(ne(1, 2)); print(ne(2, 2)); print(ne(2.0, 2)); print(ne("a", "b")); print(ne("a", "a"));
+let one = [1]; print(one != one); print(one != [1]);
@@ -0,0 +1,25 @@
+// Streaming files: write, append, read by line, for-of over lines, readFile
+let out = open("lines.txt", "w");
+print(out);
+write(out, "alpha\n", "beta ", 2, " ", 1.5, "\n");
+write(out, "\n", "last line without newline");
+close(out);
+let f = open("lines.txt");
+while (!eof(f)) { let l = readLine(f); print("[" + l + "]"); }
+print(readLine(f));
+close(f);
+print(f);
+let keep = [];
+for (let line of open("lines.txt")) { keep.push(line.length); }
+print(keep);
+let g = open("lines.txt", "a");
+write(g, "\ntail\n");
+close(g);
+let found = "";
+for (let line of open("lines.txt")) { if (line == "tail") { found = line; break; } }
+print(found);
+function first(p) { for (let l of open(p)) { return l; } }
+print(first("lines.txt"));
+let whole = await readFile("lines.txt");
+print(whole.length);
+await readFile("no/such/file");
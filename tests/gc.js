@@ -0,0 +1,32 @@
+// Cycle collector: cycles made in a loop are freed, a live cycle stays
+var i = 0;
+while (i < 200000) {
+    let a = [1, 2];
+    let b = [a];
+    a.push(b);
+    a.push(a);
+    i = i + 1;
+}
+var keep = [1];
+keep.push(keep);
+print(gc());
+print(gc());
+print(keep.length, keep[1][1][0]);
+let s = gcStats();
+print(match(s, /live: [^,]*/), match(s, /freed: [^,]*/));
+// Closures that capture each other form cycles too
+function pair() {
+    let f = 0;
+    let g = 0;
+    f = function () { return g; };
+    g = function () { return f; };
+    return 1;
+}
+let n = 0;
+for (let j = 0; j < 50; j = j + 1) { n = n + pair(); }
+print(n);
+print(gc());
+// Long lived numbers keep their nursery chunk, reported as pinned
+let held = 0;
+for (let k = 0; k < 20000; k = k + 1) { let t = k * 1.5; if (k == 4000) { held = t; } }
+print(held, match(gcStats(), /pinned: [0-9]+ chunks/) != "pinned: 0 chunks");
@@ -0,0 +1,54 @@
+// Inlining: small functions inlined at hot call sites give the same results,
+// through a redefinition, a changed global, async callers and errors
+function sq(x) { return x * x; }
+function sgn(x) { if (x < 0) { return -1; } else if (x == 0) { return 0; } return 1; }
+function cls(x) { if (x < 10) { return "small"; } else { return "big"; } }
+function pick(a, b, a) { return a - b; }
+function h(s) { return s + "!"; }
+function both(x) { return sq(x) + sgn(x); }
+function nth(a, i) { return a[i]; }
+function noret(x) { if (x < 0) { return 1; } }
+function dflt(a, b = 7) { return a + b; }
+let g = 3;
+function useg(x) { return x + g; }
+let arr = [5, 6, 7];
+let i = 0;
+let t = 0;
+while (i < 40) {
+  t = t + sq(i) + sgn(i - 20) + pick(i, 1, 2) + both(i) + nth(arr, i % 3) + useg(i) + dflt(i) + dflt(i, 1);
+  if (i == 30) { g = 100; }
+  if (i == 35) { print(cls(i)); print(cls(i - 30)); print(h("x")); print(noret(-1)); }
+  i = i + 1;
+}
+print(t);
+function sq(x) { return x + 1000; }
+i = 0;
+while (i < 20) { t = t + sq(i); i = i + 1; }
+print(t);
+let s = 0.5;
+i = 0;
+while (i < 20) { s = s + sq(s); i = i + 1; }
+print(s);
+function at(b, i)
+{
+    if (i < 0) { return 0; }
+    return b[i];
+}
+let b = [1, 2, 3];
+i = 0;
+t = 0;
+while (i < 40) { t = t + at(b, i % 3); i = i + 1; }
+print(t);
+function half(x) { return x / 2; }
+i = 0;
+while (i < 30) { half(i); i = i + 1; }
+print(half(9));
+print(half(9.0));
+function first(a) { return a[0]; }
+i = 0;
+while (i < 30) { first([i]); i = i + 1; }
+print(first([i]));
+async function w(x) { let v = await x; return at(b, v); }
+i = 0;
+while (i < 20) { w(1); i = i + 1; }
+print(at(b, 7));
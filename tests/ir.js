@@ -0,0 +1,36 @@
+// SSA IR: loops with swaps, rotations, nested breaks, constants to fold and
+// mixed int and float arithmetic give what the tree walker gives
+function swap(n) { let a = 1; let b = 2; for (let i = 0; i < n; i = i + 1) { let t = a; a = b; b = t + a; } return a * 1000 + b; }
+function rot(n) { let a = 1; let b = 2; let c = 3; let i = 0; while (i < n) { let t = a; a = b; b = c; c = t; i = i + 1; } return a * 100 + b * 10 + c; }
+function nest(n) { let s = 0; for (let i = 0; i < n; i = i + 1) { for (let j = 0; j < n; j = j + 1) { if (j > i) { break; } s = s + i * n + j * 3 + n * n; } } return s; }
+function dw(n) { let i = 0; let s = 0; do { i = i + 1; if (i % 2 == 0) { continue; } s = s + i; } while (i < n); return s; }
+function dw0(n) { let i = 0; do { i = i + 1; return i * n; } while (i < n); return 0; }
+function divloop(n, d) { let s = 0; let i = 0; while (i < n) { s = s + 100 / d; i = i + 1; } return s; }
+function cst(n) { let x = 3; if (x > 2) { x = x * 2; } else { x = n; } let y = 0; while (y < x) { y = y + 1; } return y + x; }
+function cst2(n) { let x = 1; let i = 0; while (i < n) { if (x == 1) { x = 1; } else { x = 2; } i = i + 1; } return x; }
+function fl(x, y) { let s = 0.0; let i = 0; while (i < 10) { s = s + x / y + x % 3.5 + (x > y) + (x == y); i = i + 1; } return s; }
+function sh(a, b) { return (a << b) + (a >> b) + (1 << 62) + (5 % 3) + (-7 / 2) + (-7 % 3); }
+function early(n) { for (let i = 0; i < n; i = i + 1) { if (i * i > n) { return i; } } return -1; }
+function mixed(n) { let s = 0; let i = 0; while (i < n) { s = s + (i & 3) * (n | 1) ^ (n & 5); i = i + 1; } return s; }
+function trunc(x) { let s = 0; let i = 0; while (i < 4) { s = s + (x | 0) + ~x; i = i + 1; } return s; }
+function logicl(a, b) { let s = 0; let i = 0; while (i < 3) { s = s + (a && b) + (a || b) + (a && i) + (i || b); i = i + 1; } return s; }
+print(swap(10));
+print(rot(7));
+print(nest(30));
+print(dw(9));
+print(dw0(5));
+print(divloop(10, 7));
+print(divloop(0, 0));
+print(cst(4));
+print(cst2(5));
+print(fl(7.5, 2.0));
+print(fl(2, 2));
+print(sh(100, 3));
+print(early(50));
+print(early(0));
+print(mixed(33));
+print(trunc(5.7));
+print(logicl(2, 0));
+print(logicl(0, 3));
+print(divloop(3, 0.0));
+print(divloop(3, 0));
@@ -0,0 +1,28 @@
+// JSON.parse / JSON.stringify / JSON.read
+let o = JSON.parse("{\"a\": 1, \"b\": [1, 2.5, \"x\"], \"c\": {\"d\": null, \"e\": true, \"f\": false}, \"s\": \"q\\\"\\n\\u00e9\\ud83d\\ude00\"}");
+print(o);
+print(o.a, o.b, o.c.d, o.c.e, o.s, o.missing);
+print(JSON.stringify(o));
+print(JSON.stringify(o, null, 2));
+let p = {name: "x", n: 3, list: [1, 2], nested: {k: "v"}};
+p.extra = 5;
+p["more"] = [];
+print(p, keys(p));
+print(JSON.stringify(p));
+print(JSON.stringify([1.5, 0.1, 1234567890, -0.0, 100.0]));
+print(JSON.parse("12345678901234567890"), JSON.parse("-5"), JSON.parse("1e2"), JSON.parse(" [ ] "), JSON.parse("{}"));
+print(JSON.stringify(Int32Array([1,2,3])), JSON.stringify("\t"));
+if (o.c.d == null) { print("null ok"); }
+if (o.missing) { print("bad"); } else { print("missing falsy"); }
+let a = [1];
+a.push(a);
+print(a);
+let big = [];
+for (let i = 0; i < 200; i = i + 1) { big.push({id: i, name: "item \"" + i + "\"", tags: ["a", "b"], score: i / 4}); }
+let f = open("data.json", "w");
+write(f, JSON.stringify(big));
+close(f);
+let back = JSON.read(open("data.json"));
+print(back.length, back[199].name, back[3].score, JSON.stringify(back) == JSON.stringify(big));
+print(JSON.stringify(JSON.parse("{\"long\": \"" + "abcdefghij0123456789abcdefghij0123456789" + "\"}")));
+JSON.parse("{\"a\": }");
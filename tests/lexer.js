@@ -0,0 +1,77 @@
+// Lexer: runs of blanks, names, digits, string characters and comments
+// across every block size of the SIMD levels, escapes at the block edges,
+// empty strings and line counting in the error at the end
+let v = 7;	// c
+print(v + 1);
+print("a\n\"q");
+print('s\'\\');
+print(1); print(0.1);
+ 
+let vxxxxxx       = 7777777;		// ccccccc
+print(vxxxxxx + 1);
+print("aaaaaaa\nbbb\"q");
+print('sssssss\'tt\\');
+print(1111111); print(0.0000001);
+       
+let vxxxxxxxxxxxxxx               = 777777777;// ccccccccccccccc
+print(vxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaa\nbbbbbbb\"");
+print('sssssssssssssss\'ttttt\\');
+print(111111111); print(0.000000000000001);
+               
+let vxxxxxxxxxxxxxxx                = 777777777;	// cccccccccccccccc
+print(vxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaa\nbbbbbbbb\"q");
+print('ssssssssssssssss\'ttttt\\');
+print(111111111); print(0.0000000000000001);
+                
+let vxxxxxxxxxxxxxxxx                 = 777777777;		// ccccccccccccccccc
+print(vxxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaaa\nbbbbbbbb\"qq");
+print('sssssssssssssssss\'ttttt\\');
+print(111111111); print(0.00000000000000001);
+                 
+let vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx                               = 777777777;	// ccccccccccccccccccccccccccccccc
+print(vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\nbbbbbbbbbbbbbbb\"q");
+print('sssssssssssssssssssssssssssssss\'tttttttttt\\');
+print(111111111); print(0.0000000000000000000000000000001);
+                               
+let vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx                                = 777777777;		// cccccccccccccccccccccccccccccccc
+print(vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\nbbbbbbbbbbbbbbbb\"qq");
+print('ssssssssssssssssssssssssssssssss\'tttttttttt\\');
+print(111111111); print(0.00000000000000000000000000000001);
+                                
+let vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx                                 = 777777777;			// ccccccccccccccccccccccccccccccccc
+print(vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\nbbbbbbbbbbbbbbbb\"");
+print('sssssssssssssssssssssssssssssssss\'ttttttttttt\\');
+print(111111111); print(0.000000000000000000000000000000001);
+                                 
+let vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx                                                               = 777777777;			// ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+print(vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\nbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\"");
+print('sssssssssssssssssssssssssssssssssssssssssssssssssssssssssssssss\'ttttttttttttttttttttt\\');
+print(111111111); print(0.000000000000000000000000000000000000000000000000000000000000001);
+                                                               
+let vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx                                                                = 777777777;				// cccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+print(vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\nbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\"q");
+print('ssssssssssssssssssssssssssssssssssssssssssssssssssssssssssssssss\'ttttttttttttttttttttt\\');
+print(111111111); print(0.0000000000000000000000000000000000000000000000000000000000000001);
+                                                                
+let vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx                                                                 = 777777777;// ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+print(vxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx + 1);
+print("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\nbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb\"qq");
+print('sssssssssssssssssssssssssssssssssssssssssssssssssssssssssssssssss\'ttttttttttttttttttttt\\');
+print(111111111); print(0.00000000000000000000000000000000000000000000000000000000000000001);
+                                                                 
+print("" + '' + "|");
+let e = ""; print(e.length);
+let tab = "a\tb\rc"; print(tab.length);
+// comment with "quotes" and 'apostrophes' \ and // again
+// CRLF line
+// x
+//
+undefined_after_crlf();
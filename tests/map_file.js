@@ -0,0 +1,27 @@
+// mapFile: read-only typed array views of a file
+let out = open("m.txt", "w");
+write(out, "hello\nworld\nfoo bar\n");
+close(out);
+let b = mapFile("m.txt");
+print(b);
+print(sum(b), min(b), max(b));
+print(count(b, "\n"), count(b, 111), indexOf(b, "o"), indexOf(b, "o", 5), indexOf(b, 300));
+let s = 0;
+let nl = indexOf(b, "\n");
+while (nl >= 0) {
+    print(text(b, s, nl));
+    s = nl + 1;
+    nl = indexOf(b, "\n", s);
+}
+print(text(b));
+print(Int32Array(b)[0]);
+let w = open("w.bin", "w");
+write(w, "AAAABBBB");
+close(w);
+let words = mapFile("w.bin", "Int32Array");
+print(words, sum(words));
+let e = open("empty.bin", "w");
+close(e);
+let none = mapFile("empty.bin");
+print(none, sum(none), count(none, 1), indexOf(none, 1), text(none));
+mapFile("no/such/file");
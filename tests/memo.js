@@ -0,0 +1,21 @@
+// memoize: pure functions only, results cached by argument values
+function fib2(n)
+{
+    if (n==1) return 1;
+    if (n==2) return 1;
+    return fib2(n-1)+fib2(n-2);
+}
+fib2 = memoize(fib2);
+print(fib2(80));
+print(memoStats());
+function sq(x) { let y = x * x; return y; }
+function hyp(a, b) { return sq(a) + sq(b); }
+let h = memoize(hyp, 16);
+print(h(3, 4)); print(h(3, 4)); print(h(3.0, 4));
+function sq(x) { return x + x; }
+print(h(3, 4));
+let g = 1;
+function impure(x) { g = g + x; return g; }
+print(impure(1));
+function usesglobal(x) { return x + g; }
+memoize(usesglobal);
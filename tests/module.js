@@ -0,0 +1,20 @@
+// env: TINYJS_PATH=modules/path
+// Modules: named, renamed and namespace imports, found by path or TINYJS_PATH,
+// each one loaded once
+import { double, twice, version, answer } from "./modules/util.js";
+import * as U from "modules/util";
+import { quad, sum as total } from "math2";
+function inc(x) { return x + 1; }
+print(double(5));
+print(twice(inc, 1));
+print(twice(double, 3));
+print(version);
+print(answer());
+print(U.double(7));
+print(U.version);
+print(quad(3));
+print(total([1, 2, 3, 4]));
+let helper = 100;
+print(double(1));
+print(sum(Float64Array([1.5, 2])));
+import { x } from "./modules/missing.js";
@@ -0,0 +1,3 @@
+import { double } from "../util.js";
+export function quad(x) { return double(double(x)); }
+export function sum(a) { let s = 0; for (let i = 0; i < a.length; i = i + 1) { s = s + a[i]; } return s; }
@@ -0,0 +1,8 @@
+let count = 0;
+function helper(x) { return x * 2; }
+export function double(x) { count = count + 1; return helper(x); }
+export function twice(f, x) { return f(f(x)); }
+export let version = 3;
+function hidden() { return 42; }
+export { hidden as answer, count };
+print("util loaded");
@@ -0,0 +1,51 @@
+// Numeric functions: unboxed int and float locals give what the tree walker
+// gives, for ints, floats, mixed values and arguments that are not numbers
+function sum(n) { let s = 0; for (let i = 0; i < n; i = i + 1) { s = s + i * i; } return s; }
+function avg(n) { let s = 0; let i = 0; while (i < n) { s = s + i; i = i + 1; } return s / n; }
+function favg(n) { let s = 0.0; let i = 0; while (i < n) { s = s + i; i = i + 1; } return s / n; }
+function grow(x) { let y = x; y = y * 1.5; return y; }
+function mix(a, b) { if (a > b) { return a - b; } else { return b - a; } }
+function collatz(n) { let c = 0; while (n > 1) { if (n % 2 == 0) { n = n / 2; } else { n = 3 * n + 1; } c = c + 1; } return c; }
+function bits(a) { return (a << 3) ^ (a >> 1) | ~a & 255; }
+function brk(n) { let i = 0; do { i = i + 1; if (i == 7) { break; } } while (i < n); return i; }
+function cont(n) { let s = 0; for (let i = 0; i < n; i = i + 1) { if (i % 3 == 0) { continue; } s = s + i; } return s; }
+function bad(n) { let x = 1; if (n) { x = 2.5; } return x; }
+function logic(a, b) { return (a && b) + (a || b) + !a + !b; }
+function neg(x) { return -x + +x - -x; }
+function shadow(n) { let x = n; if (1) { let x = 2.5; n = x * 2; } return x + n; }
+print(sum(1000));
+print(avg(10));
+print(favg(10));
+print(grow(4));
+print(grow(4.0));
+print(mix(3, 10));
+print(mix(3.5, 1));
+print(collatz(27));
+print(bits(1234));
+print(bits(12.7));
+print(brk(100));
+print(brk(3));
+print(cont(20));
+print(bad(0));
+print(bad(1));
+print(logic(0, 3));
+print(logic(2.5, 0.0));
+print(neg(5));
+print(neg(2.5));
+print(shadow(3));
+function poly(n) { let x = 0.0; let acc = 0.0; while (x < n) { acc = acc + x * x * 0.5 - x / 3.0; x = x + 1; } return acc; }
+print(poly(1000));
+function divmod(a, b) { return a / b * 1000 + a % b; }
+print(divmod(17, 5));
+print(divmod(-17, 5));
+print(divmod(17.5, 5));
+function cmp(a, b) { return (a < b) + (a <= b) * 2 + (a == b) * 4 + (a != b) * 8 + (a >= b) * 16 + (a > b) * 32; }
+print(cmp(1, 2));
+print(cmp(2, 2));
+print(cmp(2.5, 2));
+function wrap(n) { let x = 1; for (let i = 0; i < n; i = i + 1) { x = x * 3; } return x; }
+print(wrap(10));
+print(wrap(25));
+print(sum(10.5));
+print(mix(2, 0.5));
+print(grow("4"));
@@ -0,0 +1,17 @@
+// Buffered output: number formats, flush, and output before an error
+print(0.1); print(-0.0); print(123456.0); print(1234567.0); print(3.14159265); print(-2.5);
+print(100); print(-7);
+print([1.5, -0.0, 2.0]);
+print("a", 1, 2.5);
+let i = 0;
+while (i < 3000) { if (i % 1000 == 0) { print(i); } i = i + 1; }
+function d(a, b) { return a / b; }
+function m(a, b) { return a % b; }
+print(d(7, 2)); print(d(1, 0)); print(d(-1, 0)); print(d(0, 0));
+print(m(7, 3)); print(m(7, 0));
+print(7 / 0); print(-7 % 0);
+let big = 1 << 63;
+print(d(big, -1)); print(m(big, -1));
+flush();
+print("before the error");
+print(undefined_var + 1);
@@ -0,0 +1,24 @@
+// env: TINYJS_THREADS=4
+// parallel_for / parallel_reduce on the thread pool
+function work(i)
+{
+    let s = 0;
+    for (let k = 0; k < 20000; k = k + 1) { s = s + (k * i) % 7; }
+    return s;
+}
+function add(a, b) { return a + b; }
+let r = parallel_for(0, 8, work);
+print(r);
+print(parallel_reduce(0, 200, work, add, 0));
+function sq(i) { return i * i; }
+print(parallel_reduce(1, 1001, sq, add, 5));
+print(parallel_for(3, 3, sq));
+function helper(x) { let a = [x, x * 2]; return a[0] + a[1]; }
+function mk(i) { let t = 0; for (let j = 0; j < 50; j = j + 1) { t = t + helper(j + i); } return [i, t]; }
+let rows = parallel_for(0, 64, mk);
+print(rows[63]);
+print(rows.length);
+let g = 0;
+function bad(i) { g = g + 1; return g; }
+parallel_for(0, 10, bad);
+print("not reached");
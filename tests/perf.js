@@ -0,0 +1,15 @@
+// env: TINYJS_PERF=map
+// Perf symbols: every script function called through its trampoline gives
+// the same results, errors and recursion limit included
+function fib(n) { if (n < 2) return n; return fib(n - 1) + fib(n - 2); }
+print(fib(20));
+function make(k) { return function (x) { return x * k; }; }
+let triple = make(3);
+print(triple(14));
+print(map(Float64Array([1, 2, 3]), function (x) { return x + 0.5; }));
+async function later(v) { let r = await sleep(1); return v + r; }
+print(await later(40));
+function depth(n) { if (n == 0) return 0; return 1 + depth(n - 1); }
+print(depth(1000));
+print([fib, triple].length);
+depth(10000000);
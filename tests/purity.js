@@ -0,0 +1,30 @@
+// env: TINYJS_MEMOIZE=1
+// Purity analysis: only pure functions are memoized, a hit shows in
+// memoStats after a second call with the same arguments
+function sq(x) { return x * x; }
+function imp(x) { g = x; return x; }
+function imp2(a) { a[0] = 1; return 2; }
+function dflt(x, y = sq(2)) { let z = x + y; return z; }
+function dflt2(x, y = imp(2)) { return x + y; }
+function nested(x) { let f = function (y) { return y; }; return x; }
+function mcall(s) { return s.length; }
+function loops(n) { let s = 0; for (let i = 0; i < n; i = i + 1) { if (i % 2) { continue; } s = s + sq(i); } return s; }
+let g = 0;
+print(sq(7)); print(sq(7));
+print(memoStats());
+print(imp(3)); print(imp(3));
+print(memoStats());
+print(imp2([0])); print(imp2([0]));
+print(memoStats());
+print(dflt(1)); print(dflt(1));
+print(memoStats());
+print(dflt2(1)); print(dflt2(1));
+print(memoStats());
+print(nested(4)); print(nested(4));
+print(memoStats());
+print(mcall("abc")); print(mcall("abc"));
+print(memoStats());
+print(loops(10)); print(loops(10));
+print(memoStats());
+print(memoize(sq)(9));
+memoize(nested);
@@ -0,0 +1,58 @@
+// Regular expressions on cached DFAs
+let re = /ab+c/;
+print(re);
+print(test(re, "xxabbbcyy"));
+print(re.test("ac"));
+print(match("xx abbc abc", /ab+c/));
+print(match("xx abbc abc", /ab+c/g));
+print("no".match(/z/));
+print(replace("a-b-c", /-/g, "+"));
+print("a-b-c".replace(/-/, "[$&]"));
+print("aaa".replace(/a*/g, "X"));
+print("hello world".replace(/o/g, function (m) { return "0"; }));
+print(match("abcd", /abcd|b/));
+print(match("foo=1; bar=22", /[a-z]+=[0-9]+/g));
+print(test(/^abc$/, "abc"), test(/^abc$/, "xabc"), test(/^abc$/, "abcx"));
+print(match("ERROR: disk", /^(error|warn)/i));
+print(match("a1b22c333", /\d{2,}/g));
+print(match("x  y", /\s+/));
+print(test(/colou?r/, "color"), test(/colou?r/, "colour"), test(/colou?r/, "colouur"));
+let r2 = RegExp("[0-9]+", "g");
+print(match("1 22 333", r2));
+print(r2 == r2);
+let x = 10 / 2 / 5;
+print(x);
+let a = [4, 8];
+print(a[1] / a[0]);
+print((a[1] + 2) / 5);
+if (re) { print("truthy"); }
+print(match("a.b", /\./));
+print(match("path/to/file", /[^/]+$/));
+print(match("p/q", /\//));
+print(test(/(a|b)*abb/, "babababb"));
+print(test(/(a|b)*abb/, "babababa"));
+print(match("q", /^q$/));
+print(match("xyz", /$/));
+let as = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab";
+print(test(/(a*)*c/, as));
+print(test(/(a|aa)+$/, as));
+let many = /(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)$/;
+let ab = "abbabababbbabababbbaaabbababbabbbbaabababbababbbbabababbaabababaabbbababaababbabaaabbbaba";
+let t = ab + ab + ab + ab + ab + ab + ab + ab + ab + ab;
+let hits = 0;
+for (let i = 0; i < 200; i = i + 1) { hits = hits + test(many, t + "abbbbbbbbbbbbb"); }
+print(hits);
+print(test(many, t + "bbbbbbbbbbbbbb"));
+print(match("Hello World", /world/i));
+print(match("k=v", /[=]/));
+print(match("tab\there", /\t/));
+print(match("x1y", /[\d]/));
+print(match("ab", /(?:a)(?<n>b)/));
+let bytes = Uint8Array(3);
+bytes[0] = 65; bytes[1] = 66; bytes[2] = 67;
+print(test(/BC/, bytes), test(/BC/, bytes, 0, 2));
+print(match(text(bytes), /B./));
+let days = "mon,tue,,wed";
+print(days.replace(/,+/g, ";"));
+print(/a/ == /a/);
+let bad = RegExp("(a");
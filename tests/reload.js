@@ -0,0 +1,20 @@
+// env: TINYJS_WATCH=20
+// Hot reload: edited functions take effect while the loop runs, one that
+// does not parse keeps its old definition
+function greet(n) { return "hello " + n; }
+function calc(x) { return x + 1; }
+function edit(from, to) {
+    let f = open("reload.js");
+    let src = "";
+    while (!eof(f)) { src = src + readLine(f) + "\n"; }
+    close(f);
+    let out = open("reload.js", "w");
+    write(out, src.replace(from, to));
+    close(out);
+}
+print(greet("a"));
+print(calc(1));
+edit(/hello /, "hi ");
+setTimeout(function () { print(greet("b")); edit(/x \+ 1;/, "x * 10;"); }, 200);
+setTimeout(function () { print(calc(2)); edit(/x \* 10;/, "x *;"); }, 400);
+setTimeout(function () { print(calc(3)); print(greet("c")); }, 600);
@@ -0,0 +1,60 @@
+#!/bin/bash
+# Behaviour checks: tests/<name>.js must print tests/<name>.out
+#
+# usage: tests/run.sh [interpreter] [name...]
+#
+# Each script runs as is, then with each optimized engine turned off, with
+# all of them off (the plain tree walker), and at each SIMD level: every
+# run must print the expected output. A first line "// env: NAME=value ..."
+# adds variables to every run of the script. Scripts run in a scratch copy
+# of this directory, so they may write files. The "Time :" line and the
+# times in reports are left out of the comparison.
+
+Bin=$(realpath "${1:-./TinyJS.o}")
+shift
+Dir=$(cd "$(dirname "$0")" && pwd)
+
+Modes=(
+    ""
+    "TINYJS_NO_KERNELS=1"
+    "TINYJS_NO_IR=1"
+    "TINYJS_NO_INLINE=1"
+    "TINYJS_NO_COMPILE=1"
+    "TINYJS_NO_KERNELS=1 TINYJS_NO_INLINE=1 TINYJS_NO_COMPILE=1"
+    "TINYJS_SIMD=scalar"
+    "TINYJS_SIMD=sse2"
+    "TINYJS_MEMOIZE=1"
+)
+
+Names=("$@")
+if [ ${#Names[@]} -eq 0 ]; then
+    for F in "$Dir"/*.out; do Names+=("$(basename "$F" .out)"); done
+fi
+
+Work=$(mktemp -d)
+trap 'rm -rf "$Work"' EXIT
+
+Failed=0
+for Name in "${Names[@]}"; do
+    Before=$Failed
+    Env=$(sed -n '1s|^// env: ||p' "$Dir/$Name.js")
+    for Mode in "${Modes[@]}"; do
+        rm -rf "$Work/run" && cp -r "$Dir" "$Work/run"
+        (cd "$Work/run" && env $Env $Mode timeout 60 "$Bin" "$Name.js" > "$Work/got" 2>&1)
+        Status=$?
+        Got=$(grep -v '^Time : ' "$Work/got" | sed 's/ in [0-9.]* ms$//')
+        # An error exits with 1, a timeout or a signal is a failure
+        if [ $Status -gt 1 ]; then
+            echo "FAIL $Name ${Mode:-(default)}: exit status $Status"
+            Failed=$((Failed + 1))
+        elif [ "$Got" != "$(cat "$Dir/$Name.out")" ]; then
+            echo "FAIL $Name ${Mode:-(default)}"
+            diff <(echo "$Got") "$Dir/$Name.out" | head -20
+            Failed=$((Failed + 1))
+        fi
+    done
+    [ $Failed -eq $Before ] && echo "ok   $Name"
+done
+
+[ $Failed -eq 0 ] && echo "all ${#Names[@]} checks passed" || echo "$Failed failed runs"
+[ $Failed -eq 0 ]
@@ -0,0 +1,67 @@
+// Typed arrays and their bulk kernels
+let a = Float64Array([1.5, 2, 3, 4, 5, 6, 7, 8, 9, 10]);
+print(a);
+print(sum(a));
+print(min(a));
+print(max(a));
+let b = Int32Array(10);
+for (let i = 0; i < b.length; i = i + 1) b[i] = i * 3 - 7;
+print(b);
+print(sum(b));
+print(min(b));
+print(max(b));
+print(dot(b, b));
+print(dot(a, a));
+print(add(b, b));
+print(scale(a, 2));
+print(scale(b, 2));
+print(scale(b, 0.5));
+function twice(x) { return x * 2 + 1 / 2; }
+print(map(a, twice));
+print(map(b, twice));
+function half(x) { return -x / 2; }
+print(map(b, half));
+function weird(x) { if (x > 3) return 1; return 0; }
+print(map(a, weird));
+for (let v of Int32Array([4,5])) print(v);
+let big = Float64Array(100000);
+for (let i = 0; i < 100000; i = i + 1) big[i] = i;
+print(sum(big));
+print(dot(big, big));
+function sq(x) { return x * x; }
+print(sum(map(big, sq)));
+print(b[3]);
+b[3] = 2.9;
+print(b[3]);
+function add(p, q) { return p - q; }
+print(add(5, 3));
+// min and max: NaN if any element is, -0 is below +0, at every SIMD level
+let z = 0.0;
+let nz = -z;
+let nan = z / z;
+function negate(x) { return -x; }
+function inv(x) { return 1 / x; }
+let u = Float64Array([3, 1, 2, 5, 4, 6, 7, 8, 9]);
+print(min(u)); print(max(u));
+let w = Float64Array([3, 1, 2, 5, 4, 6, 7, 8, 9]);
+w[6] = nan;
+print(min(w)); print(max(w));
+let c = Float64Array([0, 0, 0, 0, 0, 0, 0, 0, 0]);
+c[7] = nz;
+print(1 / min(c)); print(1 / max(c));
+c[7] = z; c[0] = nz;
+print(1 / min(c)); print(1 / max(c));
+let d = Float64Array([0, 0, 0, 0, 0, 0, 0, 0, 0]);
+for (let i = 0; i < 9; i = i + 1) { d[i] = nz; }
+print(1 / min(d)); print(1 / max(d));
+d[8] = z;
+print(1 / min(d)); print(1 / max(d));
+print(map(map(u, negate), inv));
+print(map(map(Float64Array([0, 0, 0, 0, 0]), negate), inv));
+print(1 / negate(0.0));
+let bytes = Uint8Array([104, 105, 10, 104, 111, 10, 255]);
+print(sum(bytes), min(bytes), max(bytes));
+print(count(bytes, 10), indexOf(bytes, 111), indexOf(bytes, 7));
+let odd = Int32Array(37);
+for (let i = 0; i < 37; i = i + 1) odd[i] = 18 - i;
+print(sum(odd), min(odd), max(odd), dot(odd, odd));